@@ -17,9 +17,17 @@
 
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace cpp_odbc {
 
+/**
+ * @brief Attributes and their intptr_t values which are set before a connection is
+ *        established, e.g., driver-specific options that cannot be changed afterwards
+ */
+using connection_attributes = std::vector<std::pair<SQLINTEGER, intptr_t>>;
+
 /**
  * @brief This interface represents a connection with an ODBC database
  */
@@ -31,6 +31,14 @@ public:
 	 */
 	std::shared_ptr<connection> make_connection(std::string const & connection_string) const;
 
+	/**
+	 * @brief Create a new connection with the given connection string
+	 * @param connection_string This string is used to acquire the ODBC connection
+	 * @param attributes These attributes are set before the connection is established
+	 * @return A shared pointer to a new connection
+	 */
+	std::shared_ptr<connection> make_connection(std::string const & connection_string, connection_attributes const & attributes) const;
+
 	/**
 	 * @param Set the attribute to the given intptr_t value
 	 * @param attribute An ODBC constant which represents the attribute which shall be set
@@ -42,7 +50,7 @@ public:
 protected:
 	environment();
 private:
-	virtual std::shared_ptr<connection> do_make_connection(std::string const & connection_string) const = 0;
+	virtual std::shared_ptr<connection> do_make_connection(std::string const & connection_string, connection_attributes const & attributes) const = 0;
 	virtual void do_set_attribute(SQLINTEGER attribute, intptr_t value) const = 0;
 };
 
@@ -0,0 +1,33 @@
+#pragma once
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+#include "sql.h"
+
+namespace cpp_odbc { namespace level1 {
+
+/**
+ * @brief Pointers to the bcp_* functions of the Microsoft ODBC Driver for SQL Server.
+ *        Driver managers do not export these functions, so they are looked up in the
+ *        driver library which the driver manager has loaded for an open connection.
+ */
+struct bulk_copy_functions {
+    int (SQL_API * init)(SQLHDBC, SQLWCHAR const *, SQLWCHAR const *, SQLWCHAR const *, int);
+    int (SQL_API * control)(SQLHDBC, int, void *);
+    int (SQL_API * bind)(SQLHDBC, unsigned char const *, int, SQLINTEGER, unsigned char const *, int, int, int);
+    int (SQL_API * column_pointer)(SQLHDBC, unsigned char const *, int);
+    int (SQL_API * column_length)(SQLHDBC, SQLINTEGER, int);
+    int (SQL_API * send_row)(SQLHDBC);
+    SQLINTEGER (SQL_API * batch)(SQLHDBC);
+    SQLINTEGER (SQL_API * done)(SQLHDBC);
+};
+
+/**
+ * @brief Retrieve the bcp_* functions of the loaded SQL Server driver. Failed lookups
+ *        are repeated on the next call since the driver may be loaded later on.
+ * @return The resolved functions or nullptr if no loaded library exports all of them
+ */
+bulk_copy_functions const * get_bulk_copy_functions();
+
+} }
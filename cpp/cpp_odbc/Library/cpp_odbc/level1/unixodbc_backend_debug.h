@@ -12,6 +12,7 @@ private:
     SQLRETURN do_allocate_handle(SQLSMALLINT handle_type, SQLHANDLE input_handle, SQLHANDLE * output_handle_ptr) const final;
     SQLRETURN do_free_handle(SQLSMALLINT handle_type, SQLHANDLE handle) const final;
     SQLRETURN do_get_diagnostic_record(SQLSMALLINT handle_type, SQLHANDLE handle, SQLSMALLINT record_id, SQLCHAR * status_code_ptr, SQLINTEGER * native_error_ptr, SQLCHAR * message_text, SQLSMALLINT buffer_length, SQLSMALLINT * text_length_ptr) const final;
+    SQLRETURN do_get_diagnostic_field(SQLSMALLINT handle_type, SQLHANDLE handle, SQLSMALLINT record_id, SQLSMALLINT diagnostic_id, SQLPOINTER diagnostic_info_ptr, SQLSMALLINT buffer_length, SQLSMALLINT * string_length_ptr) const final;
     SQLRETURN do_set_environment_attribute(SQLHENV environment_handle, SQLINTEGER attribute, SQLPOINTER value_ptr, SQLINTEGER string_length) const final;
     SQLRETURN do_set_connection_attribute(SQLHDBC connection_handle, SQLINTEGER attribute, SQLPOINTER value_ptr, SQLINTEGER string_length) const final;
     SQLRETURN do_establish_connection(SQLHDBC connection_handle, SQLHWND window_handle, SQLCHAR * input_connection_string, SQLSMALLINT input_connection_string_length, SQLCHAR * out_connection_string, SQLSMALLINT output_connection_string_buffer_length, SQLSMALLINT * output_connection_string_length, SQLUSMALLINT driver_completion) const final;
@@ -37,6 +38,15 @@ private:
     SQLRETURN do_describe_parameter(SQLHSTMT statement_handle, SQLUSMALLINT parameter_number, SQLSMALLINT * data_type, SQLULEN * column_size, SQLSMALLINT * decimal_digits, SQLSMALLINT * nullable) const final;
     SQLRETURN do_more_results(SQLHSTMT statement_handle) const final;
     SQLRETURN do_get_functions(SQLHDBC connection_handle, SQLUSMALLINT function_id, SQLUSMALLINT * is_supported) const final;
+    SQLRETURN do_set_descriptor_field(SQLHDESC descriptor_handle, SQLSMALLINT record_number, SQLSMALLINT field_identifier, SQLPOINTER value_ptr, SQLINTEGER buffer_length) const final;
+    int do_bulk_copy_init(SQLHDBC connection_handle, SQLWCHAR const * table_name, SQLWCHAR const * data_file, SQLWCHAR const * error_file, int direction) const final;
+    int do_bulk_copy_control(SQLHDBC connection_handle, int option, void * value) const final;
+    int do_bulk_copy_bind(SQLHDBC connection_handle, unsigned char const * data, int indicator_length, SQLINTEGER data_length, unsigned char const * terminator, int terminator_length, int data_type, int column) const final;
+    int do_bulk_copy_column_pointer(SQLHDBC connection_handle, unsigned char const * data, int column) const final;
+    int do_bulk_copy_column_length(SQLHDBC connection_handle, SQLINTEGER data_length, int column) const final;
+    int do_bulk_copy_send_row(SQLHDBC connection_handle) const final;
+    SQLINTEGER do_bulk_copy_batch(SQLHDBC connection_handle) const final;
+    SQLINTEGER do_bulk_copy_done(SQLHDBC connection_handle) const final;
 };
 
 } }
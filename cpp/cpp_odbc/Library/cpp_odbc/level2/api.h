@@ -9,6 +9,8 @@
 #include "cpp_odbc/multi_value_buffer.h"
 #include "cpp_odbc/column_description.h"
 
+#include <vector>
+
 namespace cpp_odbc { namespace level2 {
 
 /**
@@ -95,6 +97,14 @@ public:
      */
     diagnostic_record get_diagnostic_record(environment_handle const & handle) const;
 
+    /**
+     * @brief Retrieve all diagnostic records associated with the given statement
+     *        together with the rows or parameter sets they refer to
+     * @param handle Only diagnostic records associated with this handle are retrieved
+     * @return All records in the order the driver reports them
+     */
+    std::vector<row_diagnostic_record> get_row_diagnostic_records(statement_handle const & handle) const;
+
     /**
      * @brief Set an attribute of the environment to a specific integer value
      * @param handle Set the attribute for the environment associated with this handle
@@ -169,6 +179,42 @@ public:
      */
     void bind_input_parameter(statement_handle const & handle, SQLUSMALLINT parameter_id, SQLSMALLINT value_type, SQLSMALLINT parameter_type, SQLSMALLINT digits, multi_value_buffer & parameter_values) const;
 
+    /**
+     * @brief Bind a buffer of SQL_NUMERIC_STRUCT values to a column of the statement.
+     *        Precision and scale are set in the application row descriptor.
+     * @param handle The statement which holds a result set
+     * @param column_id The column identifier with which we want to associate the buffer
+     * @param precision The number of significant digits of the values
+     * @param scale The number of digits right of the decimal point
+     * @param column_buffer A buffer which will be filled with data whenever fetch_scroll() is called.
+     */
+    void bind_numeric_column(statement_handle const & handle, SQLUSMALLINT column_id, SQLSMALLINT precision, SQLSMALLINT scale, multi_value_buffer & column_buffer) const;
+
+    /**
+     * @brief Bind a buffer of SQL_NUMERIC_STRUCT values for use as an input parameter.
+     *        Precision and scale are set in the application parameter descriptor.
+     * @param handle The parameter shall be bound to this statement
+     * @param parameter_id The parameter identifier
+     * @param parameter_type The SQL data type identifier of the buffer. See unixODBC's SQLBindParameter() documentation
+     * @param precision The number of significant digits of the values
+     * @param scale The number of digits right of the decimal point
+     * @param parameter_values The buffer which shall be bound as a parameter.
+     */
+    void bind_numeric_input_parameter(statement_handle const & handle, SQLUSMALLINT parameter_id, SQLSMALLINT parameter_type, SQLSMALLINT precision, SQLSMALLINT scale, multi_value_buffer & parameter_values) const;
+
+    /**
+     * @brief Bind a table-valued parameter (SQL Server's SQL_SS_TABLE). The columns
+     *        of the table are bound as input parameters while the statement attribute
+     *        SQL_SOPT_SS_PARAM_FOCUS is set to parameter_id.
+     * @param handle The parameter shall be bound to this statement
+     * @param parameter_id The parameter identifier
+     * @param type_name Name of the table type. The driver keeps a pointer to it, so
+     *                  it needs to stay alive until the statement is executed.
+     * @param maximum_rows The number of rows the column buffers can hold
+     * @param row_count Holds the number of rows which are sent on execution
+     */
+    void bind_table_input_parameter(statement_handle const & handle, SQLUSMALLINT parameter_id, std::u16string const & type_name, SQLULEN maximum_rows, SQLLEN * row_count) const;
+
     /**
      * @brief Executes an SQL query which has previously been prepared
      * @param handle The statement handle which shall be prepared
@@ -271,6 +317,15 @@ public:
      */
     void set_statement_attribute(statement_handle const & handle, SQLINTEGER attribute, SQLULEN * pointer) const;
 
+    /**
+     * @brief Set an attribute of the statement to a pointer to an array of SQLUSMALLINT
+     *        values, e.g., SQL_ATTR_PARAM_STATUS_PTR or SQL_ATTR_PARAM_OPERATION_PTR
+     * @param handle Set an attribute for this statement
+     * @param attribute Set this attribute. See unixODBC's SQLSetStmtAttr() documentation
+     * @param pointer The pointer which shall be set for this attribute
+     */
+    void set_statement_attribute(statement_handle const & handle, SQLINTEGER attribute, SQLUSMALLINT * pointer) const;
+
     /**
      * @brief Determine the number of rows in the result set associated with the statement
      * @param handle The statement which holds the result set
@@ -317,6 +372,69 @@ public:
      */
     bool supports_function(connection_handle const & handle, SQLUSMALLINT function_id) const;
 
+    /**
+     * @brief Prepare the connection for bulk copying rows into a table. The connection
+     *        must use the Microsoft ODBC Driver for SQL Server and must have been
+     *        established with the SQL_COPT_SS_BCP attribute enabled.
+     * @param handle The connection which shall be used for bulk copying
+     * @param table The name of the target table
+     * @return A handle for use with the other bulk copy functions
+     */
+    bulk_copy_handle initialize_bulk_copy(connection_handle const & handle, std::u16string const & table) const;
+
+    /**
+     * @brief Set a bulk copy option to a given integer value
+     * @param handle The bulk copy operation
+     * @param option The option which shall be set. See bcp_control() documentation
+     * @param value The value which shall be set for this option
+     */
+    void set_bulk_copy_option(bulk_copy_handle const & handle, int option, intptr_t value) const;
+
+    /**
+     * @brief Set the hints of a bulk copy operation, e.g., "TABLOCK"
+     * @param handle The bulk copy operation
+     * @param hints The hints as a comma-separated list
+     */
+    void set_bulk_copy_hints(bulk_copy_handle const & handle, std::u16string const & hints) const;
+
+    /**
+     * @brief Bind a column of the target table. Data and lengths of values are
+     *        supplied row by row with set_bulk_copy_column_data().
+     * @param handle The bulk copy operation
+     * @param column_id One-based index of the column within the target table
+     * @param data_type The SQL Server type token of the data, e.g., SQLINT4. See bcp_bind() documentation
+     */
+    void bind_bulk_copy_column(bulk_copy_handle const & handle, int column_id, int data_type) const;
+
+    /**
+     * @brief Set the value of a bound column for the next row
+     * @param handle The bulk copy operation
+     * @param column_id One-based index of the column within the target table
+     * @param data Pointer to the value. Must stay valid until the row has been sent
+     * @param length The length of the value in bytes or SQL_NULL_DATA
+     */
+    void set_bulk_copy_column_data(bulk_copy_handle const & handle, int column_id, void const * data, SQLINTEGER length) const;
+
+    /**
+     * @brief Send the current values of all bound columns as a new row
+     * @param handle The bulk copy operation
+     */
+    void send_bulk_copy_row(bulk_copy_handle const & handle) const;
+
+    /**
+     * @brief Commit all rows which have been sent since the last batch
+     * @param handle The bulk copy operation
+     * @return The number of committed rows
+     */
+    SQLINTEGER commit_bulk_copy_batch(bulk_copy_handle const & handle) const;
+
+    /**
+     * @brief Commit all remaining rows and end the bulk copy operation
+     * @param handle The bulk copy operation
+     * @return The number of rows committed since the last batch
+     */
+    SQLINTEGER finish_bulk_copy(bulk_copy_handle const & handle) const;
+
 protected:
 
     api();
@@ -333,6 +451,7 @@ private:
     virtual diagnostic_record do_get_diagnostic_record(statement_handle const & handle) const = 0;
     virtual diagnostic_record do_get_diagnostic_record(connection_handle const & handle) const = 0;
     virtual diagnostic_record do_get_diagnostic_record(environment_handle const & handle) const = 0;
+    virtual std::vector<row_diagnostic_record> do_get_row_diagnostic_records(statement_handle const & handle) const = 0;
 
     virtual void do_set_environment_attribute(environment_handle const & handle, SQLINTEGER attribute, intptr_t value) const = 0;
     virtual void do_set_connection_attribute(connection_handle const & handle, SQLINTEGER attribute, intptr_t value) const = 0;
@@ -344,6 +463,9 @@ private:
 
     virtual void do_bind_column(statement_handle const & handle, SQLUSMALLINT column_id, SQLSMALLINT column_type, multi_value_buffer & column_buffer) const = 0;
     virtual void do_bind_input_parameter(statement_handle const & handle, SQLUSMALLINT parameter_id, SQLSMALLINT value_type, SQLSMALLINT parameter_type, SQLSMALLINT digits, multi_value_buffer & parameter_values) const = 0;
+    virtual void do_bind_numeric_column(statement_handle const & handle, SQLUSMALLINT column_id, SQLSMALLINT precision, SQLSMALLINT scale, multi_value_buffer & column_buffer) const = 0;
+    virtual void do_bind_numeric_input_parameter(statement_handle const & handle, SQLUSMALLINT parameter_id, SQLSMALLINT parameter_type, SQLSMALLINT precision, SQLSMALLINT scale, multi_value_buffer & parameter_values) const = 0;
+    virtual void do_bind_table_input_parameter(statement_handle const & handle, SQLUSMALLINT parameter_id, std::u16string const & type_name, SQLULEN maximum_rows, SQLLEN * row_count) const = 0;
     virtual void do_execute_prepared_statement(statement_handle const & handle) const = 0;
     virtual void do_execute_statement(statement_handle const & handle, std::string const & sql) const = 0;
     virtual bool do_fetch_scroll(statement_handle const & statement_handle, SQLSMALLINT fetch_orientation, SQLLEN fetch_offset) const = 0;
@@ -357,12 +479,21 @@ private:
     virtual void do_prepare_statement(statement_handle const & handle, std::u16string const & sql) const = 0;
     virtual void do_set_statement_attribute(statement_handle const & handle, SQLINTEGER attribute, intptr_t value) const = 0;
     virtual void do_set_statement_attribute(statement_handle const & handle, SQLINTEGER attribute, SQLULEN * pointer) const = 0;
+    virtual void do_set_statement_attribute(statement_handle const & handle, SQLINTEGER attribute, SQLUSMALLINT * pointer) const = 0;
     virtual SQLLEN do_row_count(statement_handle const & handle) const = 0;
     virtual column_description do_describe_column(statement_handle const & handle, SQLUSMALLINT column_id) const = 0;
     virtual column_description do_describe_column_wide(statement_handle const & handle, SQLUSMALLINT column_id) const = 0;
     virtual column_description do_describe_parameter(statement_handle const & handle, SQLUSMALLINT parameter_id) const = 0;
     virtual bool do_more_results(statement_handle const & handle) const = 0;
     virtual bool do_supports_function(connection_handle const & handle, SQLUSMALLINT function_id) const = 0;
+    virtual bulk_copy_handle do_initialize_bulk_copy(connection_handle const & handle, std::u16string const & table) const = 0;
+    virtual void do_set_bulk_copy_option(bulk_copy_handle const & handle, int option, intptr_t value) const = 0;
+    virtual void do_set_bulk_copy_hints(bulk_copy_handle const & handle, std::u16string const & hints) const = 0;
+    virtual void do_bind_bulk_copy_column(bulk_copy_handle const & handle, int column_id, int data_type) const = 0;
+    virtual void do_set_bulk_copy_column_data(bulk_copy_handle const & handle, int column_id, void const * data, SQLINTEGER length) const = 0;
+    virtual void do_send_bulk_copy_row(bulk_copy_handle const & handle) const = 0;
+    virtual SQLINTEGER do_commit_bulk_copy_batch(bulk_copy_handle const & handle) const = 0;
+    virtual SQLINTEGER do_finish_bulk_copy(bulk_copy_handle const & handle) const = 0;
 };
 
 } }
@@ -11,6 +11,11 @@
  *
  */
 
+#ifdef _WIN32
+#include <windows.h>
+#endif
+#include <sqltypes.h>
+
 #include <string>
 
 namespace cpp_odbc { namespace level2 {
@@ -24,4 +29,12 @@ struct diagnostic_record {
 	std::string message;			///< error message as given by the ODBC driver
 };
 
+/**
+ * @brief A diagnostic record together with the row or parameter set it refers to
+ */
+struct row_diagnostic_record {
+	SQLLEN row_number;				///< one-based row or parameter set number, or SQL_NO_ROW_NUMBER/SQL_ROW_NUMBER_UNKNOWN
+	diagnostic_record record;		///< the diagnostics
+};
+
 } }
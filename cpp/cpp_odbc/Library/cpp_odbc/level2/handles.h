@@ -88,4 +88,27 @@ struct statement_handle {
 	bool operator!=(statement_handle const & other) const;
 };
 
+/**
+ * @brief This struct represents a connection on which bulk copy operations have been
+ *        initialized. The bcp_* functions of the Microsoft ODBC Driver for SQL Server
+ *        require the driver's own connection handle, whereas diagnostics are retrieved
+ *        through the driver manager's handle.
+ */
+struct bulk_copy_handle {
+	void * handle;						///< the driver's connection handle for use with bcp_* functions
+	connection_handle connection;		///< the driver manager's connection handle
+
+	/**
+	 * @brief Compares two handles with each other. Two handle structs are equal when their
+	 *        handle members are equal.
+	 */
+	bool operator==(bulk_copy_handle const & other) const;
+
+	/**
+	 * @brief Compares two handles with each other. Two handle structs are not equal when their
+	 *        handle members are not equal.
+	 */
+	bool operator!=(bulk_copy_handle const & other) const;
+};
+
 } }
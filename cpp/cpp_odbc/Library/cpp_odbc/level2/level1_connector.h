@@ -36,6 +36,7 @@ private:
 	diagnostic_record do_get_diagnostic_record(statement_handle const & handle) const final;
 	diagnostic_record do_get_diagnostic_record(connection_handle const & handle) const final;
 	diagnostic_record do_get_diagnostic_record(environment_handle const & handle) const final;
+	std::vector<row_diagnostic_record> do_get_row_diagnostic_records(statement_handle const & handle) const final;
 	void do_set_environment_attribute(environment_handle const & handle, SQLINTEGER attribute, intptr_t value) const final;
 	void do_set_connection_attribute(connection_handle const & handle, SQLINTEGER attribute, intptr_t value) const final;
 	void do_establish_connection(connection_handle & handle, std::string const & connection_string) const final;
@@ -45,6 +46,9 @@ private:
 	SQLUINTEGER do_get_integer_connection_info(connection_handle const & handle, SQLUSMALLINT info_type) const final;
 	void do_bind_column(statement_handle const & handle, SQLUSMALLINT column_id, SQLSMALLINT column_type, multi_value_buffer & column_buffer) const final;
 	void do_bind_input_parameter(statement_handle const & handle, SQLUSMALLINT parameter_id, SQLSMALLINT value_type, SQLSMALLINT parameter_type, SQLSMALLINT digits, multi_value_buffer & parameter_values) const final;
+	void do_bind_numeric_column(statement_handle const & handle, SQLUSMALLINT column_id, SQLSMALLINT precision, SQLSMALLINT scale, multi_value_buffer & column_buffer) const final;
+	void do_bind_numeric_input_parameter(statement_handle const & handle, SQLUSMALLINT parameter_id, SQLSMALLINT parameter_type, SQLSMALLINT precision, SQLSMALLINT scale, multi_value_buffer & parameter_values) const final;
+	void do_bind_table_input_parameter(statement_handle const & handle, SQLUSMALLINT parameter_id, std::u16string const & type_name, SQLULEN maximum_rows, SQLLEN * row_count) const final;
 	void do_execute_prepared_statement(statement_handle const & handle) const final;
 	void do_execute_statement(statement_handle const & handle, std::string const & sql) const final;
 	bool do_fetch_scroll(statement_handle const & statement_handle, SQLSMALLINT fetch_orientation, SQLLEN fetch_offset) const final;
@@ -58,12 +62,21 @@ private:
 	void do_prepare_statement(statement_handle const & handle, std::u16string const & sql) const final;
 	void do_set_statement_attribute(statement_handle const & handle, SQLINTEGER attribute, intptr_t value) const final;
 	void do_set_statement_attribute(statement_handle const & handle, SQLINTEGER attribute, SQLULEN * pointer) const final;
+	void do_set_statement_attribute(statement_handle const & handle, SQLINTEGER attribute, SQLUSMALLINT * pointer) const final;
 	SQLLEN do_row_count(statement_handle const & handle) const final;
 	column_description do_describe_column(statement_handle const & handle, SQLUSMALLINT column_id) const final;
 	column_description do_describe_column_wide(statement_handle const & handle, SQLUSMALLINT column_id) const final;
 	column_description do_describe_parameter(statement_handle const & handle, SQLUSMALLINT parameter_id) const final;
 	bool do_more_results(statement_handle const & handle) const final;
 	bool do_supports_function(connection_handle const & handle, SQLUSMALLINT function_id) const final;
+	bulk_copy_handle do_initialize_bulk_copy(connection_handle const & handle, std::u16string const & table) const final;
+	void do_set_bulk_copy_option(bulk_copy_handle const & handle, int option, intptr_t value) const final;
+	void do_set_bulk_copy_hints(bulk_copy_handle const & handle, std::u16string const & hints) const final;
+	void do_bind_bulk_copy_column(bulk_copy_handle const & handle, int column_id, int data_type) const final;
+	void do_set_bulk_copy_column_data(bulk_copy_handle const & handle, int column_id, void const * data, SQLINTEGER length) const final;
+	void do_send_bulk_copy_row(bulk_copy_handle const & handle) const final;
+	SQLINTEGER do_commit_bulk_copy_batch(bulk_copy_handle const & handle) const final;
+	SQLINTEGER do_finish_bulk_copy(bulk_copy_handle const & handle) const final;
 
 	std::shared_ptr<level1::api const> level1_api_;
 };
@@ -27,8 +27,10 @@ public:
 	 *                    the life time of this object. The environment also contains the level2 API
 	 *                    to which all calls are forwarded.
 	 * @param connection_string The connection is created using this connection string.
+	 * @param attributes These attributes are set before the connection is established.
 	 */
-	raii_connection(std::shared_ptr<raii_environment const> environment, std::string const & connection_string);
+	raii_connection(std::shared_ptr<raii_environment const> environment, std::string const & connection_string,
+	                connection_attributes const & attributes = {});
 
 	/**
 	 * @brief Retrieve the API instance associated with this environment.
@@ -42,7 +42,7 @@ public:
 	virtual ~raii_environment();
 
 private:
-	std::shared_ptr<connection> do_make_connection(std::string const & connection_string) const final;
+	std::shared_ptr<connection> do_make_connection(std::string const & connection_string, connection_attributes const & attributes) const final;
 	void do_set_attribute(SQLINTEGER attribute, intptr_t value) const final;
 
 	struct intern;
@@ -34,16 +34,20 @@ private:
 	intptr_t do_get_integer_attribute(SQLINTEGER attribute) const final;
 	void do_set_attribute(SQLINTEGER attribute, intptr_t value) const final;
 	void do_set_attribute(SQLINTEGER attribute, SQLULEN * pointer) const final;
+	void do_set_attribute(SQLINTEGER attribute, SQLUSMALLINT * pointer) const final;
 	void do_execute(std::string const & sql) const final;
 	void do_prepare(std::string const & sql) const final;
 	void do_prepare(std::u16string const & sql) const final;
 	void do_bind_input_parameter(SQLUSMALLINT parameter_id, SQLSMALLINT value_type, SQLSMALLINT parameter_type, SQLSMALLINT digits, cpp_odbc::multi_value_buffer & parameter_values) const final;
+	void do_bind_numeric_input_parameter(SQLUSMALLINT parameter_id, SQLSMALLINT parameter_type, SQLSMALLINT precision, SQLSMALLINT scale, cpp_odbc::multi_value_buffer & parameter_values) const final;
+	void do_bind_table_input_parameter(SQLUSMALLINT parameter_id, std::u16string const & type_name, SQLULEN maximum_rows, SQLLEN * row_count) const final;
 	void do_unbind_all_parameters() const final;
 	void do_execute_prepared() const final;
 
 	short int do_number_of_columns() const final;
 	short int do_number_of_parameters() const final;
 	void do_bind_column(SQLUSMALLINT column_id, SQLSMALLINT column_type, cpp_odbc::multi_value_buffer & column_buffer) const final;
+	void do_bind_numeric_column(SQLUSMALLINT column_id, SQLSMALLINT precision, SQLSMALLINT scale, cpp_odbc::multi_value_buffer & column_buffer) const final;
 	void do_unbind_all_columns() const final;
 	bool do_fetch_next() const final;
 	void do_close_cursor() const final;
@@ -51,6 +55,7 @@ private:
 	intptr_t do_get_integer_column_attribute(SQLUSMALLINT column_id, SQLUSMALLINT field_identifier) const final;
 	std::string do_get_string_column_attribute(SQLUSMALLINT column_id, SQLUSMALLINT field_identifier) const final;
 	SQLLEN do_row_count() const final;
+	std::vector<level2::row_diagnostic_record> do_get_row_diagnostic_records() const final;
 	column_description do_describe_column(SQLUSMALLINT column_id) const final;
 	column_description do_describe_column_wide(SQLUSMALLINT column_id) const final;
 	column_description do_describe_parameter(SQLUSMALLINT parameter_id) const final;
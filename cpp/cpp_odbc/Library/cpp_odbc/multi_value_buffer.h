@@ -93,10 +93,34 @@ public:
 	 */
 	buffer_element operator[](std::size_t element_index) const;
 
+	/**
+	 * @brief Change the number of elements. Elements which exist in both the old
+	 *        and the new buffer keep their values, additional elements are zeroed.
+	 *        Memory may move, so rebind the buffer after calling this function.
+	 * @param number_of_elements The new number of elements. Must be larger than zero.
+	 */
+	void resize(std::size_t number_of_elements);
+
+	/**
+	 * @brief Let the data array point to memory owned by someone else. The indicator
+	 *        array remains internal. This allows ODBC to write values directly to
+	 *        their final destination. Rebind the buffer after calling this function.
+	 * @param external_data Pointer to a memory region of at least
+	 *        number_of_elements() * capacity_per_element() bytes which must outlive
+	 *        any use of this buffer. Pass nullptr to return to the internal data array.
+	 */
+	void use_external_data(char * external_data);
+
+	/**
+	 * @brief Returns true if the data array currently points to external memory
+	 */
+	bool uses_external_data() const;
+
 private:
 	std::size_t element_size_;
 	std::vector<char> data_;
 	std::vector<intptr_t> indicators_;
+	char * external_data_;
 };
 
 
@@ -0,0 +1,16 @@
+#pragma once
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+#include "sqltypes.h"
+
+namespace cpp_odbc {
+
+/**
+ * @brief SQL Server's type identifier for table-valued parameters, SQL_SS_TABLE
+ *        in msodbcsql.h
+ */
+SQLSMALLINT const sql_ss_table = -153;
+
+}
@@ -2,10 +2,12 @@
 
 #include "cpp_odbc/multi_value_buffer.h"
 #include "cpp_odbc/column_description.h"
+#include "cpp_odbc/level2/diagnostic_record.h"
 
 #include "sql.h"
 
 #include <string>
+#include <vector>
 
 namespace cpp_odbc {
 
@@ -37,6 +39,14 @@ public:
      */
     void set_attribute(SQLINTEGER attribute, SQLULEN * pointer) const;
 
+    /**
+     * @brief Set the pointer of the given statement attribute to an array, e.g.,
+     *        for SQL_ATTR_PARAM_STATUS_PTR or SQL_ATTR_PARAM_OPERATION_PTR
+     * @param attribute A constant representing the requested attribute
+     * @param pointer The new pointer for this attribute
+     */
+    void set_attribute(SQLINTEGER attribute, SQLUSMALLINT * pointer) const;
+
     /**
      * @brief Execute the given SQL string directly without preparing it on the client side.
      * @param sql The SQL query which shall be executed
@@ -59,6 +69,27 @@ public:
      */
     void bind_input_parameter(SQLUSMALLINT parameter_id, SQLSMALLINT value_type, SQLSMALLINT parameter_type, SQLSMALLINT digits, cpp_odbc::multi_value_buffer & parameter_values) const;
 
+    /**
+     * @brief Assign a buffer of SQL_NUMERIC_STRUCT values to a given input parameter.
+     * @param parameter_id The ID of the parameter
+     * @param parameter_type The SQL data type identifier of the buffer. See unixODBC's SQLBindParameter() documentation
+     * @param precision The number of significant digits of the values
+     * @param scale The number of digits right of the decimal point
+     * @param parameter_values The buffer which shall be bound as a parameter
+     */
+    void bind_numeric_input_parameter(SQLUSMALLINT parameter_id, SQLSMALLINT parameter_type, SQLSMALLINT precision, SQLSMALLINT scale, cpp_odbc::multi_value_buffer & parameter_values) const;
+
+    /**
+     * @brief Bind a table-valued parameter (SQL Server's SQL_SS_TABLE). Its
+     *        columns are bound with bind_input_parameter() while the
+     *        SQL_SOPT_SS_PARAM_FOCUS attribute is set to parameter_id.
+     * @param parameter_id The ID of the parameter
+     * @param type_name Name of the table type. Must stay alive until execution.
+     * @param maximum_rows The number of rows the column buffers can hold
+     * @param row_count Holds the number of rows to send when the statement is executed
+     */
+    void bind_table_input_parameter(SQLUSMALLINT parameter_id, std::u16string const & type_name, SQLULEN maximum_rows, SQLLEN * row_count) const;
+
     /**
      * @brief Unbind all parameters currently bound to the statement
      */
@@ -89,6 +120,15 @@ public:
      */
     void bind_column(SQLUSMALLINT column_id, SQLSMALLINT column_type, cpp_odbc::multi_value_buffer & column_buffer) const;
 
+    /**
+     * @brief Bind a buffer of SQL_NUMERIC_STRUCT values to a column of the statement
+     * @param column_id The column identifier with which we want to associate the buffer
+     * @param precision The number of significant digits of the values
+     * @param scale The number of digits right of the decimal point
+     * @param column_buffer A buffer which will be filled with data whenever fetch_scroll() is called.
+     */
+    void bind_numeric_column(SQLUSMALLINT column_id, SQLSMALLINT precision, SQLSMALLINT scale, cpp_odbc::multi_value_buffer & column_buffer) const;
+
     /**
      * @brief Unbind all columns currently bound to the statement
      */
@@ -126,6 +166,12 @@ public:
      */
     SQLLEN row_count() const;
 
+    /**
+     * @brief Retrieve all diagnostic records of the last operation together with
+     *        the rows or parameter sets they refer to
+     */
+    std::vector<level2::row_diagnostic_record> get_row_diagnostic_records() const;
+
     /**
      * @brief Retrieve the description of a column
      * @param column_id The column identifier
@@ -169,16 +215,20 @@ private:
     virtual intptr_t do_get_integer_attribute(SQLINTEGER attribute) const = 0;
     virtual void do_set_attribute(SQLINTEGER attribute, intptr_t value) const = 0;
     virtual void do_set_attribute(SQLINTEGER attribute, SQLULEN * pointer) const = 0;
+    virtual void do_set_attribute(SQLINTEGER attribute, SQLUSMALLINT * pointer) const = 0;
     virtual void do_execute(std::string const & sql) const = 0;
     virtual void do_prepare(std::string const & sql) const = 0;
     virtual void do_prepare(std::u16string const & sql) const = 0;
     virtual void do_bind_input_parameter(SQLUSMALLINT parameter_id, SQLSMALLINT value_type, SQLSMALLINT parameter_type, SQLSMALLINT digits, cpp_odbc::multi_value_buffer & parameter_values) const = 0;
+    virtual void do_bind_numeric_input_parameter(SQLUSMALLINT parameter_id, SQLSMALLINT parameter_type, SQLSMALLINT precision, SQLSMALLINT scale, cpp_odbc::multi_value_buffer & parameter_values) const = 0;
+    virtual void do_bind_table_input_parameter(SQLUSMALLINT parameter_id, std::u16string const & type_name, SQLULEN maximum_rows, SQLLEN * row_count) const = 0;
     virtual void do_unbind_all_parameters() const = 0;
     virtual void do_execute_prepared() const = 0;
 
     virtual short int do_number_of_columns() const = 0;
     virtual short int do_number_of_parameters() const = 0;
     virtual void do_bind_column(SQLUSMALLINT column_id, SQLSMALLINT column_type, cpp_odbc::multi_value_buffer & column_buffer) const = 0;
+    virtual void do_bind_numeric_column(SQLUSMALLINT column_id, SQLSMALLINT precision, SQLSMALLINT scale, cpp_odbc::multi_value_buffer & column_buffer) const = 0;
     virtual void do_unbind_all_columns() const = 0;
     virtual bool do_fetch_next() const = 0;
     virtual void do_close_cursor() const = 0;
@@ -186,6 +236,7 @@ private:
     virtual intptr_t do_get_integer_column_attribute(SQLUSMALLINT column_id, SQLUSMALLINT field_identifier) const = 0;
     virtual std::string do_get_string_column_attribute(SQLUSMALLINT column_id, SQLUSMALLINT field_identifier) const = 0;
     virtual SQLLEN do_row_count() const = 0;
+    virtual std::vector<level2::row_diagnostic_record> do_get_row_diagnostic_records() const = 0;
     virtual column_description do_describe_column(SQLUSMALLINT column_id) const = 0;
     virtual column_description do_describe_column_wide(SQLUSMALLINT column_id) const = 0;
     virtual column_description do_describe_parameter(SQLUSMALLINT parameter_id) const = 0;
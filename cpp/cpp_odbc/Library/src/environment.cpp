@@ -7,7 +7,12 @@ environment::~environment() = default;
 
 std::shared_ptr<connection> environment::make_connection(std::string const & connection_string) const
 {
-	return do_make_connection(connection_string);
+	return do_make_connection(connection_string, {});
+}
+
+std::shared_ptr<connection> environment::make_connection(std::string const & connection_string, connection_attributes const & attributes) const
+{
+	return do_make_connection(connection_string, attributes);
 }
 
 void environment::set_attribute(SQLINTEGER attribute, intptr_t value) const
@@ -20,6 +20,11 @@ SQLRETURN api::get_diagnostic_record(SQLSMALLINT handle_type, SQLHANDLE handle,
     return do_get_diagnostic_record(handle_type, handle, record_id, status_code_ptr, native_error_ptr, message_text, buffer_length, text_length_ptr);
 }
 
+SQLRETURN api::get_diagnostic_field(SQLSMALLINT handle_type, SQLHANDLE handle, SQLSMALLINT record_id, SQLSMALLINT diagnostic_id, SQLPOINTER diagnostic_info_ptr, SQLSMALLINT buffer_length, SQLSMALLINT * string_length_ptr) const
+{
+    return do_get_diagnostic_field(handle_type, handle, record_id, diagnostic_id, diagnostic_info_ptr, buffer_length, string_length_ptr);
+}
+
 SQLRETURN api::set_environment_attribute(SQLHENV environment_handle, SQLINTEGER attribute, SQLPOINTER value_ptr, SQLINTEGER string_length) const
 {
     return do_set_environment_attribute(environment_handle, attribute, value_ptr, string_length);
@@ -145,6 +150,51 @@ SQLRETURN api::get_functions(SQLHDBC connection_handle, SQLUSMALLINT function_id
     return do_get_functions(connection_handle, function_id, is_supported);
 }
 
+SQLRETURN api::set_descriptor_field(SQLHDESC descriptor_handle, SQLSMALLINT record_number, SQLSMALLINT field_identifier, SQLPOINTER value_ptr, SQLINTEGER buffer_length) const
+{
+    return do_set_descriptor_field(descriptor_handle, record_number, field_identifier, value_ptr, buffer_length);
+}
+
+int api::bulk_copy_init(SQLHDBC connection_handle, SQLWCHAR const * table_name, SQLWCHAR const * data_file, SQLWCHAR const * error_file, int direction) const
+{
+    return do_bulk_copy_init(connection_handle, table_name, data_file, error_file, direction);
+}
+
+int api::bulk_copy_control(SQLHDBC connection_handle, int option, void * value) const
+{
+    return do_bulk_copy_control(connection_handle, option, value);
+}
+
+int api::bulk_copy_bind(SQLHDBC connection_handle, unsigned char const * data, int indicator_length, SQLINTEGER data_length, unsigned char const * terminator, int terminator_length, int data_type, int column) const
+{
+    return do_bulk_copy_bind(connection_handle, data, indicator_length, data_length, terminator, terminator_length, data_type, column);
+}
+
+int api::bulk_copy_column_pointer(SQLHDBC connection_handle, unsigned char const * data, int column) const
+{
+    return do_bulk_copy_column_pointer(connection_handle, data, column);
+}
+
+int api::bulk_copy_column_length(SQLHDBC connection_handle, SQLINTEGER data_length, int column) const
+{
+    return do_bulk_copy_column_length(connection_handle, data_length, column);
+}
+
+int api::bulk_copy_send_row(SQLHDBC connection_handle) const
+{
+    return do_bulk_copy_send_row(connection_handle);
+}
+
+SQLINTEGER api::bulk_copy_batch(SQLHDBC connection_handle) const
+{
+    return do_bulk_copy_batch(connection_handle);
+}
+
+SQLINTEGER api::bulk_copy_done(SQLHDBC connection_handle) const
+{
+    return do_bulk_copy_done(connection_handle);
+}
+
 
 
 } }
@@ -0,0 +1,131 @@
+#include "cpp_odbc/level1/bulk_copy_functions.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#ifdef __APPLE__
+#include <mach-o/dyld.h>
+#else
+#include <link.h>
+#endif
+#endif
+
+#include <atomic>
+#include <ciso646>
+#include <cstring>
+#include <mutex>
+#include <string>
+
+namespace {
+
+    char const driver_library_name[] = "msodbcsql";
+
+#ifdef _WIN32
+    using library_handle = HMODULE;
+
+    library_handle find_driver_library()
+    {
+        for (auto name : {"msodbcsql18.dll", "msodbcsql17.dll", "msodbcsql13.dll"}) {
+            if (auto library = GetModuleHandleA(name)) {
+                return library;
+            }
+        }
+        return nullptr;
+    }
+
+    void * find_symbol(library_handle library, char const * name)
+    {
+        return reinterpret_cast<void *>(GetProcAddress(library, name));
+    }
+#else
+    using library_handle = void *;
+
+    std::string find_driver_library_path()
+    {
+#ifdef __APPLE__
+        for (uint32_t i = 0; i != _dyld_image_count(); ++i) {
+            auto const path = _dyld_get_image_name(i);
+            if ((path != nullptr) and (std::strstr(path, driver_library_name) != nullptr)) {
+                return path;
+            }
+        }
+        return {};
+#else
+        std::string path;
+        dl_iterate_phdr([](dl_phdr_info * info, size_t, void * data) {
+            if ((info->dlpi_name != nullptr) and (std::strstr(info->dlpi_name, driver_library_name) != nullptr)) {
+                *static_cast<std::string *>(data) = info->dlpi_name;
+                return 1;
+            }
+            return 0;
+        }, &path);
+        return path;
+#endif
+    }
+
+    library_handle find_driver_library()
+    {
+        // the driver manager loads drivers with local symbol visibility, so ask for
+        // the already loaded library instead of relying on the global namespace
+        auto const path = find_driver_library_path();
+        if (path.empty()) {
+            return RTLD_DEFAULT;
+        }
+        // the handle is deliberately leaked to pin the library while pointers are cached
+        auto const library = dlopen(path.c_str(), RTLD_LAZY | RTLD_NOLOAD);
+        return (library != nullptr) ? library : RTLD_DEFAULT;
+    }
+
+    void * find_symbol(library_handle library, char const * name)
+    {
+        return dlsym(library, name);
+    }
+#endif
+
+    template <typename Function>
+    bool resolve(library_handle library, char const * name, Function & function)
+    {
+        function = reinterpret_cast<Function>(find_symbol(library, name));
+        return function != nullptr;
+    }
+
+    bool resolve(cpp_odbc::level1::bulk_copy_functions & functions)
+    {
+        auto const library = find_driver_library();
+        if (library == nullptr) {
+            return false;
+        }
+        return resolve(library, "bcp_initW", functions.init)
+            and resolve(library, "bcp_control", functions.control)
+            and resolve(library, "bcp_bind", functions.bind)
+            and resolve(library, "bcp_colptr", functions.column_pointer)
+            and resolve(library, "bcp_collen", functions.column_length)
+            and resolve(library, "bcp_sendrow", functions.send_row)
+            and resolve(library, "bcp_batch", functions.batch)
+            and resolve(library, "bcp_done", functions.done);
+    }
+
+}
+
+namespace cpp_odbc { namespace level1 {
+
+bulk_copy_functions const * get_bulk_copy_functions()
+{
+    static std::atomic<bool> resolved(false);
+    static std::mutex resolve_mutex;
+    static bulk_copy_functions functions;
+
+    if (not resolved.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> guard(resolve_mutex);
+        if (not resolved.load(std::memory_order_relaxed)) {
+            if (not resolve(functions)) {
+                return nullptr;
+            }
+            resolved.store(true, std::memory_order_release);
+        }
+    }
+    return &functions;
+}
+
+} }
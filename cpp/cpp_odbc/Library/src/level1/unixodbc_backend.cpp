@@ -1,4 +1,5 @@
 #include "cpp_odbc/level1/unixodbc_backend.h"
+#include "cpp_odbc/level1/bulk_copy_functions.h"
 #include "sql.h"
 #include "sqlext.h"
 
@@ -19,6 +20,11 @@ SQLRETURN unixodbc_backend::do_get_diagnostic_record(SQLSMALLINT handle_type, SQ
     return SQLGetDiagRec(handle_type, handle, record_id, status_code_ptr, native_error_ptr, message_text, buffer_length, text_length_ptr);
 }
 
+SQLRETURN unixodbc_backend::do_get_diagnostic_field(SQLSMALLINT handle_type, SQLHANDLE handle, SQLSMALLINT record_id, SQLSMALLINT diagnostic_id, SQLPOINTER diagnostic_info_ptr, SQLSMALLINT buffer_length, SQLSMALLINT * string_length_ptr) const
+{
+    return SQLGetDiagField(handle_type, handle, record_id, diagnostic_id, diagnostic_info_ptr, buffer_length, string_length_ptr);
+}
+
 SQLRETURN unixodbc_backend::do_set_environment_attribute(SQLHENV environment_handle, SQLINTEGER attribute, SQLPOINTER value_ptr, SQLINTEGER string_length) const
 {
     return SQLSetEnvAttr(environment_handle, attribute, value_ptr, string_length);
@@ -144,4 +150,57 @@ SQLRETURN unixodbc_backend::do_get_functions(SQLHDBC connection_handle, SQLUSMAL
     return SQLGetFunctions(connection_handle, function_id, is_supported);
 }
 
+SQLRETURN unixodbc_backend::do_set_descriptor_field(SQLHDESC descriptor_handle, SQLSMALLINT record_number, SQLSMALLINT field_identifier, SQLPOINTER value_ptr, SQLINTEGER buffer_length) const
+{
+    return SQLSetDescField(descriptor_handle, record_number, field_identifier, value_ptr, buffer_length);
+}
+
+int unixodbc_backend::do_bulk_copy_init(SQLHDBC connection_handle, SQLWCHAR const * table_name, SQLWCHAR const * data_file, SQLWCHAR const * error_file, int direction) const
+{
+    auto const functions = get_bulk_copy_functions();
+    return (functions != nullptr) ? functions->init(connection_handle, table_name, data_file, error_file, direction) : 0;
+}
+
+int unixodbc_backend::do_bulk_copy_control(SQLHDBC connection_handle, int option, void * value) const
+{
+    auto const functions = get_bulk_copy_functions();
+    return (functions != nullptr) ? functions->control(connection_handle, option, value) : 0;
+}
+
+int unixodbc_backend::do_bulk_copy_bind(SQLHDBC connection_handle, unsigned char const * data, int indicator_length, SQLINTEGER data_length, unsigned char const * terminator, int terminator_length, int data_type, int column) const
+{
+    auto const functions = get_bulk_copy_functions();
+    return (functions != nullptr) ? functions->bind(connection_handle, data, indicator_length, data_length, terminator, terminator_length, data_type, column) : 0;
+}
+
+int unixodbc_backend::do_bulk_copy_column_pointer(SQLHDBC connection_handle, unsigned char const * data, int column) const
+{
+    auto const functions = get_bulk_copy_functions();
+    return (functions != nullptr) ? functions->column_pointer(connection_handle, data, column) : 0;
+}
+
+int unixodbc_backend::do_bulk_copy_column_length(SQLHDBC connection_handle, SQLINTEGER data_length, int column) const
+{
+    auto const functions = get_bulk_copy_functions();
+    return (functions != nullptr) ? functions->column_length(connection_handle, data_length, column) : 0;
+}
+
+int unixodbc_backend::do_bulk_copy_send_row(SQLHDBC connection_handle) const
+{
+    auto const functions = get_bulk_copy_functions();
+    return (functions != nullptr) ? functions->send_row(connection_handle) : 0;
+}
+
+SQLINTEGER unixodbc_backend::do_bulk_copy_batch(SQLHDBC connection_handle) const
+{
+    auto const functions = get_bulk_copy_functions();
+    return (functions != nullptr) ? functions->batch(connection_handle) : -1;
+}
+
+SQLINTEGER unixodbc_backend::do_bulk_copy_done(SQLHDBC connection_handle) const
+{
+    auto const functions = get_bulk_copy_functions();
+    return (functions != nullptr) ? functions->done(connection_handle) : -1;
+}
+
 } }
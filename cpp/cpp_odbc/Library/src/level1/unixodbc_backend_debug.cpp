@@ -1,4 +1,5 @@
 #include "cpp_odbc/level1/unixodbc_backend_debug.h"
+#include "cpp_odbc/level1/bulk_copy_functions.h"
 #include "sql.h"
 #include "sqlext.h"
 #include <iostream>
@@ -29,6 +30,14 @@ SQLRETURN unixodbc_backend_debug::do_get_diagnostic_record(SQLSMALLINT handle_ty
     return return_code;
 }
 
+SQLRETURN unixodbc_backend_debug::do_get_diagnostic_field(SQLSMALLINT handle_type, SQLHANDLE handle, SQLSMALLINT record_id, SQLSMALLINT diagnostic_id, SQLPOINTER diagnostic_info_ptr, SQLSMALLINT buffer_length, SQLSMALLINT * string_length_ptr) const
+{
+    std::cout << " *DEBUG* get_diagnostic_field (handle_type = " << handle_type << ", diagnostic_id = " << diagnostic_id << ")";
+    auto const return_code = SQLGetDiagField(handle_type, handle, record_id, diagnostic_id, diagnostic_info_ptr, buffer_length, string_length_ptr);
+    std::cout << " (return code " << return_code << ")" << std::endl;
+    return return_code;
+}
+
 SQLRETURN unixodbc_backend_debug::do_set_environment_attribute(SQLHENV environment_handle, SQLINTEGER attribute, SQLPOINTER value_ptr, SQLINTEGER string_length) const
 {
     std::cout << " *DEBUG* set_environment_attribute";
@@ -229,7 +238,84 @@ SQLRETURN unixodbc_backend_debug::do_get_functions(SQLHDBC connection_handle, SQ
     return return_code;
 }
 
+SQLRETURN unixodbc_backend_debug::do_set_descriptor_field(SQLHDESC descriptor_handle, SQLSMALLINT record_number, SQLSMALLINT field_identifier, SQLPOINTER value_ptr, SQLINTEGER buffer_length) const
+{
+    std::cout << " *DEBUG* set_descriptor_field";
+    auto const return_code = SQLSetDescField(descriptor_handle, record_number, field_identifier, value_ptr, buffer_length);
+    std::cout << " (return code " << return_code << ")" << std::endl;
+    return return_code;
+}
+
+int unixodbc_backend_debug::do_bulk_copy_init(SQLHDBC connection_handle, SQLWCHAR const * table_name, SQLWCHAR const * data_file, SQLWCHAR const * error_file, int direction) const
+{
+    std::cout << " *DEBUG* bulk_copy_init";
+    auto const functions = get_bulk_copy_functions();
+    auto const return_code = (functions != nullptr) ? functions->init(connection_handle, table_name, data_file, error_file, direction) : 0;
+    std::cout << " (return code " << return_code << ")" << std::endl;
+    return return_code;
+}
+
+int unixodbc_backend_debug::do_bulk_copy_control(SQLHDBC connection_handle, int option, void * value) const
+{
+    std::cout << " *DEBUG* bulk_copy_control";
+    auto const functions = get_bulk_copy_functions();
+    auto const return_code = (functions != nullptr) ? functions->control(connection_handle, option, value) : 0;
+    std::cout << " (return code " << return_code << ")" << std::endl;
+    return return_code;
+}
 
+int unixodbc_backend_debug::do_bulk_copy_bind(SQLHDBC connection_handle, unsigned char const * data, int indicator_length, SQLINTEGER data_length, unsigned char const * terminator, int terminator_length, int data_type, int column) const
+{
+    std::cout << " *DEBUG* bulk_copy_bind";
+    auto const functions = get_bulk_copy_functions();
+    auto const return_code = (functions != nullptr) ? functions->bind(connection_handle, data, indicator_length, data_length, terminator, terminator_length, data_type, column) : 0;
+    std::cout << " (return code " << return_code << ")" << std::endl;
+    return return_code;
+}
 
+int unixodbc_backend_debug::do_bulk_copy_column_pointer(SQLHDBC connection_handle, unsigned char const * data, int column) const
+{
+    std::cout << " *DEBUG* bulk_copy_column_pointer";
+    auto const functions = get_bulk_copy_functions();
+    auto const return_code = (functions != nullptr) ? functions->column_pointer(connection_handle, data, column) : 0;
+    std::cout << " (return code " << return_code << ")" << std::endl;
+    return return_code;
+}
+
+int unixodbc_backend_debug::do_bulk_copy_column_length(SQLHDBC connection_handle, SQLINTEGER data_length, int column) const
+{
+    std::cout << " *DEBUG* bulk_copy_column_length";
+    auto const functions = get_bulk_copy_functions();
+    auto const return_code = (functions != nullptr) ? functions->column_length(connection_handle, data_length, column) : 0;
+    std::cout << " (return code " << return_code << ")" << std::endl;
+    return return_code;
+}
+
+int unixodbc_backend_debug::do_bulk_copy_send_row(SQLHDBC connection_handle) const
+{
+    std::cout << " *DEBUG* bulk_copy_send_row";
+    auto const functions = get_bulk_copy_functions();
+    auto const return_code = (functions != nullptr) ? functions->send_row(connection_handle) : 0;
+    std::cout << " (return code " << return_code << ")" << std::endl;
+    return return_code;
+}
+
+SQLINTEGER unixodbc_backend_debug::do_bulk_copy_batch(SQLHDBC connection_handle) const
+{
+    std::cout << " *DEBUG* bulk_copy_batch";
+    auto const functions = get_bulk_copy_functions();
+    auto const return_code = (functions != nullptr) ? functions->batch(connection_handle) : -1;
+    std::cout << " (return code " << return_code << ")" << std::endl;
+    return return_code;
+}
+
+SQLINTEGER unixodbc_backend_debug::do_bulk_copy_done(SQLHDBC connection_handle) const
+{
+    std::cout << " *DEBUG* bulk_copy_done";
+    auto const functions = get_bulk_copy_functions();
+    auto const return_code = (functions != nullptr) ? functions->done(connection_handle) : -1;
+    std::cout << " (return code " << return_code << ")" << std::endl;
+    return return_code;
+}
 
 } }
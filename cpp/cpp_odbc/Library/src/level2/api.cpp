@@ -50,6 +50,11 @@ diagnostic_record api::get_diagnostic_record(environment_handle const & handle)
     return do_get_diagnostic_record(handle);
 }
 
+std::vector<row_diagnostic_record> api::get_row_diagnostic_records(statement_handle const & handle) const
+{
+    return do_get_row_diagnostic_records(handle);
+}
+
 void api::set_environment_attribute(environment_handle const & handle, SQLINTEGER attribute, intptr_t value) const
 {
     do_set_environment_attribute(handle, attribute, value);
@@ -95,6 +100,21 @@ void api::bind_input_parameter(statement_handle const & handle, SQLUSMALLINT par
     do_bind_input_parameter(handle, parameter_id, value_type, parameter_type, digits, parameter_values);
 }
 
+void api::bind_numeric_column(statement_handle const & handle, SQLUSMALLINT column_id, SQLSMALLINT precision, SQLSMALLINT scale, multi_value_buffer & column_buffer) const
+{
+    do_bind_numeric_column(handle, column_id, precision, scale, column_buffer);
+}
+
+void api::bind_numeric_input_parameter(statement_handle const & handle, SQLUSMALLINT parameter_id, SQLSMALLINT parameter_type, SQLSMALLINT precision, SQLSMALLINT scale, multi_value_buffer & parameter_values) const
+{
+    do_bind_numeric_input_parameter(handle, parameter_id, parameter_type, precision, scale, parameter_values);
+}
+
+void api::bind_table_input_parameter(statement_handle const & handle, SQLUSMALLINT parameter_id, std::u16string const & type_name, SQLULEN maximum_rows, SQLLEN * row_count) const
+{
+    do_bind_table_input_parameter(handle, parameter_id, type_name, maximum_rows, row_count);
+}
+
 void api::execute_prepared_statement(statement_handle const & handle) const
 {
     do_execute_prepared_statement(handle);
@@ -160,6 +180,11 @@ void api::set_statement_attribute(statement_handle const & handle, SQLINTEGER at
     do_set_statement_attribute(handle, attribute, pointer);
 }
 
+void api::set_statement_attribute(statement_handle const & handle, SQLINTEGER attribute, SQLUSMALLINT * pointer) const
+{
+    do_set_statement_attribute(handle, attribute, pointer);
+}
+
 SQLLEN api::row_count(statement_handle const & handle) const
 {
     return do_row_count(handle);
@@ -190,5 +215,45 @@ bool api::supports_function(connection_handle const & handle, SQLUSMALLINT funct
     return do_supports_function(handle, function_id);
 }
 
+bulk_copy_handle api::initialize_bulk_copy(connection_handle const & handle, std::u16string const & table) const
+{
+    return do_initialize_bulk_copy(handle, table);
+}
+
+void api::set_bulk_copy_option(bulk_copy_handle const & handle, int option, intptr_t value) const
+{
+    do_set_bulk_copy_option(handle, option, value);
+}
+
+void api::set_bulk_copy_hints(bulk_copy_handle const & handle, std::u16string const & hints) const
+{
+    do_set_bulk_copy_hints(handle, hints);
+}
+
+void api::bind_bulk_copy_column(bulk_copy_handle const & handle, int column_id, int data_type) const
+{
+    do_bind_bulk_copy_column(handle, column_id, data_type);
+}
+
+void api::set_bulk_copy_column_data(bulk_copy_handle const & handle, int column_id, void const * data, SQLINTEGER length) const
+{
+    do_set_bulk_copy_column_data(handle, column_id, data, length);
+}
+
+void api::send_bulk_copy_row(bulk_copy_handle const & handle) const
+{
+    do_send_bulk_copy_row(handle);
+}
+
+SQLINTEGER api::commit_bulk_copy_batch(bulk_copy_handle const & handle) const
+{
+    return do_commit_bulk_copy_batch(handle);
+}
+
+SQLINTEGER api::finish_bulk_copy(bulk_copy_handle const & handle) const
+{
+    return do_finish_bulk_copy(handle);
+}
+
 
 } }
@@ -63,4 +63,14 @@ bool statement_handle::operator!=(statement_handle const & other) const
 	return handle != other.handle;
 }
 
+bool bulk_copy_handle::operator==(bulk_copy_handle const & other) const
+{
+	return handle == other.handle;
+}
+
+bool bulk_copy_handle::operator!=(bulk_copy_handle const & other) const
+{
+	return handle != other.handle;
+}
+
 } }
@@ -8,6 +8,7 @@
 #include "cpp_odbc/level2/u16string_buffer.h"
 
 #include "cpp_odbc/error.h"
+#include "cpp_odbc/sql_server_types.h"
 
 #ifdef _WIN32
 #include <windows.h>
@@ -19,6 +20,7 @@
 #include <sstream>
 #include <iostream>
 #include <ciso646>
+#include <utility>
 
 namespace impl {
 
@@ -88,6 +90,100 @@ cpp_odbc::level2::diagnostic_record get_diagnostic_record(
     }
 }
 
+std::vector<cpp_odbc::level2::row_diagnostic_record> get_row_diagnostic_records(
+    cpp_odbc::level1::api const & api,
+    signed short int type,
+    void * handle
+)
+{
+    std::vector<cpp_odbc::level2::row_diagnostic_record> records;
+    for (SQLSMALLINT record_id = 1; ; ++record_id) {
+        cpp_odbc::level2::fixed_length_string_buffer<5> status_code;
+        SQLINTEGER native_error = 0;
+        cpp_odbc::level2::string_buffer message(SQL_MAX_MESSAGE_LENGTH);
+
+        auto const return_code = api.get_diagnostic_record(type, handle, record_id, status_code.data_pointer(), &native_error, message.data_pointer(), message.capacity(), message.size_pointer());
+        // SQL_NO_DATA marks the end of the records; truncated messages are fine
+        if ((return_code != SQL_SUCCESS) and (return_code != SQL_SUCCESS_WITH_INFO)) {
+            return records;
+        }
+
+        SQLLEN row_number = SQL_ROW_NUMBER_UNKNOWN;
+        if (api.get_diagnostic_field(type, handle, record_id, SQL_DIAG_ROW_NUMBER, &row_number, 0, nullptr) != SQL_SUCCESS) {
+            row_number = SQL_ROW_NUMBER_UNKNOWN;
+        }
+        records.push_back({row_number, {status_code, native_error, message}});
+    }
+}
+
+// constants of the bulk copy API as defined in msodbcsql.h
+int const bulk_copy_succeeded = 1;
+int const bulk_copy_direction_in = 1;
+int const bulk_copy_hints_option = 11;      // BCPHINTSW
+SQLINTEGER const bulk_copy_variable_length = -10;    // SQL_VARLEN_DATA
+
+void throw_bulk_copy_error(
+    cpp_odbc::level1::api const & level1,
+    cpp_odbc::level2::connection_handle const & handle,
+    std::string const & function_name
+)
+{
+    cpp_odbc::level2::fixed_length_string_buffer<5> status_code;
+    SQLINTEGER native_error = 0;
+    cpp_odbc::level2::string_buffer message(SQL_MAX_MESSAGE_LENGTH);
+
+    auto const return_code = level1.get_diagnostic_record(handle.type(), handle.handle, 1, status_code.data_pointer(), &native_error, message.data_pointer(), message.capacity(), message.size_pointer());
+
+    if (return_code == SQL_SUCCESS) {
+        throw cpp_odbc::error(cpp_odbc::level2::diagnostic_record{status_code, native_error, message});
+    } else {
+        // missing bcp_* functions leave no diagnostics behind
+        throw cpp_odbc::error(function_name + " failed. Bulk copy requires the Microsoft ODBC Driver for SQL Server "
+                              "and a connection established with SQL_COPT_SS_BCP enabled");
+    }
+}
+
+void throw_on_bulk_copy_failure(
+    int return_code,
+    cpp_odbc::level1::api const & level1,
+    cpp_odbc::level2::bulk_copy_handle const & handle,
+    char const * function_name
+)
+{
+    if (return_code != bulk_copy_succeeded) {
+        throw_bulk_copy_error(level1, handle.connection, function_name);
+    }
+}
+
+void set_numeric_descriptor_fields(
+    cpp_odbc::level1::api const & level1,
+    cpp_odbc::level2::level1_connector const & level2,
+    cpp_odbc::level2::statement_handle const & handle,
+    SQLINTEGER descriptor_attribute,
+    SQLUSMALLINT record_id,
+    SQLSMALLINT precision,
+    SQLSMALLINT scale,
+    SQLPOINTER data
+)
+{
+    SQLHDESC descriptor = nullptr;
+    auto const return_code = level1.get_statement_attribute(handle.handle, descriptor_attribute, &descriptor, 0, nullptr);
+    throw_on_error(return_code, level2, handle);
+
+    // Setting any field but the data pointer unbinds the record, so the data pointer goes last
+    std::pair<SQLSMALLINT, SQLPOINTER> const fields[] = {
+        {SQL_DESC_TYPE, reinterpret_cast<SQLPOINTER>(static_cast<intptr_t>(SQL_C_NUMERIC))},
+        {SQL_DESC_PRECISION, reinterpret_cast<SQLPOINTER>(static_cast<intptr_t>(precision))},
+        {SQL_DESC_SCALE, reinterpret_cast<SQLPOINTER>(static_cast<intptr_t>(scale))},
+        {SQL_DESC_DATA_PTR, data}
+    };
+    for (auto const & field : fields) {
+        if (level1.set_descriptor_field(descriptor, record_id, field.first, field.second, 0) == SQL_ERROR) {
+            throw cpp_odbc::error(get_diagnostic_record(level1, SQL_HANDLE_DESC, descriptor));
+        }
+    }
+}
+
 }
 
 namespace cpp_odbc { namespace level2 {
@@ -150,6 +246,11 @@ diagnostic_record level1_connector::do_get_diagnostic_record(environment_handle
     return impl::get_diagnostic_record(*level1_api_, handle.type(), handle.handle);
 }
 
+std::vector<row_diagnostic_record> level1_connector::do_get_row_diagnostic_records(statement_handle const & handle) const
+{
+    return impl::get_row_diagnostic_records(*level1_api_, handle.type(), handle.handle);
+}
+
 void level1_connector::do_set_environment_attribute(environment_handle const & handle, SQLINTEGER attribute, intptr_t value) const
 {
     // ODBC's interface transfers integer values disguised as a pointer.
@@ -260,6 +361,50 @@ void level1_connector::do_bind_input_parameter(statement_handle const & handle,
     impl::throw_on_error(return_code, *this, handle);
 }
 
+void level1_connector::do_bind_numeric_column(statement_handle const & handle, SQLUSMALLINT column_id, SQLSMALLINT precision, SQLSMALLINT scale, multi_value_buffer & column_buffer) const
+{
+    do_bind_column(handle, column_id, SQL_C_NUMERIC, column_buffer);
+    impl::set_numeric_descriptor_fields(*level1_api_, *this, handle, SQL_ATTR_APP_ROW_DESC, column_id, precision, scale, column_buffer.data_pointer());
+}
+
+void level1_connector::do_bind_numeric_input_parameter(statement_handle const & handle, SQLUSMALLINT parameter_id, SQLSMALLINT parameter_type, SQLSMALLINT precision, SQLSMALLINT scale, multi_value_buffer & parameter_values) const
+{
+    auto const return_code = level1_api_->bind_parameter(
+        handle.handle,
+        parameter_id,
+        SQL_PARAM_INPUT,
+        SQL_C_NUMERIC,
+        parameter_type,
+        precision,
+        scale,
+        parameter_values.data_pointer(),
+        parameter_values.capacity_per_element(),
+        parameter_values.indicator_pointer()
+    );
+
+    impl::throw_on_error(return_code, *this, handle);
+    impl::set_numeric_descriptor_fields(*level1_api_, *this, handle, SQL_ATTR_APP_PARAM_DESC, parameter_id, precision, scale, parameter_values.data_pointer());
+}
+
+void level1_connector::do_bind_table_input_parameter(statement_handle const & handle, SQLUSMALLINT parameter_id, std::u16string const & type_name, SQLULEN maximum_rows, SQLLEN * row_count) const
+{
+    // The driver reads the type name on execution, so it is not copied to a temporary buffer
+    auto const return_code = level1_api_->bind_parameter(
+        handle.handle,
+        parameter_id,
+        SQL_PARAM_INPUT,
+        SQL_C_DEFAULT,
+        cpp_odbc::sql_ss_table,
+        maximum_rows,
+        0,
+        const_cast<char16_t *>(type_name.c_str()),
+        SQL_NTS,
+        row_count
+    );
+
+    impl::throw_on_error(return_code, *this, handle);
+}
+
 void level1_connector::do_execute_prepared_statement(statement_handle const & handle) const
 {
     auto const return_code = level1_api_->execute_prepared_statement(handle.handle);
@@ -389,6 +534,12 @@ void level1_connector::do_set_statement_attribute(statement_handle const & handl
     impl::throw_on_error(return_code, *this, handle);
 }
 
+void level1_connector::do_set_statement_attribute(statement_handle const & handle, SQLINTEGER attribute, SQLUSMALLINT * pointer) const
+{
+    auto const return_code = level1_api_->set_statement_attribute(handle.handle, attribute, pointer, SQL_IS_POINTER);
+    impl::throw_on_error(return_code, *this, handle);
+}
+
 SQLLEN level1_connector::do_row_count(statement_handle const & handle) const
 {
     SQLLEN count = 0;
@@ -467,4 +618,70 @@ bool level1_connector::do_supports_function(connection_handle const & handle, SQ
     return (is_supported == SQL_TRUE);
 }
 
+bulk_copy_handle level1_connector::do_initialize_bulk_copy(connection_handle const & handle, std::u16string const & table) const
+{
+    SQLHDBC driver_handle = nullptr;
+    auto const return_code = level1_api_->get_connection_info(handle.handle, SQL_DRIVER_HDBC, &driver_handle, sizeof(driver_handle), nullptr);
+    impl::throw_on_error(return_code, *this, handle);
+
+    bulk_copy_handle const bulk_copy = {driver_handle, handle};
+    auto const init_code = level1_api_->bulk_copy_init(driver_handle, reinterpret_cast<SQLWCHAR const *>(table.c_str()), nullptr, nullptr, impl::bulk_copy_direction_in);
+    impl::throw_on_bulk_copy_failure(init_code, *level1_api_, bulk_copy, "bcp_init");
+    return bulk_copy;
+}
+
+void level1_connector::do_set_bulk_copy_option(bulk_copy_handle const & handle, int option, intptr_t value) const
+{
+    auto const return_code = level1_api_->bulk_copy_control(handle.handle, option, reinterpret_cast<void *>(value));
+    impl::throw_on_bulk_copy_failure(return_code, *level1_api_, handle, "bcp_control");
+}
+
+void level1_connector::do_set_bulk_copy_hints(bulk_copy_handle const & handle, std::u16string const & hints) const
+{
+    auto const value = const_cast<char16_t *>(hints.c_str()); // damn C API
+    auto const return_code = level1_api_->bulk_copy_control(handle.handle, impl::bulk_copy_hints_option, value);
+    impl::throw_on_bulk_copy_failure(return_code, *level1_api_, handle, "bcp_control");
+}
+
+void level1_connector::do_bind_bulk_copy_column(bulk_copy_handle const & handle, int column_id, int data_type) const
+{
+    // bcp_bind() interprets a null data pointer as values sent in chunks with bcp_moretext(),
+    // so bind a placeholder which is replaced by bcp_colptr() for each row
+    static unsigned char const placeholder = 0;
+    auto const return_code = level1_api_->bulk_copy_bind(handle.handle, &placeholder, 0, impl::bulk_copy_variable_length, nullptr, 0, data_type, column_id);
+    impl::throw_on_bulk_copy_failure(return_code, *level1_api_, handle, "bcp_bind");
+}
+
+void level1_connector::do_set_bulk_copy_column_data(bulk_copy_handle const & handle, int column_id, void const * data, SQLINTEGER length) const
+{
+    auto const pointer_code = level1_api_->bulk_copy_column_pointer(handle.handle, static_cast<unsigned char const *>(data), column_id);
+    impl::throw_on_bulk_copy_failure(pointer_code, *level1_api_, handle, "bcp_colptr");
+    auto const length_code = level1_api_->bulk_copy_column_length(handle.handle, length, column_id);
+    impl::throw_on_bulk_copy_failure(length_code, *level1_api_, handle, "bcp_collen");
+}
+
+void level1_connector::do_send_bulk_copy_row(bulk_copy_handle const & handle) const
+{
+    auto const return_code = level1_api_->bulk_copy_send_row(handle.handle);
+    impl::throw_on_bulk_copy_failure(return_code, *level1_api_, handle, "bcp_sendrow");
+}
+
+SQLINTEGER level1_connector::do_commit_bulk_copy_batch(bulk_copy_handle const & handle) const
+{
+    auto const committed_rows = level1_api_->bulk_copy_batch(handle.handle);
+    if (committed_rows == -1) {
+        impl::throw_bulk_copy_error(*level1_api_, handle.connection, "bcp_batch");
+    }
+    return committed_rows;
+}
+
+SQLINTEGER level1_connector::do_finish_bulk_copy(bulk_copy_handle const & handle) const
+{
+    auto const committed_rows = level1_api_->bulk_copy_done(handle.handle);
+    if (committed_rows == -1) {
+        impl::throw_bulk_copy_error(*level1_api_, handle.connection, "bcp_done");
+    }
+    return committed_rows;
+}
+
 } }
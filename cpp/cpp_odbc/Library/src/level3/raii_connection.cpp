@@ -45,12 +45,16 @@ struct raii_connection::intern {
 
 	intern(
 			std::shared_ptr<raii_environment const> environment,
-			std::string const & connection_string
+			std::string const & connection_string,
+			connection_attributes const & attributes
 		) :
 		environment(environment),
 		api(environment->get_api()),
 		handle(api, environment->get_handle())
 	{
+		for (auto const & attribute : attributes) {
+			api->set_connection_attribute(handle.handle, attribute.first, attribute.second);
+		}
 		thread_safe_establish_connection(connection_string);
 	}
 
@@ -79,8 +83,9 @@ private:
 };
 
 
-raii_connection::raii_connection(std::shared_ptr<raii_environment const> environment, std::string const & connection_string) :
-	impl_(new raii_connection::intern(environment, connection_string))
+raii_connection::raii_connection(std::shared_ptr<raii_environment const> environment, std::string const & connection_string,
+                                 connection_attributes const & attributes) :
+	impl_(new raii_connection::intern(environment, connection_string, attributes))
 {
 }
 
@@ -40,6 +40,11 @@ void raii_statement::do_set_attribute(SQLINTEGER attribute, SQLULEN * pointer) c
     api_->set_statement_attribute(handle_, attribute, pointer);
 }
 
+void raii_statement::do_set_attribute(SQLINTEGER attribute, SQLUSMALLINT * pointer) const
+{
+    api_->set_statement_attribute(handle_, attribute, pointer);
+}
+
 void raii_statement::do_execute(std::string const & sql) const
 {
     api_->execute_statement(handle_, sql);
@@ -60,6 +65,16 @@ void raii_statement::do_bind_input_parameter(SQLUSMALLINT parameter_id, SQLSMALL
     api_->bind_input_parameter(handle_, parameter_id, value_type, parameter_type, digits, parameter_values);
 }
 
+void raii_statement::do_bind_numeric_input_parameter(SQLUSMALLINT parameter_id, SQLSMALLINT parameter_type, SQLSMALLINT precision, SQLSMALLINT scale, cpp_odbc::multi_value_buffer & parameter_values) const
+{
+    api_->bind_numeric_input_parameter(handle_, parameter_id, parameter_type, precision, scale, parameter_values);
+}
+
+void raii_statement::do_bind_table_input_parameter(SQLUSMALLINT parameter_id, std::u16string const & type_name, SQLULEN maximum_rows, SQLLEN * row_count) const
+{
+    api_->bind_table_input_parameter(handle_, parameter_id, type_name, maximum_rows, row_count);
+}
+
 void raii_statement::do_unbind_all_parameters() const
 {
     api_->free_statement(handle_, SQL_RESET_PARAMS);
@@ -85,6 +100,11 @@ void raii_statement::do_bind_column(SQLUSMALLINT column_id, SQLSMALLINT column_t
     api_->bind_column(handle_, column_id, column_type, column_buffer);
 }
 
+void raii_statement::do_bind_numeric_column(SQLUSMALLINT column_id, SQLSMALLINT precision, SQLSMALLINT scale, cpp_odbc::multi_value_buffer & column_buffer) const
+{
+    api_->bind_numeric_column(handle_, column_id, precision, scale, column_buffer);
+}
+
 void raii_statement::do_unbind_all_columns() const
 {
     api_->free_statement(handle_, SQL_UNBIND);
@@ -116,6 +136,11 @@ SQLLEN raii_statement::do_row_count() const
     return api_->row_count(handle_);
 }
 
+std::vector<level2::row_diagnostic_record> raii_statement::do_get_row_diagnostic_records() const
+{
+    return api_->get_row_diagnostic_records(handle_);
+}
+
 column_description raii_statement::do_describe_column(SQLUSMALLINT column_id) const
 {
     return api_->describe_column(handle_, column_id);
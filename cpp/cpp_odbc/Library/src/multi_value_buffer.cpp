@@ -20,7 +20,8 @@ namespace cpp_odbc {
 multi_value_buffer::multi_value_buffer(std::size_t element_size, std::size_t number_of_elements) :
 	element_size_(element_size),
 	data_(element_size_ * number_of_elements, 0),
-	indicators_(number_of_elements, 0)
+	indicators_(number_of_elements, 0),
+	external_data_(nullptr)
 {
 	if (element_size == 0) {
 		throw std::logic_error("Element size must not be 0");
@@ -33,9 +34,11 @@ multi_value_buffer::multi_value_buffer(std::size_t element_size, std::size_t num
 multi_value_buffer::multi_value_buffer(multi_value_buffer && other) :
 	element_size_(other.element_size_),
 	data_(std::move(other.data_)),
-	indicators_(std::move(other.indicators_))
+	indicators_(std::move(other.indicators_)),
+	external_data_(other.external_data_)
 {
 	other.element_size_ = 0;
+	other.external_data_ = nullptr;
 }
 
 std::size_t multi_value_buffer::capacity_per_element() const
@@ -50,12 +53,12 @@ std::size_t multi_value_buffer::number_of_elements() const
 
 char * multi_value_buffer::data_pointer()
 {
-	return data_.data();
+	return (external_data_ != nullptr) ? external_data_ : data_.data();
 }
 
 char const * multi_value_buffer::data_pointer() const
 {
-	return data_.data();
+	return (external_data_ != nullptr) ? external_data_ : data_.data();
 }
 
 intptr_t * multi_value_buffer::indicator_pointer()
@@ -79,11 +82,30 @@ writable_buffer_element multi_value_buffer::operator[](std::size_t element_index
 buffer_element multi_value_buffer::operator[](std::size_t element_index) const
 {
 	return {
-		data_.data() + (element_index * element_size_),
+		data_pointer() + (element_index * element_size_),
 		indicators_[element_index]
 	};
 }
 
+void multi_value_buffer::resize(std::size_t number_of_elements)
+{
+	if (number_of_elements == 0) {
+		throw std::logic_error("Number of elements must not be 0");
+	}
+	data_.resize(element_size_ * number_of_elements, 0);
+	indicators_.resize(number_of_elements, 0);
+}
+
+void multi_value_buffer::use_external_data(char * external_data)
+{
+	external_data_ = external_data;
+}
+
+bool multi_value_buffer::uses_external_data() const
+{
+	return external_data_ != nullptr;
+}
+
 
 
 }
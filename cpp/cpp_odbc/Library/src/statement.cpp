@@ -21,6 +21,11 @@ void statement::set_attribute(SQLINTEGER attribute, SQLULEN * pointer) const
     do_set_attribute(attribute, pointer);
 }
 
+void statement::set_attribute(SQLINTEGER attribute, SQLUSMALLINT * pointer) const
+{
+    do_set_attribute(attribute, pointer);
+}
+
 void statement::execute(std::string const & sql) const
 {
     do_execute(sql);
@@ -41,6 +46,16 @@ void statement::bind_input_parameter(SQLUSMALLINT parameter_id, SQLSMALLINT valu
     do_bind_input_parameter(parameter_id, value_type, parameter_type, digits, parameter_values);
 }
 
+void statement::bind_numeric_input_parameter(SQLUSMALLINT parameter_id, SQLSMALLINT parameter_type, SQLSMALLINT precision, SQLSMALLINT scale, cpp_odbc::multi_value_buffer & parameter_values) const
+{
+    do_bind_numeric_input_parameter(parameter_id, parameter_type, precision, scale, parameter_values);
+}
+
+void statement::bind_table_input_parameter(SQLUSMALLINT parameter_id, std::u16string const & type_name, SQLULEN maximum_rows, SQLLEN * row_count) const
+{
+    do_bind_table_input_parameter(parameter_id, type_name, maximum_rows, row_count);
+}
+
 void statement::unbind_all_parameters() const
 {
     do_unbind_all_parameters();
@@ -66,6 +81,11 @@ void statement::bind_column(SQLUSMALLINT column_id, SQLSMALLINT column_type, cpp
     do_bind_column(column_id, column_type, column_buffer);
 }
 
+void statement::bind_numeric_column(SQLUSMALLINT column_id, SQLSMALLINT precision, SQLSMALLINT scale, cpp_odbc::multi_value_buffer & column_buffer) const
+{
+    do_bind_numeric_column(column_id, precision, scale, column_buffer);
+}
+
 void statement::unbind_all_columns() const
 {
     do_unbind_all_columns();
@@ -96,6 +116,11 @@ SQLLEN statement::row_count() const
     return do_row_count();
 }
 
+std::vector<level2::row_diagnostic_record> statement::get_row_diagnostic_records() const
+{
+    return do_get_row_diagnostic_records();
+}
+
 column_description statement::describe_column(SQLUSMALLINT column_id) const
 {
     return do_describe_column(column_id);
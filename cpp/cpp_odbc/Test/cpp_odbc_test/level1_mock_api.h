@@ -26,6 +26,7 @@ struct level1_mock_api : public cpp_odbc::level1::api {
 	MOCK_CONST_METHOD3(do_allocate_handle, SQLRETURN(SQLSMALLINT, SQLHANDLE, SQLHANDLE *));
 	MOCK_CONST_METHOD2(do_free_handle, SQLRETURN(SQLSMALLINT, SQLHANDLE));
 	MOCK_CONST_METHOD8(do_get_diagnostic_record, SQLRETURN(SQLSMALLINT, SQLHANDLE, SQLSMALLINT, SQLCHAR *, SQLINTEGER *, SQLCHAR *, SQLSMALLINT, SQLSMALLINT *));
+	MOCK_CONST_METHOD7(do_get_diagnostic_field, SQLRETURN(SQLSMALLINT, SQLHANDLE, SQLSMALLINT, SQLSMALLINT, SQLPOINTER, SQLSMALLINT, SQLSMALLINT *));
 	MOCK_CONST_METHOD4(do_set_environment_attribute, SQLRETURN(SQLHENV, SQLINTEGER, SQLPOINTER, SQLINTEGER));
 	MOCK_CONST_METHOD4(do_set_connection_attribute, SQLRETURN(SQLHDBC, SQLINTEGER, SQLPOINTER, SQLINTEGER));
 	MOCK_CONST_METHOD8(do_establish_connection, SQLRETURN(SQLHDBC, SQLHWND, SQLCHAR *, SQLSMALLINT, SQLCHAR *, SQLSMALLINT, SQLSMALLINT *, SQLUSMALLINT));
@@ -52,6 +53,15 @@ struct level1_mock_api : public cpp_odbc::level1::api {
 	MOCK_CONST_METHOD6(do_describe_parameter, SQLRETURN(SQLHSTMT, SQLUSMALLINT, SQLSMALLINT *, SQLULEN *, SQLSMALLINT *, SQLSMALLINT *));
 	MOCK_CONST_METHOD1(do_more_results, SQLRETURN(SQLHSTMT));
 	MOCK_CONST_METHOD3(do_get_functions, SQLRETURN(SQLHDBC, SQLUSMALLINT, SQLUSMALLINT *));
+	MOCK_CONST_METHOD5(do_set_descriptor_field, SQLRETURN(SQLHDESC, SQLSMALLINT, SQLSMALLINT, SQLPOINTER, SQLINTEGER));
+	MOCK_CONST_METHOD5(do_bulk_copy_init, int(SQLHDBC, SQLWCHAR const *, SQLWCHAR const *, SQLWCHAR const *, int));
+	MOCK_CONST_METHOD3(do_bulk_copy_control, int(SQLHDBC, int, void *));
+	MOCK_CONST_METHOD8(do_bulk_copy_bind, int(SQLHDBC, unsigned char const *, int, SQLINTEGER, unsigned char const *, int, int, int));
+	MOCK_CONST_METHOD3(do_bulk_copy_column_pointer, int(SQLHDBC, unsigned char const *, int));
+	MOCK_CONST_METHOD3(do_bulk_copy_column_length, int(SQLHDBC, SQLINTEGER, int));
+	MOCK_CONST_METHOD1(do_bulk_copy_send_row, int(SQLHDBC));
+	MOCK_CONST_METHOD1(do_bulk_copy_batch, SQLINTEGER(SQLHDBC));
+	MOCK_CONST_METHOD1(do_bulk_copy_done, SQLINTEGER(SQLHDBC));
 
 };
 
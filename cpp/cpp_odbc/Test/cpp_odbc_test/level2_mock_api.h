@@ -18,6 +18,7 @@ namespace cpp_odbc_test {
 		MOCK_CONST_METHOD1(do_get_diagnostic_record, cpp_odbc::level2::diagnostic_record(cpp_odbc::level2::statement_handle const &));
 		MOCK_CONST_METHOD1(do_get_diagnostic_record, cpp_odbc::level2::diagnostic_record(cpp_odbc::level2::connection_handle const &));
 		MOCK_CONST_METHOD1(do_get_diagnostic_record, cpp_odbc::level2::diagnostic_record(cpp_odbc::level2::environment_handle const &));
+		MOCK_CONST_METHOD1(do_get_row_diagnostic_records, std::vector<cpp_odbc::level2::row_diagnostic_record>(cpp_odbc::level2::statement_handle const &));
 		MOCK_CONST_METHOD3(do_set_environment_attribute, void(cpp_odbc::level2::environment_handle const &, SQLINTEGER, intptr_t));
 		MOCK_CONST_METHOD3(do_set_connection_attribute, void(cpp_odbc::level2::connection_handle const &, SQLINTEGER, intptr_t));
 		MOCK_CONST_METHOD2(do_establish_connection, void(cpp_odbc::level2::connection_handle &, std::string const &));
@@ -27,6 +28,9 @@ namespace cpp_odbc_test {
 		MOCK_CONST_METHOD2(do_get_integer_connection_info, SQLUINTEGER(cpp_odbc::level2::connection_handle const & handle, SQLUSMALLINT info_type));
 		MOCK_CONST_METHOD4(do_bind_column, void(cpp_odbc::level2::statement_handle const &, SQLUSMALLINT, SQLSMALLINT, cpp_odbc::multi_value_buffer &));
 		MOCK_CONST_METHOD6(do_bind_input_parameter, void(cpp_odbc::level2::statement_handle const &, SQLUSMALLINT, SQLSMALLINT, SQLSMALLINT, SQLSMALLINT, cpp_odbc::multi_value_buffer &));
+		MOCK_CONST_METHOD5(do_bind_numeric_column, void(cpp_odbc::level2::statement_handle const &, SQLUSMALLINT, SQLSMALLINT, SQLSMALLINT, cpp_odbc::multi_value_buffer &));
+		MOCK_CONST_METHOD6(do_bind_numeric_input_parameter, void(cpp_odbc::level2::statement_handle const &, SQLUSMALLINT, SQLSMALLINT, SQLSMALLINT, SQLSMALLINT, cpp_odbc::multi_value_buffer &));
+		MOCK_CONST_METHOD5(do_bind_table_input_parameter, void(cpp_odbc::level2::statement_handle const &, SQLUSMALLINT, std::u16string const &, SQLULEN, SQLLEN *));
 		MOCK_CONST_METHOD1(do_execute_prepared_statement, void(cpp_odbc::level2::statement_handle const &));
 		MOCK_CONST_METHOD2(do_execute_statement, void(cpp_odbc::level2::statement_handle const &, std::string const &));
 		MOCK_CONST_METHOD3(do_fetch_scroll, bool(cpp_odbc::level2::statement_handle const &, SQLSMALLINT, SQLLEN));
@@ -40,12 +44,21 @@ namespace cpp_odbc_test {
 		MOCK_CONST_METHOD2(do_prepare_statement, void(cpp_odbc::level2::statement_handle const &, std::u16string const &));
 		MOCK_CONST_METHOD3(do_set_statement_attribute, void(cpp_odbc::level2::statement_handle const &, SQLINTEGER, intptr_t));
 		MOCK_CONST_METHOD3(do_set_statement_attribute, void(cpp_odbc::level2::statement_handle const &, SQLINTEGER, SQLULEN *));
+		MOCK_CONST_METHOD3(do_set_statement_attribute, void(cpp_odbc::level2::statement_handle const &, SQLINTEGER, SQLUSMALLINT *));
 		MOCK_CONST_METHOD1(do_row_count, SQLLEN(cpp_odbc::level2::statement_handle const &));
 		MOCK_CONST_METHOD2(do_describe_column, cpp_odbc::column_description(cpp_odbc::level2::statement_handle const &, SQLUSMALLINT));
 		MOCK_CONST_METHOD2(do_describe_column_wide, cpp_odbc::column_description(cpp_odbc::level2::statement_handle const &, SQLUSMALLINT));
 		MOCK_CONST_METHOD2(do_describe_parameter, cpp_odbc::column_description(cpp_odbc::level2::statement_handle const &, SQLUSMALLINT));
 		MOCK_CONST_METHOD1(do_more_results, bool(cpp_odbc::level2::statement_handle const &));
 		MOCK_CONST_METHOD2(do_supports_function, bool(cpp_odbc::level2::connection_handle const &, SQLUSMALLINT));
+		MOCK_CONST_METHOD2(do_initialize_bulk_copy, cpp_odbc::level2::bulk_copy_handle(cpp_odbc::level2::connection_handle const &, std::u16string const &));
+		MOCK_CONST_METHOD3(do_set_bulk_copy_option, void(cpp_odbc::level2::bulk_copy_handle const &, int, intptr_t));
+		MOCK_CONST_METHOD2(do_set_bulk_copy_hints, void(cpp_odbc::level2::bulk_copy_handle const &, std::u16string const &));
+		MOCK_CONST_METHOD3(do_bind_bulk_copy_column, void(cpp_odbc::level2::bulk_copy_handle const &, int, int));
+		MOCK_CONST_METHOD4(do_set_bulk_copy_column_data, void(cpp_odbc::level2::bulk_copy_handle const &, int, void const *, SQLINTEGER));
+		MOCK_CONST_METHOD1(do_send_bulk_copy_row, void(cpp_odbc::level2::bulk_copy_handle const &));
+		MOCK_CONST_METHOD1(do_commit_bulk_copy_batch, SQLINTEGER(cpp_odbc::level2::bulk_copy_handle const &));
+		MOCK_CONST_METHOD1(do_finish_bulk_copy, SQLINTEGER(cpp_odbc::level2::bulk_copy_handle const &));
 	};
 
 }
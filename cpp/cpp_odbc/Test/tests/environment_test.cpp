@@ -21,12 +21,25 @@ TEST(EnvironmentTest, MakeConnectionForwards)
 	std::string const connection_string("test DSN");
 	auto expected = std::make_shared<cpp_odbc_test::mock_connection>();
 
-	EXPECT_CALL(environment, do_make_connection(connection_string))
+	EXPECT_CALL(environment, do_make_connection(connection_string, cpp_odbc::connection_attributes()))
 		.WillOnce(testing::Return(expected));
 
 	EXPECT_TRUE( expected == environment.make_connection(connection_string) );
 }
 
+TEST(EnvironmentTest, MakeConnectionWithAttributesForwards)
+{
+	mock_environment environment;
+	std::string const connection_string("test DSN");
+	cpp_odbc::connection_attributes const attributes = {{1219, 1}};
+	auto expected = std::make_shared<cpp_odbc_test::mock_connection>();
+
+	EXPECT_CALL(environment, do_make_connection(connection_string, attributes))
+		.WillOnce(testing::Return(expected));
+
+	EXPECT_TRUE( expected == environment.make_connection(connection_string, attributes) );
+}
+
 TEST(EnvironmentTest, SetIntegerAttributeForwards)
 {
 	mock_environment environment;
@@ -68,6 +68,25 @@ TEST(Level1APITest, GetDiagnosticRecordForwards)
     EXPECT_EQ( expected, actual );
 }
 
+TEST(Level1APITest, GetDiagnosticFieldForwards)
+{
+    SQLRETURN const expected = 1;
+    SQLSMALLINT const handle_type = 42;
+    SQLHANDLE const handle = &value_a;
+    SQLSMALLINT const record_id = 17;
+    SQLSMALLINT const diagnostic_id = 23;
+    SQLLEN field = 0;
+    SQLSMALLINT const buffer_length = 123;
+    SQLSMALLINT string_length = 95;
+
+    level1_mock_api api;
+    EXPECT_CALL(api, do_get_diagnostic_field(handle_type, handle, record_id, diagnostic_id, &field, buffer_length, &string_length))
+        .WillOnce(testing::Return(expected));
+
+    auto const actual = api.get_diagnostic_field(handle_type, handle, record_id, diagnostic_id, &field, buffer_length, &string_length);
+    EXPECT_EQ( expected, actual );
+}
+
 TEST(Level1APITest, SetEnvironmentAttributeForwards)
 {
     SQLRETURN const expected = 1;
@@ -468,3 +487,138 @@ TEST(Level1APITest, GetFunctionsForwards)
     auto const actual = api.get_functions(handle, function_id, &destination);
     EXPECT_EQ(expected, actual);
 }
+
+TEST(Level1APITest, SetDescriptorFieldForwards)
+{
+    SQLRETURN const expected = 23;
+    SQLSMALLINT const record_number = 17;
+    SQLSMALLINT const field_identifier = 42;
+    SQLINTEGER const buffer_length = 3;
+    SQLHDESC handle = &value_a;
+    SQLPOINTER value = &value_b;
+
+    level1_mock_api api;
+    EXPECT_CALL(api, do_set_descriptor_field(handle, record_number, field_identifier, value, buffer_length))
+        .WillOnce(testing::Return(expected));
+
+    auto const actual = api.set_descriptor_field(handle, record_number, field_identifier, value, buffer_length);
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(Level1APITest, BulkCopyInitForwards)
+{
+    int const expected = 1;
+    int const direction = 1;
+    SQLHDBC handle = &value_a;
+    SQLWCHAR const table[] = {'t', 0};
+
+    level1_mock_api api;
+    EXPECT_CALL(api, do_bulk_copy_init(handle, table, nullptr, nullptr, direction))
+        .WillOnce(testing::Return(expected));
+
+    auto const actual = api.bulk_copy_init(handle, table, nullptr, nullptr, direction);
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(Level1APITest, BulkCopyControlForwards)
+{
+    int const expected = 1;
+    int const option = 17;
+    SQLHDBC handle = &value_a;
+    void * value = &value_b;
+
+    level1_mock_api api;
+    EXPECT_CALL(api, do_bulk_copy_control(handle, option, value))
+        .WillOnce(testing::Return(expected));
+
+    auto const actual = api.bulk_copy_control(handle, option, value);
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(Level1APITest, BulkCopyBindForwards)
+{
+    int const expected = 1;
+    int const indicator_length = 0;
+    SQLINTEGER const data_length = -10;
+    int const terminator_length = 0;
+    int const data_type = 0x38;
+    int const column = 3;
+    SQLHDBC handle = &value_a;
+    auto const data = reinterpret_cast<unsigned char const *>(&value_b);
+
+    level1_mock_api api;
+    EXPECT_CALL(api, do_bulk_copy_bind(handle, data, indicator_length, data_length, nullptr, terminator_length, data_type, column))
+        .WillOnce(testing::Return(expected));
+
+    auto const actual = api.bulk_copy_bind(handle, data, indicator_length, data_length, nullptr, terminator_length, data_type, column);
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(Level1APITest, BulkCopyColumnPointerForwards)
+{
+    int const expected = 1;
+    int const column = 3;
+    SQLHDBC handle = &value_a;
+    auto const data = reinterpret_cast<unsigned char const *>(&value_b);
+
+    level1_mock_api api;
+    EXPECT_CALL(api, do_bulk_copy_column_pointer(handle, data, column))
+        .WillOnce(testing::Return(expected));
+
+    auto const actual = api.bulk_copy_column_pointer(handle, data, column);
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(Level1APITest, BulkCopyColumnLengthForwards)
+{
+    int const expected = 1;
+    SQLINTEGER const data_length = 42;
+    int const column = 3;
+    SQLHDBC handle = &value_a;
+
+    level1_mock_api api;
+    EXPECT_CALL(api, do_bulk_copy_column_length(handle, data_length, column))
+        .WillOnce(testing::Return(expected));
+
+    auto const actual = api.bulk_copy_column_length(handle, data_length, column);
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(Level1APITest, BulkCopySendRowForwards)
+{
+    int const expected = 1;
+    SQLHDBC handle = &value_a;
+
+    level1_mock_api api;
+    EXPECT_CALL(api, do_bulk_copy_send_row(handle))
+        .WillOnce(testing::Return(expected));
+
+    auto const actual = api.bulk_copy_send_row(handle);
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(Level1APITest, BulkCopyBatchForwards)
+{
+    SQLINTEGER const expected = 23;
+    SQLHDBC handle = &value_a;
+
+    level1_mock_api api;
+    EXPECT_CALL(api, do_bulk_copy_batch(handle))
+        .WillOnce(testing::Return(expected));
+
+    auto const actual = api.bulk_copy_batch(handle);
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(Level1APITest, BulkCopyDoneForwards)
+{
+    SQLINTEGER const expected = 23;
+    SQLHDBC handle = &value_a;
+
+    level1_mock_api api;
+    EXPECT_CALL(api, do_bulk_copy_done(handle))
+        .WillOnce(testing::Return(expected));
+
+    auto const actual = api.bulk_copy_done(handle);
+    EXPECT_EQ(expected, actual);
+}
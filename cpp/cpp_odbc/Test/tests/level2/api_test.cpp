@@ -238,6 +238,49 @@ TEST(Level2APITest, BindInputParameterForwards)
     api.bind_input_parameter(handle, parameter_id, c_data_type, sql_data_type, digits, column_buffer);
 }
 
+TEST(Level2APITest, BindNumericColumnForwards)
+{
+    level2::statement_handle const handle = {&value_a};
+    SQLUSMALLINT column_id = 17;
+    SQLSMALLINT precision = 18;
+    SQLSMALLINT scale = 4;
+    cpp_odbc::multi_value_buffer column_buffer(2,3);
+
+    level2_mock_api api;
+    EXPECT_CALL(api, do_bind_numeric_column(handle, column_id, precision, scale, testing::Ref(column_buffer))).Times(1);
+
+    api.bind_numeric_column(handle, column_id, precision, scale, column_buffer);
+}
+
+TEST(Level2APITest, BindNumericInputParameterForwards)
+{
+    level2::statement_handle const handle = {&value_a};
+    SQLUSMALLINT parameter_id = 17;
+    SQLSMALLINT sql_data_type = 23;
+    SQLSMALLINT precision = 18;
+    SQLSMALLINT scale = 4;
+    cpp_odbc::multi_value_buffer column_buffer(2,3);
+
+    level2_mock_api api;
+    EXPECT_CALL(api, do_bind_numeric_input_parameter(handle, parameter_id, sql_data_type, precision, scale, testing::Ref(column_buffer))).Times(1);
+
+    api.bind_numeric_input_parameter(handle, parameter_id, sql_data_type, precision, scale, column_buffer);
+}
+
+TEST(Level2APITest, BindTableInputParameterForwards)
+{
+    level2::statement_handle const handle = {&value_a};
+    SQLUSMALLINT parameter_id = 17;
+    std::u16string const type_name(u"dbo.row_type");
+    SQLULEN maximum_rows = 1000;
+    SQLLEN row_count = 0;
+
+    level2_mock_api api;
+    EXPECT_CALL(api, do_bind_table_input_parameter(handle, parameter_id, type_name, maximum_rows, &row_count)).Times(1);
+
+    api.bind_table_input_parameter(handle, parameter_id, type_name, maximum_rows, &row_count);
+}
+
 TEST(Level2APITest, GetStringColumnAttributeForwards)
 {
     level2::statement_handle const handle = {&value_a};
@@ -394,6 +437,32 @@ TEST(Level2APITest, SetPointerStatementAttributeForwards)
     api.set_statement_attribute(handle, attribute, &value);
 }
 
+TEST(Level2APITest, SetArrayStatementAttributeForwards)
+{
+    level2::statement_handle const handle = {&value_a};
+    SQLINTEGER const attribute = 23;
+    SQLUSMALLINT values[3] = {0, 0, 0};
+
+    level2_mock_api api;
+    EXPECT_CALL(api, do_set_statement_attribute(handle, attribute, values)).Times(1);
+
+    api.set_statement_attribute(handle, attribute, values);
+}
+
+TEST(Level2APITest, GetRowDiagnosticRecordsForwards)
+{
+    level2::statement_handle const handle = {&value_a};
+    std::vector<level2::row_diagnostic_record> const expected = {{2, {"ABCDE", 23, "message"}}};
+
+    level2_mock_api api;
+    EXPECT_CALL(api, do_get_row_diagnostic_records(handle)).WillOnce(testing::Return(expected));
+
+    auto const actual = api.get_row_diagnostic_records(handle);
+    ASSERT_EQ(1, actual.size());
+    EXPECT_EQ(2, actual[0].row_number);
+    EXPECT_EQ("message", actual[0].record.message);
+}
+
 TEST(Level2APITest, RowCountForwards)
 {
     level2::statement_handle const handle = {&value_a};
@@ -461,3 +530,94 @@ TEST(Level2APITest, SupportsFunctionForwards)
 
     EXPECT_FALSE(api.supports_function(handle, function_id));
 }
+
+TEST(Level2APITest, InitializeBulkCopyForwards)
+{
+    level2::connection_handle const handle = {&value_a};
+    level2::bulk_copy_handle const expected = {&value_b, handle};
+    std::u16string const table(u"dbo.test");
+
+    level2_mock_api api;
+    EXPECT_CALL(api, do_initialize_bulk_copy(handle, table)).WillOnce(testing::Return(expected));
+
+    EXPECT_EQ(expected, api.initialize_bulk_copy(handle, table));
+}
+
+TEST(Level2APITest, SetBulkCopyOptionForwards)
+{
+    level2::bulk_copy_handle const handle = {&value_a, {&value_b}};
+    int const option = 4;
+    intptr_t const value = 1000;
+
+    level2_mock_api api;
+    EXPECT_CALL(api, do_set_bulk_copy_option(handle, option, value)).Times(1);
+
+    api.set_bulk_copy_option(handle, option, value);
+}
+
+TEST(Level2APITest, SetBulkCopyHintsForwards)
+{
+    level2::bulk_copy_handle const handle = {&value_a, {&value_b}};
+    std::u16string const hints(u"TABLOCK");
+
+    level2_mock_api api;
+    EXPECT_CALL(api, do_set_bulk_copy_hints(handle, hints)).Times(1);
+
+    api.set_bulk_copy_hints(handle, hints);
+}
+
+TEST(Level2APITest, BindBulkCopyColumnForwards)
+{
+    level2::bulk_copy_handle const handle = {&value_a, {&value_b}};
+    int const column_id = 3;
+    int const data_type = 0x38;
+
+    level2_mock_api api;
+    EXPECT_CALL(api, do_bind_bulk_copy_column(handle, column_id, data_type)).Times(1);
+
+    api.bind_bulk_copy_column(handle, column_id, data_type);
+}
+
+TEST(Level2APITest, SetBulkCopyColumnDataForwards)
+{
+    level2::bulk_copy_handle const handle = {&value_a, {&value_b}};
+    int const column_id = 3;
+    SQLINTEGER const length = 4;
+
+    level2_mock_api api;
+    EXPECT_CALL(api, do_set_bulk_copy_column_data(handle, column_id, &value_b, length)).Times(1);
+
+    api.set_bulk_copy_column_data(handle, column_id, &value_b, length);
+}
+
+TEST(Level2APITest, SendBulkCopyRowForwards)
+{
+    level2::bulk_copy_handle const handle = {&value_a, {&value_b}};
+
+    level2_mock_api api;
+    EXPECT_CALL(api, do_send_bulk_copy_row(handle)).Times(1);
+
+    api.send_bulk_copy_row(handle);
+}
+
+TEST(Level2APITest, CommitBulkCopyBatchForwards)
+{
+    level2::bulk_copy_handle const handle = {&value_a, {&value_b}};
+    SQLINTEGER const expected = 1000;
+
+    level2_mock_api api;
+    EXPECT_CALL(api, do_commit_bulk_copy_batch(handle)).WillOnce(testing::Return(expected));
+
+    EXPECT_EQ(expected, api.commit_bulk_copy_batch(handle));
+}
+
+TEST(Level2APITest, FinishBulkCopyForwards)
+{
+    level2::bulk_copy_handle const handle = {&value_a, {&value_b}};
+    SQLINTEGER const expected = 42;
+
+    level2_mock_api api;
+    EXPECT_CALL(api, do_finish_bulk_copy(handle)).WillOnce(testing::Return(expected));
+
+    EXPECT_EQ(expected, api.finish_bulk_copy(handle));
+}
@@ -64,3 +64,8 @@ TEST(HandlesTest, StatementHandleEquality)
 {
 	test_handle_equality<cpp_odbc::level2::statement_handle>();
 }
+
+TEST(HandlesTest, BulkCopyHandleEquality)
+{
+	test_handle_equality<cpp_odbc::level2::bulk_copy_handle>();
+}
@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include "cpp_odbc/error.h"
+#include "cpp_odbc/sql_server_types.h"
 
 #include "cpp_odbc_test/level1_mock_api.h"
 
@@ -600,6 +601,141 @@ TEST(Level1ConnectorTest, BindInputParameterFails)
     EXPECT_THROW( connector.bind_input_parameter(handle, parameter_id, value_type, parameter_type, digits, buffer), cpp_odbc::error);
 }
 
+namespace {
+
+    void expect_numeric_descriptor_fields(cpp_odbc_test::level1_mock_api const & mock,
+                                          SQLHDESC descriptor,
+                                          SQLSMALLINT record_id,
+                                          SQLSMALLINT precision,
+                                          SQLSMALLINT scale,
+                                          SQLPOINTER data)
+    {
+        testing::InSequence sequence;
+        EXPECT_CALL(mock, do_set_descriptor_field(descriptor, record_id, SQL_DESC_TYPE, reinterpret_cast<SQLPOINTER>(static_cast<intptr_t>(SQL_C_NUMERIC)), 0))
+            .WillOnce(testing::Return(SQL_SUCCESS));
+        EXPECT_CALL(mock, do_set_descriptor_field(descriptor, record_id, SQL_DESC_PRECISION, reinterpret_cast<SQLPOINTER>(static_cast<intptr_t>(precision)), 0))
+            .WillOnce(testing::Return(SQL_SUCCESS));
+        EXPECT_CALL(mock, do_set_descriptor_field(descriptor, record_id, SQL_DESC_SCALE, reinterpret_cast<SQLPOINTER>(static_cast<intptr_t>(scale)), 0))
+            .WillOnce(testing::Return(SQL_SUCCESS));
+        EXPECT_CALL(mock, do_set_descriptor_field(descriptor, record_id, SQL_DESC_DATA_PTR, data, 0))
+            .WillOnce(testing::Return(SQL_SUCCESS));
+    }
+
+}
+
+TEST(Level1ConnectorTest, BindNumericColumnCallsAPI)
+{
+    level2::statement_handle handle = {&value_a};
+    SQLHDESC descriptor = &value_b;
+    SQLUSMALLINT const column_id = 42;
+    SQLSMALLINT const precision = 18;
+    SQLSMALLINT const scale = 4;
+    cpp_odbc::multi_value_buffer column_buffer(sizeof(SQL_NUMERIC_STRUCT), 2);
+
+    auto api = std::make_shared<cpp_odbc_test::level1_mock_api const>();
+    EXPECT_CALL(*api, do_bind_column(handle.handle, column_id, SQL_C_NUMERIC, column_buffer.data_pointer(), column_buffer.capacity_per_element(), column_buffer.indicator_pointer()))
+        .WillOnce(testing::Return(SQL_SUCCESS));
+    EXPECT_CALL(*api, do_get_statement_attribute(handle.handle, SQL_ATTR_APP_ROW_DESC, testing::_, 0, nullptr))
+        .WillOnce(testing::DoAll(
+                    testing::Invoke([descriptor](testing::Unused, testing::Unused, void * destination, testing::Unused, testing::Unused) {
+                        *reinterpret_cast<SQLHDESC *>(destination) = descriptor;
+                    }),
+                    testing::Return(SQL_SUCCESS)
+                ));
+    expect_numeric_descriptor_fields(*api, descriptor, column_id, precision, scale, column_buffer.data_pointer());
+
+    level1_connector const connector(api);
+    connector.bind_numeric_column(handle, column_id, precision, scale, column_buffer);
+}
+
+TEST(Level1ConnectorTest, BindNumericColumnFailsOnDescriptor)
+{
+    level2::statement_handle handle = {&value_a};
+    cpp_odbc::multi_value_buffer column_buffer(sizeof(SQL_NUMERIC_STRUCT), 2);
+
+    auto api = std::make_shared<cpp_odbc_test::level1_mock_api const>();
+    EXPECT_CALL(*api, do_bind_column(testing::_, testing::_, testing::_, testing::_, testing::_, testing::_))
+        .WillOnce(testing::Return(SQL_SUCCESS));
+    EXPECT_CALL(*api, do_get_statement_attribute(testing::_, testing::_, testing::_, testing::_, testing::_))
+        .WillOnce(testing::Return(SQL_SUCCESS));
+    EXPECT_CALL(*api, do_set_descriptor_field(testing::_, testing::_, testing::_, testing::_, testing::_))
+        .WillOnce(testing::Return(SQL_ERROR));
+    expect_diagnostic_record(*api, expected_error);
+
+    level1_connector const connector(api);
+    EXPECT_THROW(connector.bind_numeric_column(handle, 1, 18, 4, column_buffer), cpp_odbc::error);
+}
+
+TEST(Level1ConnectorTest, BindNumericInputParameterCallsAPI)
+{
+    level2::statement_handle handle = {&value_a};
+    SQLHDESC descriptor = &value_b;
+    SQLUSMALLINT const parameter_id = 42;
+    SQLSMALLINT const parameter_type = SQL_DECIMAL;
+    SQLSMALLINT const precision = 18;
+    SQLSMALLINT const scale = 4;
+    cpp_odbc::multi_value_buffer buffer(sizeof(SQL_NUMERIC_STRUCT), 2);
+
+    auto api = std::make_shared<cpp_odbc_test::level1_mock_api const>();
+    EXPECT_CALL(*api, do_bind_parameter(handle.handle, parameter_id, SQL_PARAM_INPUT, SQL_C_NUMERIC, parameter_type, precision, scale, buffer.data_pointer(), buffer.capacity_per_element(), buffer.indicator_pointer()))
+        .WillOnce(testing::Return(SQL_SUCCESS));
+    EXPECT_CALL(*api, do_get_statement_attribute(handle.handle, SQL_ATTR_APP_PARAM_DESC, testing::_, 0, nullptr))
+        .WillOnce(testing::DoAll(
+                    testing::Invoke([descriptor](testing::Unused, testing::Unused, void * destination, testing::Unused, testing::Unused) {
+                        *reinterpret_cast<SQLHDESC *>(destination) = descriptor;
+                    }),
+                    testing::Return(SQL_SUCCESS)
+                ));
+    expect_numeric_descriptor_fields(*api, descriptor, parameter_id, precision, scale, buffer.data_pointer());
+
+    level1_connector const connector(api);
+    connector.bind_numeric_input_parameter(handle, parameter_id, parameter_type, precision, scale, buffer);
+}
+
+TEST(Level1ConnectorTest, BindNumericInputParameterFails)
+{
+    level2::statement_handle handle = {&value_a};
+    cpp_odbc::multi_value_buffer buffer(sizeof(SQL_NUMERIC_STRUCT), 2);
+
+    auto api = std::make_shared<cpp_odbc_test::level1_mock_api const>();
+    EXPECT_CALL(*api, do_bind_parameter(testing::_, testing::_, testing::_, testing::_, testing::_, testing::_, testing::_, testing::_, testing::_, testing::_))
+        .WillOnce(testing::Return(SQL_ERROR));
+    expect_diagnostic_record(*api, expected_error);
+
+    level1_connector const connector(api);
+    EXPECT_THROW(connector.bind_numeric_input_parameter(handle, 1, SQL_DECIMAL, 18, 4, buffer), cpp_odbc::error);
+}
+
+TEST(Level1ConnectorTest, BindTableInputParameterCallsAPI)
+{
+    level2::statement_handle handle = {&value_a};
+    SQLUSMALLINT const parameter_id = 42;
+    std::u16string const type_name(u"dbo.row_type");
+    SQLULEN const maximum_rows = 1000;
+    SQLLEN row_count = 0;
+
+    auto api = std::make_shared<cpp_odbc_test::level1_mock_api const>();
+    EXPECT_CALL(*api, do_bind_parameter(handle.handle, parameter_id, SQL_PARAM_INPUT, SQL_C_DEFAULT, cpp_odbc::sql_ss_table, maximum_rows, 0, const_cast<char16_t *>(type_name.c_str()), SQL_NTS, &row_count))
+        .WillOnce(testing::Return(SQL_SUCCESS));
+
+    level1_connector const connector(api);
+    connector.bind_table_input_parameter(handle, parameter_id, type_name, maximum_rows, &row_count);
+}
+
+TEST(Level1ConnectorTest, BindTableInputParameterFails)
+{
+    level2::statement_handle handle = {&value_a};
+    SQLLEN row_count = 0;
+
+    auto api = std::make_shared<cpp_odbc_test::level1_mock_api const>();
+    EXPECT_CALL(*api, do_bind_parameter(testing::_, testing::_, testing::_, testing::_, testing::_, testing::_, testing::_, testing::_, testing::_, testing::_))
+        .WillOnce(testing::Return(SQL_ERROR));
+    expect_diagnostic_record(*api, expected_error);
+
+    level1_connector const connector(api);
+    EXPECT_THROW(connector.bind_table_input_parameter(handle, 1, u"dbo.row_type", 10, &row_count), cpp_odbc::error);
+}
+
 TEST(Level1ConnectorTest, ExecutePreparedStatementCallsAPI)
 {
     level2::statement_handle handle = {&value_a};
@@ -1036,6 +1172,77 @@ TEST(Level1ConnectorTest, SetPointerStatementAttributeFails)
     EXPECT_THROW( connector.set_statement_attribute(handle, attribute, &value), cpp_odbc::error );
 }
 
+TEST(Level1ConnectorTest, SetArrayStatementAttributeCallsAPI)
+{
+    level2::statement_handle handle = {&value_a};
+    SQLINTEGER const attribute = 42;
+    SQLUSMALLINT values[3] = {0, 0, 0};
+
+    auto api = std::make_shared<cpp_odbc_test::level1_mock_api const>();
+    EXPECT_CALL(*api, do_set_statement_attribute(handle.handle, attribute, values, SQL_IS_POINTER))
+        .WillOnce(testing::Return(SQL_SUCCESS));
+
+    level1_connector const connector(api);
+    connector.set_statement_attribute(handle, attribute, values);
+}
+
+TEST(Level1ConnectorTest, SetArrayStatementAttributeFails)
+{
+    level2::statement_handle handle = {&value_a};
+    SQLINTEGER const attribute = 42;
+    SQLUSMALLINT values[3] = {0, 0, 0};
+
+    auto api = std::make_shared<cpp_odbc_test::level1_mock_api const>();
+    EXPECT_CALL(*api, do_set_statement_attribute(testing::_, testing::_, testing::_, testing::_))
+        .WillOnce(testing::Return(SQL_ERROR));
+    expect_diagnostic_record(*api, expected_error);
+
+    level1_connector const connector(api);
+    EXPECT_THROW( connector.set_statement_attribute(handle, attribute, values), cpp_odbc::error );
+}
+
+TEST(Level1ConnectorTest, GetRowDiagnosticRecordsCallsAPI)
+{
+    level2::statement_handle const handle = {&value_a};
+    std::string const first_message = "first";
+    std::string const second_message = "second";
+
+    auto api = std::make_shared<cpp_odbc_test::level1_mock_api const>();
+    EXPECT_CALL(*api, do_get_diagnostic_record(SQL_HANDLE_STMT, handle.handle, 1, testing::_, testing::_, testing::_, SQL_MAX_MESSAGE_LENGTH, testing::_))
+        .WillOnce(testing::DoAll(
+                    testing::SetArrayArgument<5>(first_message.begin(), first_message.end()),
+                    testing::SetArgPointee<7>(first_message.size()),
+                    testing::Return(SQL_SUCCESS)
+                ));
+    EXPECT_CALL(*api, do_get_diagnostic_record(SQL_HANDLE_STMT, handle.handle, 2, testing::_, testing::_, testing::_, SQL_MAX_MESSAGE_LENGTH, testing::_))
+        .WillOnce(testing::DoAll(
+                    testing::SetArrayArgument<5>(second_message.begin(), second_message.end()),
+                    testing::SetArgPointee<7>(second_message.size()),
+                    testing::Return(SQL_SUCCESS_WITH_INFO)
+                ));
+    EXPECT_CALL(*api, do_get_diagnostic_record(SQL_HANDLE_STMT, handle.handle, 3, testing::_, testing::_, testing::_, testing::_, testing::_))
+        .WillOnce(testing::Return(SQL_NO_DATA));
+
+    EXPECT_CALL(*api, do_get_diagnostic_field(SQL_HANDLE_STMT, handle.handle, 1, SQL_DIAG_ROW_NUMBER, testing::_, testing::_, testing::_))
+        .WillOnce(testing::DoAll(
+                    testing::Invoke([](SQLSMALLINT, SQLHANDLE, SQLSMALLINT, SQLSMALLINT, SQLPOINTER field, SQLSMALLINT, SQLSMALLINT *) {
+                        *static_cast<SQLLEN *>(field) = 17;
+                    }),
+                    testing::Return(SQL_SUCCESS)
+                ));
+    EXPECT_CALL(*api, do_get_diagnostic_field(SQL_HANDLE_STMT, handle.handle, 2, SQL_DIAG_ROW_NUMBER, testing::_, testing::_, testing::_))
+        .WillOnce(testing::Return(SQL_ERROR));
+
+    level1_connector const connector(api);
+    auto const records = connector.get_row_diagnostic_records(handle);
+
+    ASSERT_EQ(2, records.size());
+    EXPECT_EQ(17, records[0].row_number);
+    EXPECT_EQ(first_message, records[0].record.message);
+    EXPECT_EQ(SQL_ROW_NUMBER_UNKNOWN, records[1].row_number);
+    EXPECT_EQ(second_message, records[1].record.message);
+}
+
 TEST(Level1ConnectorTest, RowCountCallsAPI)
 {
     level2::statement_handle handle = {&value_a};
@@ -1280,3 +1487,248 @@ TEST(Level1ConnectorTest, SupportsFunctionFails)
     level1_connector const connector(api);
     EXPECT_THROW(connector.supports_function(handle, function_id), cpp_odbc::error);
 }
+
+namespace {
+
+    SQLINTEGER const bulk_copy_variable_length = -10;
+
+    level2::bulk_copy_handle expect_bulk_copy_initialization(cpp_odbc_test::level1_mock_api const & mock, level2::connection_handle const & handle, int init_result)
+    {
+        level2::bulk_copy_handle const bulk_copy = {&value_b, handle};
+        EXPECT_CALL(mock, do_get_connection_info(handle.handle, SQL_DRIVER_HDBC, testing::_, sizeof(SQLHDBC), nullptr))
+            .WillOnce(testing::DoAll(
+                testing::WithArg<2>(testing::Invoke([=](SQLPOINTER destination) {
+                    *static_cast<SQLHDBC *>(destination) = bulk_copy.handle;
+                })),
+                testing::Return(SQL_SUCCESS)));
+        EXPECT_CALL(mock, do_bulk_copy_init(bulk_copy.handle, testing::_, nullptr, nullptr, 1))
+            .WillOnce(testing::Return(init_result));
+        return bulk_copy;
+    }
+
+}
+
+TEST(Level1ConnectorTest, InitializeBulkCopyCallsAPI)
+{
+    level2::connection_handle const handle = {&value_a};
+
+    auto api = std::make_shared<cpp_odbc_test::level1_mock_api const>();
+    auto const expected = expect_bulk_copy_initialization(*api, handle, 1);
+
+    level1_connector const connector(api);
+    auto const actual = connector.initialize_bulk_copy(handle, u"dbo.test");
+    EXPECT_EQ(expected, actual);
+    EXPECT_EQ(handle, actual.connection);
+}
+
+TEST(Level1ConnectorTest, InitializeBulkCopyFails)
+{
+    level2::connection_handle const handle = {&value_a};
+
+    auto api = std::make_shared<cpp_odbc_test::level1_mock_api const>();
+    expect_bulk_copy_initialization(*api, handle, 0);
+    expect_diagnostic_record(*api, expected_error);
+
+    level1_connector const connector(api);
+    EXPECT_THROW(connector.initialize_bulk_copy(handle, u"dbo.test"), cpp_odbc::error);
+}
+
+TEST(Level1ConnectorTest, InitializeBulkCopyFailsWithoutDiagnostics)
+{
+    level2::connection_handle const handle = {&value_a};
+
+    auto api = std::make_shared<cpp_odbc_test::level1_mock_api const>();
+    expect_bulk_copy_initialization(*api, handle, 0);
+    EXPECT_CALL(*api, do_get_diagnostic_record(testing::_, testing::_, testing::_, testing::_, testing::_, testing::_, testing::_, testing::_))
+        .WillOnce(testing::Return(SQL_NO_DATA));
+
+    level1_connector const connector(api);
+    try {
+        connector.initialize_bulk_copy(handle, u"dbo.test");
+        FAIL() << "Expected cpp_odbc::error";
+    } catch (cpp_odbc::error const & error) {
+        EXPECT_TRUE(std::string(error.what()).find("bcp_init") != std::string::npos);
+    }
+}
+
+TEST(Level1ConnectorTest, SetBulkCopyOptionCallsAPI)
+{
+    level2::bulk_copy_handle const handle = {&value_a, {&value_b}};
+    int const option = 4;
+    intptr_t const value = 1000;
+
+    auto api = std::make_shared<cpp_odbc_test::level1_mock_api const>();
+    EXPECT_CALL(*api, do_bulk_copy_control(handle.handle, option, reinterpret_cast<void *>(value)))
+        .WillOnce(testing::Return(1));
+
+    level1_connector const connector(api);
+    connector.set_bulk_copy_option(handle, option, value);
+}
+
+TEST(Level1ConnectorTest, SetBulkCopyHintsCallsAPI)
+{
+    level2::bulk_copy_handle const handle = {&value_a, {&value_b}};
+    std::u16string const hints(u"TABLOCK");
+    std::u16string actual_hints;
+
+    auto api = std::make_shared<cpp_odbc_test::level1_mock_api const>();
+    EXPECT_CALL(*api, do_bulk_copy_control(handle.handle, 11, testing::_))
+        .WillOnce(testing::DoAll(
+            testing::WithArg<2>(testing::Invoke([&](void * value) {
+                actual_hints = static_cast<char16_t const *>(value);
+            })),
+            testing::Return(1)));
+
+    level1_connector const connector(api);
+    connector.set_bulk_copy_hints(handle, hints);
+    EXPECT_EQ(hints, actual_hints);
+}
+
+TEST(Level1ConnectorTest, SetBulkCopyHintsFails)
+{
+    level2::bulk_copy_handle const handle = {&value_a, {&value_b}};
+
+    auto api = std::make_shared<cpp_odbc_test::level1_mock_api const>();
+    EXPECT_CALL(*api, do_bulk_copy_control(handle.handle, testing::_, testing::_))
+        .WillOnce(testing::Return(0));
+    expect_diagnostic_record(*api, expected_error);
+
+    level1_connector const connector(api);
+    EXPECT_THROW(connector.set_bulk_copy_hints(handle, u"TABLOCK"), cpp_odbc::error);
+}
+
+TEST(Level1ConnectorTest, BindBulkCopyColumnCallsAPI)
+{
+    level2::bulk_copy_handle const handle = {&value_a, {&value_b}};
+    int const column_id = 3;
+    int const data_type = 0x38;
+
+    auto api = std::make_shared<cpp_odbc_test::level1_mock_api const>();
+    EXPECT_CALL(*api, do_bulk_copy_bind(handle.handle, testing::NotNull(), 0, bulk_copy_variable_length, nullptr, 0, data_type, column_id))
+        .WillOnce(testing::Return(1));
+
+    level1_connector const connector(api);
+    connector.bind_bulk_copy_column(handle, column_id, data_type);
+}
+
+TEST(Level1ConnectorTest, BindBulkCopyColumnFails)
+{
+    level2::bulk_copy_handle const handle = {&value_a, {&value_b}};
+
+    auto api = std::make_shared<cpp_odbc_test::level1_mock_api const>();
+    EXPECT_CALL(*api, do_bulk_copy_bind(handle.handle, testing::_, testing::_, testing::_, testing::_, testing::_, testing::_, testing::_))
+        .WillOnce(testing::Return(0));
+    expect_diagnostic_record(*api, expected_error);
+
+    level1_connector const connector(api);
+    EXPECT_THROW(connector.bind_bulk_copy_column(handle, 1, 0x38), cpp_odbc::error);
+}
+
+TEST(Level1ConnectorTest, SetBulkCopyColumnDataCallsAPI)
+{
+    level2::bulk_copy_handle const handle = {&value_a, {&value_b}};
+    int const column_id = 3;
+    SQLINTEGER const length = sizeof(value_b);
+    auto const data = reinterpret_cast<unsigned char const *>(&value_b);
+
+    auto api = std::make_shared<cpp_odbc_test::level1_mock_api const>();
+    EXPECT_CALL(*api, do_bulk_copy_column_pointer(handle.handle, data, column_id))
+        .WillOnce(testing::Return(1));
+    EXPECT_CALL(*api, do_bulk_copy_column_length(handle.handle, length, column_id))
+        .WillOnce(testing::Return(1));
+
+    level1_connector const connector(api);
+    connector.set_bulk_copy_column_data(handle, column_id, &value_b, length);
+}
+
+TEST(Level1ConnectorTest, SetBulkCopyColumnDataFails)
+{
+    level2::bulk_copy_handle const handle = {&value_a, {&value_b}};
+
+    auto api = std::make_shared<cpp_odbc_test::level1_mock_api const>();
+    EXPECT_CALL(*api, do_bulk_copy_column_pointer(handle.handle, testing::_, testing::_))
+        .WillOnce(testing::Return(1));
+    EXPECT_CALL(*api, do_bulk_copy_column_length(handle.handle, testing::_, testing::_))
+        .WillOnce(testing::Return(0));
+    expect_diagnostic_record(*api, expected_error);
+
+    level1_connector const connector(api);
+    EXPECT_THROW(connector.set_bulk_copy_column_data(handle, 1, &value_b, SQL_NULL_DATA), cpp_odbc::error);
+}
+
+TEST(Level1ConnectorTest, SendBulkCopyRowCallsAPI)
+{
+    level2::bulk_copy_handle const handle = {&value_a, {&value_b}};
+
+    auto api = std::make_shared<cpp_odbc_test::level1_mock_api const>();
+    EXPECT_CALL(*api, do_bulk_copy_send_row(handle.handle))
+        .WillOnce(testing::Return(1));
+
+    level1_connector const connector(api);
+    connector.send_bulk_copy_row(handle);
+}
+
+TEST(Level1ConnectorTest, SendBulkCopyRowFails)
+{
+    level2::bulk_copy_handle const handle = {&value_a, {&value_b}};
+
+    auto api = std::make_shared<cpp_odbc_test::level1_mock_api const>();
+    EXPECT_CALL(*api, do_bulk_copy_send_row(handle.handle))
+        .WillOnce(testing::Return(0));
+    expect_diagnostic_record(*api, expected_error);
+
+    level1_connector const connector(api);
+    EXPECT_THROW(connector.send_bulk_copy_row(handle), cpp_odbc::error);
+}
+
+TEST(Level1ConnectorTest, CommitBulkCopyBatchCallsAPI)
+{
+    level2::bulk_copy_handle const handle = {&value_a, {&value_b}};
+    SQLINTEGER const expected = 1000;
+
+    auto api = std::make_shared<cpp_odbc_test::level1_mock_api const>();
+    EXPECT_CALL(*api, do_bulk_copy_batch(handle.handle))
+        .WillOnce(testing::Return(expected));
+
+    level1_connector const connector(api);
+    EXPECT_EQ(expected, connector.commit_bulk_copy_batch(handle));
+}
+
+TEST(Level1ConnectorTest, CommitBulkCopyBatchFails)
+{
+    level2::bulk_copy_handle const handle = {&value_a, {&value_b}};
+
+    auto api = std::make_shared<cpp_odbc_test::level1_mock_api const>();
+    EXPECT_CALL(*api, do_bulk_copy_batch(handle.handle))
+        .WillOnce(testing::Return(-1));
+    expect_diagnostic_record(*api, expected_error);
+
+    level1_connector const connector(api);
+    EXPECT_THROW(connector.commit_bulk_copy_batch(handle), cpp_odbc::error);
+}
+
+TEST(Level1ConnectorTest, FinishBulkCopyCallsAPI)
+{
+    level2::bulk_copy_handle const handle = {&value_a, {&value_b}};
+    SQLINTEGER const expected = 42;
+
+    auto api = std::make_shared<cpp_odbc_test::level1_mock_api const>();
+    EXPECT_CALL(*api, do_bulk_copy_done(handle.handle))
+        .WillOnce(testing::Return(expected));
+
+    level1_connector const connector(api);
+    EXPECT_EQ(expected, connector.finish_bulk_copy(handle));
+}
+
+TEST(Level1ConnectorTest, FinishBulkCopyFails)
+{
+    level2::bulk_copy_handle const handle = {&value_a, {&value_b}};
+
+    auto api = std::make_shared<cpp_odbc_test::level1_mock_api const>();
+    EXPECT_CALL(*api, do_bulk_copy_done(handle.handle))
+        .WillOnce(testing::Return(-1));
+    expect_diagnostic_record(*api, expected_error);
+
+    level1_connector const connector(api);
+    EXPECT_THROW(connector.finish_bulk_copy(handle), cpp_odbc::error);
+}
@@ -73,6 +73,22 @@ TEST(RaiiConnectionTest, RaiiConnectAndDisconnect)
 	}
 }
 
+TEST(RaiiConnectionTest, SetsAttributesBeforeConnecting)
+{
+	auto api = make_default_api();
+	auto environment = std::make_shared<raii_environment>(api);
+	cpp_odbc::connection_attributes const attributes = {{1219, 1}, {42, 17}};
+
+	{
+		testing::InSequence sequence;
+		EXPECT_CALL(*api, do_set_connection_attribute(default_c_handle, 1219, 1)).Times(1);
+		EXPECT_CALL(*api, do_set_connection_attribute(default_c_handle, 42, 17)).Times(1);
+		EXPECT_CALL(*api, do_establish_connection(testing::_, "dummy")).Times(1);
+	}
+
+	raii_connection connection(environment, "dummy", attributes);
+}
+
 TEST(RaiiConnectionTest, KeepsEnvironmentAlive)
 {
 	auto api = make_default_api();
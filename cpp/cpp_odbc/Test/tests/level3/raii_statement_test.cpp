@@ -150,6 +150,20 @@ TEST(RaiiStatementTest, SetPointerAttribute)
     statement.set_attribute(attribute, &value);
 }
 
+TEST(RaiiStatementTest, SetArrayAttribute)
+{
+    SQLINTEGER const attribute = 42;
+    SQLUSMALLINT values[3] = {0, 0, 0};
+
+    auto api = make_default_api();
+    auto environment = std::make_shared<raii_environment>(api);
+    auto connection = std::make_shared<raii_connection>(environment, "dummy");
+    EXPECT_CALL(*api, do_set_statement_attribute(default_s_handle, attribute, values)).Times(1);
+
+    raii_statement statement(connection);
+    statement.set_attribute(attribute, values);
+}
+
 TEST(RaiiStatementTest, Execute)
 {
     std::string const sql = "SELECT dummy FROM test";
@@ -206,6 +220,39 @@ TEST(RaiiStatementTest, BindInputParameter)
     statement.bind_input_parameter(parameter_id, value_type, parameter_type, digits, parameter_values);
 }
 
+TEST(RaiiStatementTest, BindNumericInputParameter)
+{
+    SQLUSMALLINT const parameter_id = 17;
+    SQLSMALLINT const parameter_type = 42;
+    SQLSMALLINT const precision = 18;
+    SQLSMALLINT const scale = 5;
+    cpp_odbc::multi_value_buffer parameter_values(3, 4);
+
+    auto api = make_default_api();
+    auto environment = std::make_shared<raii_environment>(api);
+    auto connection = std::make_shared<raii_connection>(environment, "dummy");
+    EXPECT_CALL(*api, do_bind_numeric_input_parameter(default_s_handle, parameter_id, parameter_type, precision, scale, testing::Ref(parameter_values))).Times(1);
+
+    raii_statement statement(connection);
+    statement.bind_numeric_input_parameter(parameter_id, parameter_type, precision, scale, parameter_values);
+}
+
+TEST(RaiiStatementTest, BindTableInputParameter)
+{
+    SQLUSMALLINT const parameter_id = 17;
+    std::u16string const type_name(u"dbo.row_type");
+    SQLULEN const maximum_rows = 1000;
+    SQLLEN row_count = 0;
+
+    auto api = make_default_api();
+    auto environment = std::make_shared<raii_environment>(api);
+    auto connection = std::make_shared<raii_connection>(environment, "dummy");
+    EXPECT_CALL(*api, do_bind_table_input_parameter(default_s_handle, parameter_id, type_name, maximum_rows, &row_count)).Times(1);
+
+    raii_statement statement(connection);
+    statement.bind_table_input_parameter(parameter_id, type_name, maximum_rows, &row_count);
+}
+
 TEST(RaiiStatementTest, UnbindAllParameters)
 {
     auto api = make_default_api();
@@ -271,6 +318,22 @@ TEST(RaiiStatementTest, BindColumn)
     statement.bind_column(column_id, column_type, column_buffer);
 }
 
+TEST(RaiiStatementTest, BindNumericColumn)
+{
+    SQLUSMALLINT const column_id = 17;
+    SQLSMALLINT const precision = 18;
+    SQLSMALLINT const scale = 5;
+    cpp_odbc::multi_value_buffer column_buffer(3, 4);
+
+    auto api = make_default_api();
+    auto environment = std::make_shared<raii_environment>(api);
+    auto connection = std::make_shared<raii_connection>(environment, "dummy");
+    EXPECT_CALL(*api, do_bind_numeric_column(default_s_handle, column_id, precision, scale, testing::Ref(column_buffer))).Times(1);
+
+    raii_statement statement(connection);
+    statement.bind_numeric_column(column_id, precision, scale, column_buffer);
+}
+
 TEST(RaiiStatementTest, UnbindAllColumns)
 {
     auto api = make_default_api();
@@ -350,6 +413,22 @@ TEST(RaiiStatementTest, RowCount)
     EXPECT_EQ( expected, statement.row_count());
 }
 
+TEST(RaiiStatementTest, GetRowDiagnosticRecords)
+{
+    std::vector<cpp_odbc::level2::row_diagnostic_record> const expected = {{3, {"ABCDE", 23, "message"}}};
+
+    auto api = make_default_api();
+    auto environment = std::make_shared<raii_environment>(api);
+    auto connection = std::make_shared<raii_connection>(environment, "dummy");
+    EXPECT_CALL(*api, do_get_row_diagnostic_records(default_s_handle))
+        .WillOnce(testing::Return(expected));
+
+    raii_statement statement(connection);
+    auto const actual = statement.get_row_diagnostic_records();
+    ASSERT_EQ(1, actual.size());
+    EXPECT_EQ(3, actual[0].row_number);
+}
+
 TEST(RaiiStatementTest, DescribeColumn)
 {
     SQLUSMALLINT const column_id = 23;
@@ -120,3 +120,49 @@ TEST(MultiValueBufferTest, MoveConstructor)
 	element.indicator = 42;
 	std::strcpy(element.data_pointer, "abc");
 }
+
+TEST(MultiValueBufferTest, ExternalData)
+{
+	std::size_t const element_size = 3;
+	std::size_t const number_of_elements = 2;
+	multi_value_buffer buffer(element_size, number_of_elements);
+	char * const internal_data = buffer.data_pointer();
+	EXPECT_FALSE(buffer.uses_external_data());
+
+	std::vector<char> external(element_size * number_of_elements, 0);
+	buffer.use_external_data(external.data());
+	EXPECT_TRUE(buffer.uses_external_data());
+	EXPECT_EQ(external.data(), buffer.data_pointer());
+
+	std::strcpy(buffer[1].data_pointer, "de");
+	EXPECT_EQ(0, std::memcmp(external.data() + element_size, "de", 3));
+
+	auto const & const_buffer = buffer;
+	EXPECT_EQ(external.data(), const_buffer.data_pointer());
+	EXPECT_EQ(external.data() + element_size, const_buffer[1].data_pointer);
+
+	buffer.use_external_data(nullptr);
+	EXPECT_FALSE(buffer.uses_external_data());
+	EXPECT_EQ(internal_data, buffer.data_pointer());
+}
+
+TEST(MultiValueBufferTest, ResizeKeepsValues)
+{
+	std::size_t const element_size = 3;
+	multi_value_buffer buffer(element_size, 2);
+	std::strcpy(buffer[1].data_pointer, "ab");
+	buffer[1].indicator = 2;
+
+	buffer.resize(5);
+	EXPECT_EQ(5, buffer.number_of_elements());
+	EXPECT_EQ(element_size, buffer.capacity_per_element());
+	EXPECT_STREQ("ab", buffer[1].data_pointer);
+	EXPECT_EQ(2, buffer[1].indicator);
+	EXPECT_EQ(0, buffer[4].indicator);
+
+	buffer.resize(2);
+	EXPECT_EQ(2, buffer.number_of_elements());
+	EXPECT_STREQ("ab", buffer[1].data_pointer);
+
+	EXPECT_THROW(buffer.resize(0), std::logic_error);
+}
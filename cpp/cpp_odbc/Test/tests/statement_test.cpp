@@ -43,6 +43,17 @@ TEST(StatementTest, SetPointerAttributeForwards)
     statement.set_attribute(attribute, &value);
 }
 
+TEST(StatementTest, SetArrayAttributeForwards)
+{
+    SQLINTEGER const attribute = 23;
+    SQLUSMALLINT values[3] = {0, 0, 0};
+
+    mock_statement statement;
+    EXPECT_CALL( statement, do_set_attribute(attribute, values)).Times(1);
+
+    statement.set_attribute(attribute, values);
+}
+
 TEST(StatementTest, ExecuteForwards)
 {
     std::string const query = "SELECT * FROM dummy";
@@ -87,6 +98,33 @@ TEST(StatementTest, BindInputParameterForwards)
     statement.bind_input_parameter(parameter, value_type, parameter_type, digits, values);
 }
 
+TEST(StatementTest, BindNumericInputParameterForwards)
+{
+    SQLUSMALLINT const parameter = 17;
+    SQLSMALLINT const parameter_type = 42;
+    SQLSMALLINT const precision = 18;
+    SQLSMALLINT const scale = 5;
+    cpp_odbc::multi_value_buffer values(2,3);
+
+    mock_statement statement;
+    EXPECT_CALL( statement, do_bind_numeric_input_parameter(parameter, parameter_type, precision, scale, testing::Ref(values))).Times(1);
+
+    statement.bind_numeric_input_parameter(parameter, parameter_type, precision, scale, values);
+}
+
+TEST(StatementTest, BindTableInputParameterForwards)
+{
+    SQLUSMALLINT const parameter = 17;
+    std::u16string const type_name(u"dbo.row_type");
+    SQLULEN const maximum_rows = 1000;
+    SQLLEN row_count = 0;
+
+    mock_statement statement;
+    EXPECT_CALL( statement, do_bind_table_input_parameter(parameter, type_name, maximum_rows, &row_count)).Times(1);
+
+    statement.bind_table_input_parameter(parameter, type_name, maximum_rows, &row_count);
+}
+
 TEST(StatementTest, UnbindAllParametersForwards)
 {
     mock_statement statement;
@@ -138,6 +176,19 @@ TEST(StatementTest, BindColumnForwards)
     statement.bind_column(column, column_type, values);
 }
 
+TEST(StatementTest, BindNumericColumnForwards)
+{
+    SQLUSMALLINT const column = 17;
+    SQLSMALLINT const precision = 18;
+    SQLSMALLINT const scale = 5;
+    cpp_odbc::multi_value_buffer values(2,3);
+
+    mock_statement statement;
+    EXPECT_CALL( statement, do_bind_numeric_column(column, precision, scale, testing::Ref(values))).Times(1);
+
+    statement.bind_numeric_column(column, precision, scale, values);
+}
+
 TEST(StatementTest, UnbindAllColumnsForwards)
 {
     mock_statement statement;
@@ -200,6 +251,19 @@ TEST(StatementTest, RowCountForwards)
     EXPECT_EQ( expected, statement.row_count() );
 }
 
+TEST(StatementTest, GetRowDiagnosticRecordsForwards)
+{
+    std::vector<cpp_odbc::level2::row_diagnostic_record> const expected = {{5, {"ABCDE", 23, "message"}}};
+
+    mock_statement statement;
+    EXPECT_CALL( statement, do_get_row_diagnostic_records())
+        .WillOnce(testing::Return(expected));
+
+    auto const actual = statement.get_row_diagnostic_records();
+    ASSERT_EQ(1, actual.size());
+    EXPECT_EQ(5, actual[0].row_number);
+}
+
 TEST(StatementTest, DescribeColumnForwards)
 {
     SQLUSMALLINT const column_id = 23;
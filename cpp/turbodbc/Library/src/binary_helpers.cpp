@@ -0,0 +1,55 @@
+#include <turbodbc/binary_helpers.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+#include <sql.h>
+
+#include <cstring>
+
+namespace turbodbc {
+
+uint64_t rowversion_to_integer(char const * data_pointer)
+{
+    auto const bytes = reinterpret_cast<uint8_t const *>(data_pointer);
+    uint64_t value = 0;
+    for (std::size_t i = 0; i != sizeof(uint64_t); ++i) {
+        value = (value << 8) | bytes[i];
+    }
+    return value;
+}
+
+void guid_to_bytes(char const * data_pointer, uint8_t * bytes)
+{
+    auto const & guid = *reinterpret_cast<SQLGUID const *>(data_pointer);
+    for (std::size_t i = 0; i != 4; ++i) {
+        bytes[i] = static_cast<uint8_t>(guid.Data1 >> (8 * (3 - i)));
+    }
+    bytes[4] = static_cast<uint8_t>(guid.Data2 >> 8);
+    bytes[5] = static_cast<uint8_t>(guid.Data2);
+    bytes[6] = static_cast<uint8_t>(guid.Data3 >> 8);
+    bytes[7] = static_cast<uint8_t>(guid.Data3);
+    std::memcpy(bytes + 8, guid.Data4, sizeof(guid.Data4));
+}
+
+void guids_to_bytes(char const * data_pointer, intptr_t const * indicators,
+                    std::size_t n_values, uint8_t * bytes)
+{
+    for (std::size_t i = 0; i != n_values; ++i) {
+        if (indicators[i] == SQL_NULL_DATA) {
+            std::memset(bytes + 16 * i, 0, 16);
+        } else {
+            guid_to_bytes(data_pointer + i * sizeof(SQLGUID), bytes + 16 * i);
+        }
+    }
+}
+
+void rowversions_to_integers(char const * data_pointer, intptr_t const * indicators,
+                             std::size_t n_values, uint64_t * values)
+{
+    for (std::size_t i = 0; i != n_values; ++i) {
+        values[i] = (indicators[i] == SQL_NULL_DATA) ? 0 : rowversion_to_integer(data_pointer + i * sizeof(uint64_t));
+    }
+}
+
+}
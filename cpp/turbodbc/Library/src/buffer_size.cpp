@@ -1,5 +1,7 @@
 #include <turbodbc/buffer_size.h>
 
+#include <algorithm>
+
 namespace turbodbc {
 
 
@@ -58,4 +60,19 @@ buffer_size halve_buffer_size::operator()(megabytes const& m) const
     return {megabytes((m.value + 1) / 2)};
 }
 
+split_buffer_size::split_buffer_size(std::size_t parts) :
+    parts_(parts == 0 ? 1 : parts)
+{
+}
+
+buffer_size split_buffer_size::operator()(rows const& r) const
+{
+    return {rows(std::max<std::size_t>((r.value + parts_ - 1) / parts_, 1))};
+}
+
+buffer_size split_buffer_size::operator()(megabytes const& m) const
+{
+    return {megabytes(std::max<std::size_t>((m.value + parts_ - 1) / parts_, 1))};
+}
+
 }
\ No newline at end of file
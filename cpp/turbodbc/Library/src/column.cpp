@@ -12,7 +12,17 @@ column::column(cpp_odbc::statement const & statement, std::size_t one_based_inde
 
 void column::bind()
 {
-	statement_.bind_column(one_based_index_, description_->column_c_type(), buffer_);
+	if (description_->get_type_code() == type_code::decimal) {
+		statement_.bind_numeric_column(one_based_index_, description_->precision(), description_->digits(), buffer_);
+	} else {
+		statement_.bind_column(one_based_index_, description_->column_c_type(), buffer_);
+	}
+}
+
+void column::bind_external_data(char * data)
+{
+	buffer_.use_external_data(data);
+	bind();
 }
 
 column::column(column && other) :
@@ -27,7 +37,12 @@ column::~column() = default;
 
 column_info column::get_info() const
 {
-	return {description_->name(), description_->get_type_code(), description_->element_size(), description_->supports_null_values()};
+	column_info info = {description_->name(), description_->get_type_code(), description_->element_size(), description_->supports_null_values()};
+	if (info.type == type_code::decimal) {
+		info.precision = description_->precision();
+		info.scale = description_->digits();
+	}
+	return info;
 }
 
 cpp_odbc::multi_value_buffer const & column::get_buffer() const
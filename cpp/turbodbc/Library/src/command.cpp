@@ -25,6 +25,7 @@ command::~command()
 void command::execute()
 {
     if (params_.get_parameters().empty()) {
+        params_.ensure_bound();
         statement_->execute_prepared();
     }
 
@@ -48,6 +49,20 @@ bound_parameter_set & command::get_parameters()
     return params_;
 }
 
+std::unique_ptr<bound_parameter_set> command::make_parameters_bound_on_execute()
+{
+    // the new set takes over the statement's parameter bindings and attributes
+    params_.invalidate_bindings();
+    return std::unique_ptr<bound_parameter_set>(new bound_parameter_set(*statement_, configuration_, true));
+}
+
+std::unique_ptr<bound_parameter_set> command::make_table_parameter(std::u16string table_type_name, std::size_t number_of_columns)
+{
+    // the table type name, row count and column buffers of the new set replace the bindings
+    params_.invalidate_bindings();
+    return std::unique_ptr<bound_parameter_set>(new bound_parameter_set(*statement_, configuration_, std::move(table_type_name), number_of_columns));
+}
+
 int64_t command::get_row_count()
 {
     bool const has_result_set = (statement_->number_of_columns() != 0);
@@ -64,6 +79,11 @@ int64_t command::get_row_count()
 
 void command::finalize()
 {
+    if (results_) {
+        // others, e.g. a pipelined Arrow reader, may still hold the result set
+        results_->close();
+        results_.reset();
+    }
     const_cast<cpp_odbc::statement &>(*statement_).finalize();
 }
 
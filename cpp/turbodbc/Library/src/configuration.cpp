@@ -14,7 +14,18 @@ options::options() :
     large_decimals_as_64_bit_types(false),
     limit_varchar_results_to_max(false),
     force_extra_capacity_for_unicode(false),
-    fetch_wchar_as_char(false)
+    fetch_wchar_as_char(false),
+    fetch_narrow_numeric_types(false),
+    fetch_exact_decimals(false),
+    fetch_rowversion_as_integer(false),
+    fetch_nanosecond_timestamps(false),
+    presize_string_parameters(false),
+    enable_bulk_copy(false),
+    adaptive_parameter_sets(false),
+    parameter_buffer_megabytes(64),
+    parameter_batch_milliseconds(1000),
+    parameter_set_retries(0),
+    prefetch_slots(2)
 {
 }
 
@@ -1,8 +1,13 @@
 #include "turbodbc/connect.h"
+#include "turbodbc/sql_server_types.h"
 #include <cpp_odbc/make_environment.h>
 
 turbodbc::connection turbodbc::connect(std::string const & connection_string, options options)
 {
 	auto environment = cpp_odbc::make_environment();
-	return {environment->make_connection(connection_string), std::move(options)};
+	cpp_odbc::connection_attributes attributes;
+	if (options.enable_bulk_copy) {
+		attributes.emplace_back(sql_copt_ss_bcp, sql_bcp_on);
+	}
+	return {environment->make_connection(connection_string, attributes), std::move(options)};
 }
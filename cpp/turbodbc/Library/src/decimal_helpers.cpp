@@ -0,0 +1,170 @@
+#include <turbodbc/decimal_helpers.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+#include <sql.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace turbodbc {
+
+namespace {
+
+    // SQL_NUMERIC_STRUCT stores the magnitude in val and sign = 1 for positive values
+    std::size_t const sign_offset = offsetof(SQL_NUMERIC_STRUCT, sign);
+    std::size_t const value_offset = offsetof(SQL_NUMERIC_STRUCT, val);
+    std::size_t const decimal_size = 16;
+
+    inline uint64_t load_little_endian(uint8_t const * bytes)
+    {
+        uint64_t value = 0;
+        for (int i = 7; i >= 0; --i) {
+            value = (value << 8) | bytes[i];
+        }
+        return value;
+    }
+
+    inline void store_little_endian(uint64_t value, uint8_t * bytes)
+    {
+        for (int i = 0; i != 8; ++i) {
+            bytes[i] = static_cast<uint8_t>(value >> (8 * i));
+        }
+    }
+
+    inline void negate(uint64_t & low, uint64_t & high)
+    {
+        low = ~low + 1;
+        high = ~high + (low == 0);
+    }
+
+    void decimals_to_numerics(uint8_t const * decimals, std::size_t decimal_width, std::size_t n_values,
+                              int precision, int scale, char * data_pointer)
+    {
+        for (std::size_t i = 0; i != n_values; ++i) {
+            auto const source = decimals + i * decimal_width;
+            auto const numeric = reinterpret_cast<uint8_t *>(data_pointer) + i * sizeof(SQL_NUMERIC_STRUCT);
+            uint64_t low = load_little_endian(source);
+            uint64_t high = load_little_endian(source + 8);
+            bool const is_negative = (high >> 63) != 0;
+            if (is_negative) {
+                negate(low, high);
+            }
+            auto & target = *reinterpret_cast<SQL_NUMERIC_STRUCT *>(numeric);
+            target.precision = static_cast<SQLCHAR>(precision);
+            target.scale = static_cast<SQLSCHAR>(scale);
+            target.sign = is_negative ? 0 : 1;
+            store_little_endian(low, numeric + value_offset);
+            store_little_endian(high, numeric + value_offset + 8);
+        }
+    }
+
+    // Divides the 128 bit magnitude in place and returns the remainder
+    inline unsigned int divide_by_ten(uint32_t (&limbs)[4])
+    {
+        uint64_t remainder = 0;
+        for (int i = 3; i >= 0; --i) {
+            uint64_t const current = (remainder << 32) | limbs[i];
+            limbs[i] = static_cast<uint32_t>(current / 10);
+            remainder = current % 10;
+        }
+        return static_cast<unsigned int>(remainder);
+    }
+
+}
+
+void numerics_to_decimal128(char const * data_pointer, intptr_t const * indicators,
+                            std::size_t n_values, uint8_t * decimals)
+{
+    for (std::size_t i = 0; i != n_values; ++i) {
+        auto const numeric = reinterpret_cast<uint8_t const *>(data_pointer) + i * sizeof(SQL_NUMERIC_STRUCT);
+        auto const destination = decimals + i * decimal_size;
+        if (indicators[i] == SQL_NULL_DATA) {
+            std::memset(destination, 0, decimal_size);
+            continue;
+        }
+        uint64_t low = load_little_endian(numeric + value_offset);
+        uint64_t high = load_little_endian(numeric + value_offset + 8);
+        if (numeric[sign_offset] == 0) {
+            negate(low, high);
+        }
+        store_little_endian(low, destination);
+        store_little_endian(high, destination + 8);
+    }
+}
+
+void decimal128_to_numerics(uint8_t const * decimals, std::size_t n_values,
+                            int precision, int scale, char * data_pointer)
+{
+    decimals_to_numerics(decimals, decimal_size, n_values, precision, scale, data_pointer);
+}
+
+void decimal256_to_numerics(uint8_t const * decimals, std::size_t n_values,
+                            int precision, int scale, char * data_pointer)
+{
+    decimals_to_numerics(decimals, 2 * decimal_size, n_values, precision, scale, data_pointer);
+}
+
+void uint64_to_numerics(uint64_t const * values, std::size_t n_values, char * data_pointer)
+{
+    for (std::size_t i = 0; i != n_values; ++i) {
+        auto const numeric = reinterpret_cast<uint8_t *>(data_pointer) + i * sizeof(SQL_NUMERIC_STRUCT);
+        auto & target = *reinterpret_cast<SQL_NUMERIC_STRUCT *>(numeric);
+        target.precision = 20;
+        target.scale = 0;
+        target.sign = 1;
+        store_little_endian(values[i], numeric + value_offset);
+        store_little_endian(0, numeric + value_offset + 8);
+    }
+}
+
+void numerics_to_doubles(char const * data_pointer, intptr_t const * indicators,
+                         std::size_t n_values, int scale, double * values)
+{
+    double const two_to_the_64 = 18446744073709551616.0;
+    double const divisor = std::pow(10.0, scale);
+    for (std::size_t i = 0; i != n_values; ++i) {
+        auto const numeric = reinterpret_cast<uint8_t const *>(data_pointer) + i * sizeof(SQL_NUMERIC_STRUCT);
+        if (indicators[i] == SQL_NULL_DATA) {
+            values[i] = 0.0;
+            continue;
+        }
+        double const magnitude = static_cast<double>(load_little_endian(numeric + value_offset + 8)) * two_to_the_64
+                               + static_cast<double>(load_little_endian(numeric + value_offset));
+        values[i] = (numeric[sign_offset] == 0 ? -magnitude : magnitude) / divisor;
+    }
+}
+
+std::string numeric_to_string(char const * data_pointer, int scale)
+{
+    auto const numeric = reinterpret_cast<uint8_t const *>(data_pointer);
+    uint32_t limbs[4];
+    for (int i = 0; i != 4; ++i) {
+        limbs[i] = static_cast<uint32_t>(load_little_endian(numeric + value_offset + 4 * i));
+    }
+
+    // collect digits in reverse order
+    std::string digits;
+    do {
+        digits.push_back(static_cast<char>('0' + divide_by_ten(limbs)));
+    } while (limbs[0] != 0 or limbs[1] != 0 or limbs[2] != 0 or limbs[3] != 0);
+
+    bool const is_zero = (digits == "0");
+    if (scale > 0) {
+        if (digits.size() <= static_cast<std::size_t>(scale)) {
+            digits.append(scale + 1 - digits.size(), '0');
+        }
+        digits.insert(digits.begin() + scale, '.');
+    } else if (scale < 0 and not is_zero) {
+        digits.insert(digits.begin(), -scale, '0');
+    }
+    if (numeric[sign_offset] == 0 and not is_zero) {
+        digits.push_back('-');
+    }
+    std::reverse(digits.begin(), digits.end());
+    return digits;
+}
+
+}
@@ -36,6 +36,16 @@ SQLSMALLINT description::digits() const
 	return do_digits();
 }
 
+SQLSMALLINT description::precision() const
+{
+	return do_precision();
+}
+
+SQLSMALLINT description::do_precision() const
+{
+	return 0;
+}
+
 type_code description::get_type_code() const
 {
 	return do_get_type_code();
@@ -0,0 +1,46 @@
+#include <turbodbc/descriptions/binary_description.h>
+
+#include <sqlext.h>
+
+namespace turbodbc {
+
+binary_description::binary_description(std::size_t maximum_length) :
+	maximum_length_(maximum_length)
+{
+}
+
+binary_description::binary_description(std::string name, bool supports_null, std::size_t maximum_length) :
+	description(std::move(name), supports_null),
+	maximum_length_(maximum_length)
+{
+}
+
+binary_description::~binary_description() = default;
+
+std::size_t binary_description::do_element_size() const
+{
+	// binary data is not null-terminated
+	return maximum_length_;
+}
+
+SQLSMALLINT binary_description::do_column_c_type() const
+{
+	return SQL_C_BINARY;
+}
+
+SQLSMALLINT binary_description::do_column_sql_type() const
+{
+	return SQL_VARBINARY;
+}
+
+SQLSMALLINT binary_description::do_digits() const
+{
+	return 0;
+}
+
+type_code binary_description::do_get_type_code() const
+{
+	return type_code::binary;
+}
+
+}
@@ -0,0 +1,52 @@
+#include <turbodbc/descriptions/decimal_description.h>
+
+#include <sqlext.h>
+
+namespace turbodbc {
+
+decimal_description::decimal_description(SQLSMALLINT precision, SQLSMALLINT scale) :
+	precision_(precision),
+	scale_(scale)
+{
+}
+
+decimal_description::decimal_description(std::string name, bool supports_null, SQLSMALLINT precision, SQLSMALLINT scale) :
+	description(std::move(name), supports_null),
+	precision_(precision),
+	scale_(scale)
+{
+}
+
+decimal_description::~decimal_description() = default;
+
+std::size_t decimal_description::do_element_size() const
+{
+	return sizeof(SQL_NUMERIC_STRUCT);
+}
+
+SQLSMALLINT decimal_description::do_column_c_type() const
+{
+	return SQL_C_NUMERIC;
+}
+
+SQLSMALLINT decimal_description::do_column_sql_type() const
+{
+	return SQL_DECIMAL;
+}
+
+SQLSMALLINT decimal_description::do_digits() const
+{
+	return scale_;
+}
+
+type_code decimal_description::do_get_type_code() const
+{
+	return type_code::decimal;
+}
+
+SQLSMALLINT decimal_description::do_precision() const
+{
+	return precision_;
+}
+
+}
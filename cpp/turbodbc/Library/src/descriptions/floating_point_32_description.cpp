@@ -0,0 +1,41 @@
+#include <turbodbc/descriptions/floating_point_32_description.h>
+
+#include <sqlext.h>
+
+namespace turbodbc {
+
+floating_point_32_description::floating_point_32_description() = default;
+
+floating_point_32_description::floating_point_32_description(std::string name, bool supports_null) :
+	description(std::move(name), supports_null)
+{
+}
+
+floating_point_32_description::~floating_point_32_description() = default;
+
+std::size_t floating_point_32_description::do_element_size() const
+{
+	return sizeof(float);
+}
+
+SQLSMALLINT floating_point_32_description::do_column_c_type() const
+{
+	return SQL_C_FLOAT;
+}
+
+SQLSMALLINT floating_point_32_description::do_column_sql_type() const
+{
+	return SQL_REAL;
+}
+
+SQLSMALLINT floating_point_32_description::do_digits() const
+{
+	return 0;
+}
+
+type_code floating_point_32_description::do_get_type_code() const
+{
+	return type_code::floating_point_32;
+}
+
+}
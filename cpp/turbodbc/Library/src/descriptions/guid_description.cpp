@@ -0,0 +1,41 @@
+#include <turbodbc/descriptions/guid_description.h>
+
+#include <sqlext.h>
+
+namespace turbodbc {
+
+guid_description::guid_description() = default;
+
+guid_description::guid_description(std::string name, bool supports_null) :
+	description(std::move(name), supports_null)
+{
+}
+
+guid_description::~guid_description() = default;
+
+std::size_t guid_description::do_element_size() const
+{
+	return sizeof(SQLGUID);
+}
+
+SQLSMALLINT guid_description::do_column_c_type() const
+{
+	return SQL_C_GUID;
+}
+
+SQLSMALLINT guid_description::do_column_sql_type() const
+{
+	return SQL_GUID;
+}
+
+SQLSMALLINT guid_description::do_digits() const
+{
+	return 0;
+}
+
+type_code guid_description::do_get_type_code() const
+{
+	return type_code::guid;
+}
+
+}
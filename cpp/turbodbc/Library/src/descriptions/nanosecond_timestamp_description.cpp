@@ -0,0 +1,41 @@
+#include <turbodbc/descriptions/nanosecond_timestamp_description.h>
+
+#include <sqlext.h>
+
+namespace turbodbc {
+
+nanosecond_timestamp_description::nanosecond_timestamp_description() = default;
+
+nanosecond_timestamp_description::nanosecond_timestamp_description(std::string name, bool supports_null) :
+	description(std::move(name), supports_null)
+{
+}
+
+nanosecond_timestamp_description::~nanosecond_timestamp_description() = default;
+
+std::size_t nanosecond_timestamp_description::do_element_size() const
+{
+	return sizeof(SQL_TIMESTAMP_STRUCT);
+}
+
+SQLSMALLINT nanosecond_timestamp_description::do_column_c_type() const
+{
+	return SQL_C_TYPE_TIMESTAMP;
+}
+
+SQLSMALLINT nanosecond_timestamp_description::do_column_sql_type() const
+{
+	return SQL_TYPE_TIMESTAMP;
+}
+
+SQLSMALLINT nanosecond_timestamp_description::do_digits() const
+{
+	return 7;
+}
+
+type_code nanosecond_timestamp_description::do_get_type_code() const
+{
+	return type_code::timestamp_nanoseconds;
+}
+
+}
@@ -0,0 +1,81 @@
+#include <turbodbc/descriptions/narrow_integer_description.h>
+
+#include <sqlext.h>
+
+#include <stdexcept>
+#include <ciso646>
+
+namespace turbodbc {
+
+namespace {
+
+	std::size_t checked_element_size(std::size_t element_size)
+	{
+		if ((element_size != sizeof(int8_t)) and (element_size != sizeof(int16_t)) and (element_size != sizeof(int32_t))) {
+			throw std::logic_error("Narrow integers must have a size of 1, 2, or 4 bytes");
+		}
+		return element_size;
+	}
+
+}
+
+narrow_integer_description::narrow_integer_description(std::size_t element_size) :
+	element_size_(checked_element_size(element_size))
+{
+}
+
+narrow_integer_description::narrow_integer_description(std::string name, bool supports_null, std::size_t element_size) :
+	description(std::move(name), supports_null),
+	element_size_(checked_element_size(element_size))
+{
+}
+
+narrow_integer_description::~narrow_integer_description() = default;
+
+std::size_t narrow_integer_description::do_element_size() const
+{
+	return element_size_;
+}
+
+SQLSMALLINT narrow_integer_description::do_column_c_type() const
+{
+	switch (element_size_) {
+		case sizeof(int8_t):
+			return SQL_C_STINYINT;
+		case sizeof(int16_t):
+			return SQL_C_SSHORT;
+		default:
+			return SQL_C_SLONG;
+	}
+}
+
+SQLSMALLINT narrow_integer_description::do_column_sql_type() const
+{
+	switch (element_size_) {
+		case sizeof(int8_t):
+			return SQL_TINYINT;
+		case sizeof(int16_t):
+			return SQL_SMALLINT;
+		default:
+			return SQL_INTEGER;
+	}
+}
+
+SQLSMALLINT narrow_integer_description::do_digits() const
+{
+	return 0;
+}
+
+type_code narrow_integer_description::do_get_type_code() const
+{
+	switch (element_size_) {
+		case sizeof(int8_t):
+			return type_code::integer_8;
+		case sizeof(int16_t):
+			return type_code::integer_16;
+		default:
+			return type_code::integer_32;
+	}
+}
+
+}
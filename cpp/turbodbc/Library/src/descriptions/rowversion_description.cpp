@@ -0,0 +1,42 @@
+#include <turbodbc/descriptions/rowversion_description.h>
+
+#include <sqlext.h>
+#include <cstdint>
+
+namespace turbodbc {
+
+rowversion_description::rowversion_description() = default;
+
+rowversion_description::rowversion_description(std::string name, bool supports_null) :
+	description(std::move(name), supports_null)
+{
+}
+
+rowversion_description::~rowversion_description() = default;
+
+std::size_t rowversion_description::do_element_size() const
+{
+	return sizeof(uint64_t);
+}
+
+SQLSMALLINT rowversion_description::do_column_c_type() const
+{
+	return SQL_C_BINARY;
+}
+
+SQLSMALLINT rowversion_description::do_column_sql_type() const
+{
+	return SQL_BINARY;
+}
+
+SQLSMALLINT rowversion_description::do_digits() const
+{
+	return 0;
+}
+
+type_code rowversion_description::do_get_type_code() const
+{
+	return type_code::rowversion;
+}
+
+}
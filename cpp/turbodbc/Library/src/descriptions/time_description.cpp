@@ -0,0 +1,42 @@
+#include <turbodbc/descriptions/time_description.h>
+
+#include <turbodbc/sql_server_types.h>
+#include <sqlext.h>
+
+namespace turbodbc {
+
+time_description::time_description() = default;
+
+time_description::time_description(std::string name, bool supports_null) :
+	description(std::move(name), supports_null)
+{
+}
+
+time_description::~time_description() = default;
+
+std::size_t time_description::do_element_size() const
+{
+	return sizeof(ss_time2_struct);
+}
+
+SQLSMALLINT time_description::do_column_c_type() const
+{
+	return SQL_C_BINARY;
+}
+
+SQLSMALLINT time_description::do_column_sql_type() const
+{
+	return sql_ss_time2;
+}
+
+SQLSMALLINT time_description::do_digits() const
+{
+	return 7;
+}
+
+type_code time_description::do_get_type_code() const
+{
+	return type_code::time;
+}
+
+}
@@ -0,0 +1,46 @@
+#include <turbodbc/descriptions/timestamp_offset_description.h>
+
+#include <turbodbc/sql_server_types.h>
+#include <sqlext.h>
+
+namespace turbodbc {
+
+timestamp_offset_description::timestamp_offset_description(bool nanoseconds) :
+	nanoseconds_(nanoseconds)
+{
+}
+
+timestamp_offset_description::timestamp_offset_description(std::string name, bool supports_null, bool nanoseconds) :
+	description(std::move(name), supports_null),
+	nanoseconds_(nanoseconds)
+{
+}
+
+timestamp_offset_description::~timestamp_offset_description() = default;
+
+std::size_t timestamp_offset_description::do_element_size() const
+{
+	return sizeof(ss_timestampoffset_struct);
+}
+
+SQLSMALLINT timestamp_offset_description::do_column_c_type() const
+{
+	return SQL_C_BINARY;
+}
+
+SQLSMALLINT timestamp_offset_description::do_column_sql_type() const
+{
+	return sql_ss_timestampoffset;
+}
+
+SQLSMALLINT timestamp_offset_description::do_digits() const
+{
+	return 7;
+}
+
+type_code timestamp_offset_description::do_get_type_code() const
+{
+	return nanoseconds_ ? type_code::timestamp_offset_nanoseconds : type_code::timestamp_offset;
+}
+
+}
@@ -0,0 +1,17 @@
+#include <turbodbc/field_translators/float32_translator.h>
+
+#include <boost/variant/get.hpp>
+#include <sqlext.h>
+
+namespace turbodbc { namespace field_translators {
+
+float32_translator::float32_translator() = default;
+
+float32_translator::~float32_translator() = default;
+
+field float32_translator::do_make_field(char const * data_pointer) const
+{
+	return {double(*reinterpret_cast<float const *>(data_pointer))};
+}
+
+} }
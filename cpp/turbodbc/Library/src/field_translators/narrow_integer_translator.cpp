@@ -0,0 +1,27 @@
+#include <turbodbc/field_translators/narrow_integer_translator.h>
+
+#include <boost/variant/get.hpp>
+#include <sqlext.h>
+
+namespace turbodbc { namespace field_translators {
+
+narrow_integer_translator::narrow_integer_translator(std::size_t element_size) :
+	element_size_(element_size)
+{
+}
+
+narrow_integer_translator::~narrow_integer_translator() = default;
+
+field narrow_integer_translator::do_make_field(char const * data_pointer) const
+{
+	switch (element_size_) {
+		case sizeof(int8_t):
+			return {int64_t(*reinterpret_cast<int8_t const *>(data_pointer))};
+		case sizeof(int16_t):
+			return {int64_t(*reinterpret_cast<int16_t const *>(data_pointer))};
+		default:
+			return {int64_t(*reinterpret_cast<int32_t const *>(data_pointer))};
+	}
+}
+
+} }
@@ -0,0 +1,304 @@
+#include <turbodbc/indicator_helpers.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+#include <sql.h>
+
+#include <algorithm>
+#include <bitset>
+#include <ciso646>
+#include <cstring>
+
+#if defined(__GNUC__) and defined(__x86_64__)
+    #define TURBODBC_HAS_AVX2_DISPATCH 1
+    #include <immintrin.h>
+#endif
+#if (defined(__SSE2__) or defined(_M_X64)) and (INTPTR_MAX == INT64_MAX)
+    #define TURBODBC_HAS_SSE2 1
+    #include <emmintrin.h>
+#endif
+
+namespace turbodbc {
+
+namespace {
+
+    static_assert(SQL_NULL_DATA == -1, "SIMD kernels compare against all bits set");
+
+    // All kernels write one byte per eight values with bit i set if value i is null.
+    // Vectorized kernels process complete bytes and leave the tail to the scalar kernel.
+
+    void pack_null_bits_scalar(intptr_t const * indicators, std::size_t n_values, uint8_t * null_bits)
+    {
+        for (std::size_t byte = 0; byte != (n_values + 7) / 8; ++byte) {
+            auto const chunk = indicators + 8 * byte;
+            std::size_t const bits_in_byte = std::min<std::size_t>(8, n_values - 8 * byte);
+            uint8_t bits = 0;
+            for (std::size_t bit = 0; bit != bits_in_byte; ++bit) {
+                bits |= static_cast<uint8_t>((chunk[bit] == SQL_NULL_DATA) << bit);
+            }
+            null_bits[byte] = bits;
+        }
+    }
+
+#ifdef TURBODBC_HAS_SSE2
+    void pack_null_bits_sse2(intptr_t const * indicators, std::size_t n_values, uint8_t * null_bits)
+    {
+        std::size_t const n_bytes = n_values / 8;
+        // SSE2 lacks 64 bit comparisons; a value is null if both 32 bit halves are all ones
+        __m128i const null_data = _mm_set1_epi32(-1);
+        for (std::size_t byte = 0; byte != n_bytes; ++byte) {
+            auto const chunk = reinterpret_cast<__m128i const *>(indicators + 8 * byte);
+            unsigned int bits = 0;
+            for (unsigned int pair = 0; pair != 4; ++pair) {
+                auto const equal = _mm_cmpeq_epi32(_mm_loadu_si128(chunk + pair), null_data);
+                auto const halves = static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(equal)));
+                bits |= (((halves & 0x3u) == 0x3u) | (((halves & 0xCu) == 0xCu) << 1)) << (2 * pair);
+            }
+            null_bits[byte] = static_cast<uint8_t>(bits);
+        }
+        pack_null_bits_scalar(indicators + 8 * n_bytes, n_values % 8, null_bits + n_bytes);
+    }
+#endif
+
+#ifdef TURBODBC_HAS_AVX2_DISPATCH
+    __attribute__((target("avx2")))
+    void pack_null_bits_avx2(intptr_t const * indicators, std::size_t n_values, uint8_t * null_bits)
+    {
+        std::size_t const n_bytes = n_values / 8;
+        __m256i const null_data = _mm256_set1_epi64x(SQL_NULL_DATA);
+        for (std::size_t byte = 0; byte != n_bytes; ++byte) {
+            auto const chunk = reinterpret_cast<__m256i const *>(indicators + 8 * byte);
+            auto const low = _mm256_cmpeq_epi64(_mm256_loadu_si256(chunk), null_data);
+            auto const high = _mm256_cmpeq_epi64(_mm256_loadu_si256(chunk + 1), null_data);
+            auto const bits = _mm256_movemask_pd(_mm256_castsi256_pd(low))
+                            | (_mm256_movemask_pd(_mm256_castsi256_pd(high)) << 4);
+            null_bits[byte] = static_cast<uint8_t>(bits);
+        }
+        pack_null_bits_scalar(indicators + 8 * n_bytes, n_values % 8, null_bits + n_bytes);
+    }
+#endif
+
+    using pack_kernel = void (*)(intptr_t const *, std::size_t, uint8_t *);
+
+    pack_kernel select_kernel()
+    {
+#ifdef TURBODBC_HAS_AVX2_DISPATCH
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            return pack_null_bits_avx2;
+        }
+#endif
+#ifdef TURBODBC_HAS_SSE2
+        return pack_null_bits_sse2;
+#else
+        return pack_null_bits_scalar;
+#endif
+    }
+
+    void pack_null_bits(intptr_t const * indicators, std::size_t n_values, uint8_t * null_bits)
+    {
+        static pack_kernel const kernel = select_kernel();
+        kernel(indicators, n_values, null_bits);
+    }
+
+    std::size_t count_bits(uint8_t byte)
+    {
+        return std::bitset<8>(byte).count();
+    }
+
+    std::size_t pack_all_null_bits(intptr_t const * indicators, std::size_t n_values, uint8_t * null_bits)
+    {
+        pack_null_bits(indicators, n_values, null_bits);
+
+        std::size_t null_count = 0;
+        for (std::size_t byte = 0; byte != (n_values + 7) / 8; ++byte) {
+            null_count += count_bits(null_bits[byte]);
+        }
+        return null_count;
+    }
+
+    // Expands bits to bytes, one 64 bit store per input byte
+    struct byte_expansion_table {
+        uint64_t entries[256];
+
+        byte_expansion_table()
+        {
+            for (unsigned int bits = 0; bits != 256; ++bits) {
+                uint8_t bytes[8];
+                for (unsigned int bit = 0; bit != 8; ++bit) {
+                    bytes[bit] = (bits >> bit) & 1u;
+                }
+                std::memcpy(&entries[bits], bytes, sizeof(bytes));
+            }
+        }
+    };
+
+    // Expansion kernels write eight indicators for one byte with bit i set if value i is valid
+
+    void expand_valid_bits_scalar(unsigned int valid_bits, std::size_t n_values, intptr_t valid_indicator, intptr_t * indicators)
+    {
+        for (std::size_t bit = 0; bit != n_values; ++bit) {
+            indicators[bit] = ((valid_bits >> bit) & 1u) ? valid_indicator : SQL_NULL_DATA;
+        }
+    }
+
+#ifdef TURBODBC_HAS_SSE2
+    struct valid_bit_expander {
+        __m128i const valid;
+        __m128i const zero;
+        __m128i const lane_bits[4];
+
+        explicit valid_bit_expander(intptr_t valid_indicator) :
+            valid(_mm_set1_epi64x(valid_indicator)),
+            zero(_mm_setzero_si128()),
+            // both 32 bit halves of a 64 bit lane test the same bit
+            lane_bits{_mm_set_epi32(0x02, 0x02, 0x01, 0x01), _mm_set_epi32(0x08, 0x08, 0x04, 0x04),
+                      _mm_set_epi32(0x20, 0x20, 0x10, 0x10), _mm_set_epi32(0x80, 0x80, 0x40, 0x40)}
+        {}
+
+        void operator()(unsigned int valid_bits, intptr_t * indicators) const
+        {
+            auto const bits = _mm_set1_epi32(static_cast<int>(valid_bits));
+            for (unsigned int pair = 0; pair != 4; ++pair) {
+                // null lanes become all ones, i.e., SQL_NULL_DATA
+                auto const is_null = _mm_cmpeq_epi32(_mm_and_si128(bits, lane_bits[pair]), zero);
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(indicators + 2 * pair),
+                                 _mm_or_si128(is_null, _mm_andnot_si128(is_null, valid)));
+            }
+        }
+    };
+#else
+    struct valid_bit_expander {
+        intptr_t const valid_indicator;
+
+        explicit valid_bit_expander(intptr_t valid_indicator) :
+            valid_indicator(valid_indicator)
+        {}
+
+        void operator()(unsigned int valid_bits, intptr_t * indicators) const
+        {
+            expand_valid_bits_scalar(valid_bits, 8, valid_indicator, indicators);
+        }
+    };
+#endif
+
+    unsigned int valid_bits_of_mask(uint8_t const * mask)
+    {
+#ifdef TURBODBC_HAS_SSE2
+        auto const bytes = _mm_loadl_epi64(reinterpret_cast<__m128i const *>(mask));
+        return static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_setzero_si128()))) & 0xFFu;
+#else
+        unsigned int valid_bits = 0;
+        for (unsigned int bit = 0; bit != 8; ++bit) {
+            valid_bits |= static_cast<unsigned int>(mask[bit] == 0) << bit;
+        }
+        return valid_bits;
+#endif
+    }
+
+    std::size_t indicators_to_byte_mask(intptr_t const * indicators, std::size_t n_values, uint8_t * mask, bool invert)
+    {
+        // Work in blocks so the packed bits stay in a small stack buffer
+        std::size_t const block_values = 4096;
+        uint8_t null_bits[block_values / 8];
+        uint8_t const flip = invert ? 0xFF : 0x00;
+        static byte_expansion_table const expansion_table;
+
+        std::size_t null_count = 0;
+        for (std::size_t offset = 0; offset < n_values; offset += block_values) {
+            std::size_t const values = std::min(block_values, n_values - offset);
+            null_count += pack_all_null_bits(indicators + offset, values, null_bits);
+
+            std::size_t const full_bytes = values / 8;
+            for (std::size_t byte = 0; byte != full_bytes; ++byte) {
+                std::memcpy(mask + offset + 8 * byte, &expansion_table.entries[null_bits[byte] ^ flip], 8);
+            }
+            for (std::size_t value = 8 * full_bytes; value != values; ++value) {
+                mask[offset + value] = ((null_bits[value / 8] ^ flip) >> (value % 8)) & 1u;
+            }
+        }
+        return null_count;
+    }
+
+}
+
+std::size_t indicators_to_validity_bitmap(intptr_t const * indicators, std::size_t n_values, uint8_t * bitmap)
+{
+    auto const null_count = pack_all_null_bits(indicators, n_values, bitmap);
+    std::size_t const n_bytes = (n_values + 7) / 8;
+    for (std::size_t byte = 0; byte != n_bytes; ++byte) {
+        bitmap[byte] = static_cast<uint8_t>(~bitmap[byte]);
+    }
+    if (n_values % 8 != 0) {
+        bitmap[n_bytes - 1] &= static_cast<uint8_t>((1u << (n_values % 8)) - 1);
+    }
+    return null_count;
+}
+
+std::size_t indicators_to_null_mask(intptr_t const * indicators, std::size_t n_values, uint8_t * mask)
+{
+    return indicators_to_byte_mask(indicators, n_values, mask, false);
+}
+
+std::size_t indicators_to_valid_mask(intptr_t const * indicators, std::size_t n_values, uint8_t * mask)
+{
+    return indicators_to_byte_mask(indicators, n_values, mask, true);
+}
+
+std::size_t validity_bitmap_to_indicators(uint8_t const * bitmap, std::size_t bit_offset, std::size_t n_values,
+                                          intptr_t valid_indicator, intptr_t * indicators)
+{
+    bitmap += bit_offset / 8;
+    std::size_t const leading_bits = std::min((8 - bit_offset % 8) % 8, n_values);
+    std::size_t null_count = 0;
+
+    // Leading bits up to the first byte boundary
+    if (leading_bits != 0) {
+        auto const valid_bits = static_cast<unsigned int>(*bitmap++) >> (bit_offset % 8);
+        expand_valid_bits_scalar(valid_bits, leading_bits, valid_indicator, indicators);
+        null_count += leading_bits - count_bits(static_cast<uint8_t>(valid_bits & ((1u << leading_bits) - 1)));
+    }
+
+    valid_bit_expander const expand(valid_indicator);
+    std::size_t const full_bytes = (n_values - leading_bits) / 8;
+    auto out = indicators + leading_bits;
+    for (std::size_t byte = 0; byte != full_bytes; ++byte, out += 8) {
+        auto const valid_bits = bitmap[byte];
+        if (valid_bits == 0xFF) {
+            std::fill_n(out, 8, valid_indicator);
+        } else {
+            expand(valid_bits, out);
+            null_count += 8 - count_bits(valid_bits);
+        }
+    }
+
+    std::size_t const trailing_bits = (n_values - leading_bits) % 8;
+    if (trailing_bits != 0) {
+        auto const valid_bits = static_cast<unsigned int>(bitmap[full_bytes]);
+        expand_valid_bits_scalar(valid_bits, trailing_bits, valid_indicator, out);
+        null_count += trailing_bits - count_bits(static_cast<uint8_t>(valid_bits & ((1u << trailing_bits) - 1)));
+    }
+    return null_count;
+}
+
+std::size_t null_mask_to_indicators(uint8_t const * mask, std::size_t n_values,
+                                    intptr_t valid_indicator, intptr_t * indicators)
+{
+    valid_bit_expander const expand(valid_indicator);
+    std::size_t null_count = 0;
+    std::size_t const full_bytes = n_values / 8;
+    for (std::size_t byte = 0; byte != full_bytes; ++byte) {
+        auto const valid_bits = valid_bits_of_mask(mask + 8 * byte);
+        expand(valid_bits, indicators + 8 * byte);
+        null_count += 8 - count_bits(static_cast<uint8_t>(valid_bits));
+    }
+    for (std::size_t value = 8 * full_bytes; value != n_values; ++value) {
+        bool const is_null = (mask[value] != 0);
+        indicators[value] = is_null ? SQL_NULL_DATA : valid_indicator;
+        null_count += is_null;
+    }
+    return null_count;
+}
+
+}
@@ -1,6 +1,7 @@
 #include <turbodbc/make_description.h>
 
 #include <turbodbc/descriptions.h>
+#include <turbodbc/sql_server_types.h>
 #include <sqlext.h>
 
 #include <boost/variant/apply_visitor.hpp>
@@ -15,6 +16,7 @@ namespace turbodbc {
 namespace {
 
 SQLULEN const digits_representable_by_64_bit_integer = 18;
+SQLSMALLINT const microsecond_digits = 6;
 
 /*
  * This function returns a buffer size for the given string
@@ -55,6 +57,12 @@ std::unique_ptr<description const> make_large_decimal_description(cpp_odbc::colu
 
 std::unique_ptr<description const> make_decimal_description(cpp_odbc::column_description const & source, turbodbc::options const & options)
 {
+    if (options.fetch_exact_decimals and (source.size <= decimal_description::maximum_precision)) {
+        return std::unique_ptr<description>(new decimal_description(source.name,
+                                                                    source.allows_null_values,
+                                                                    static_cast<SQLSMALLINT>(source.size),
+                                                                    source.decimal_digits));
+    }
     if (source.size <= digits_representable_by_64_bit_integer) {
         return make_small_decimal_description(source);
     } else {
@@ -62,6 +70,31 @@ std::unique_ptr<description const> make_decimal_description(cpp_odbc::column_des
     }
 }
 
+std::unique_ptr<description const> make_integer_description(cpp_odbc::column_description const & source,
+                                                            turbodbc::options const & options,
+                                                            std::size_t element_size)
+{
+    if (options.fetch_narrow_numeric_types) {
+        return std::unique_ptr<description>(new narrow_integer_description(source.name, source.allows_null_values, element_size));
+    } else {
+        return std::unique_ptr<description>(new integer_description(source.name, source.allows_null_values));
+    }
+}
+
+std::unique_ptr<description const> make_binary_description(cpp_odbc::column_description const & source,
+                                                           turbodbc::options const & options)
+{
+    // ODBC reports SQL Server's ROWVERSION as BINARY(8)
+    if (options.fetch_rowversion_as_integer and (source.data_type == SQL_BINARY) and (source.size == sizeof(uint64_t))) {
+        return std::unique_ptr<description>(new rowversion_description(source.name, source.allows_null_values));
+    }
+    std::size_t const sanitized_size = (source.size == 0 ? options.varchar_max_character_limit : source.size);
+    std::size_t const limited_size = (options.limit_varchar_results_to_max ?
+                                      std::min(sanitized_size, options.varchar_max_character_limit) :
+                                      sanitized_size);
+    return std::unique_ptr<description>(new binary_description(source.name, source.allows_null_values, limited_size));
+}
+
 using description_ptr = description const *;
 
 struct description_by_value : public boost::static_visitor<description_ptr> {
@@ -136,12 +169,24 @@ std::unique_ptr<description const> make_description(cpp_odbc::column_description
             } else {
                 return make_character_description<unicode_description>(source, options);
             }
-        case SQL_INTEGER:
+        case SQL_BINARY:
+        case SQL_VARBINARY:
+        case SQL_LONGVARBINARY:
+            return make_binary_description(source, options);
+        case SQL_TINYINT:
+            return make_integer_description(source, options, sizeof(int8_t));
         case SQL_SMALLINT:
+            return make_integer_description(source, options, sizeof(int16_t));
+        case SQL_INTEGER:
+            return make_integer_description(source, options, sizeof(int32_t));
         case SQL_BIGINT:
-        case SQL_TINYINT:
             return std::unique_ptr<description>(new integer_description(source.name, source.allows_null_values));
         case SQL_REAL:
+            if (options.fetch_narrow_numeric_types) {
+                return std::unique_ptr<description>(new floating_point_32_description(source.name, source.allows_null_values));
+            } else {
+                return std::unique_ptr<description>(new floating_point_description(source.name, source.allows_null_values));
+            }
         case SQL_FLOAT:
         case SQL_DOUBLE:
             return std::unique_ptr<description>(new floating_point_description(source.name, source.allows_null_values));
@@ -153,7 +198,20 @@ std::unique_ptr<description const> make_description(cpp_odbc::column_description
         case SQL_TYPE_DATE:
             return std::unique_ptr<description>(new date_description(source.name, source.allows_null_values));
         case SQL_TYPE_TIMESTAMP:
-            return std::unique_ptr<description>(new timestamp_description(source.name, source.allows_null_values));
+            if (options.fetch_nanosecond_timestamps and (source.decimal_digits > microsecond_digits)) {
+                return std::unique_ptr<description>(new nanosecond_timestamp_description(source.name, source.allows_null_values));
+            } else {
+                return std::unique_ptr<description>(new timestamp_description(source.name, source.allows_null_values));
+            }
+        case sql_ss_time2:
+            return std::unique_ptr<description>(new time_description(source.name, source.allows_null_values));
+        case sql_ss_timestampoffset: {
+            // int64 nanoseconds cannot represent years outside 1677 to 2262, so they are opt-in
+            bool const nanoseconds = options.fetch_nanosecond_timestamps and (source.decimal_digits > microsecond_digits);
+            return std::unique_ptr<description>(new timestamp_offset_description(source.name, source.allows_null_values, nanoseconds));
+        }
+        case SQL_GUID:
+            return std::unique_ptr<description>(new guid_description(source.name, source.allows_null_values));
         default:
             std::ostringstream message;
             message << "Error! Unsupported type identifier for column " << source << ")";
@@ -172,6 +230,14 @@ std::unique_ptr<description const> make_description(type_code type, std::size_t
     switch (type) {
         case type_code::floating_point:
             return std::unique_ptr<description const>(new floating_point_description);
+        case type_code::integer_8:
+            return std::unique_ptr<description const>(new narrow_integer_description(sizeof(int8_t)));
+        case type_code::integer_16:
+            return std::unique_ptr<description const>(new narrow_integer_description(sizeof(int16_t)));
+        case type_code::integer_32:
+            return std::unique_ptr<description const>(new narrow_integer_description(sizeof(int32_t)));
+        case type_code::floating_point_32:
+            return std::unique_ptr<description const>(new floating_point_32_description);
         case type_code::boolean:
             return std::unique_ptr<description const>(new boolean_description);
         case type_code::date:
@@ -182,6 +248,20 @@ std::unique_ptr<description const> make_description(type_code type, std::size_t
             return std::unique_ptr<description const>(new string_description(size_after_growth_strategy(size)));
         case type_code::unicode:
             return std::unique_ptr<description const>(new unicode_description(size_after_growth_strategy(size)));
+        case type_code::binary:
+            return std::unique_ptr<description const>(new binary_description(size_after_growth_strategy(size)));
+        case type_code::rowversion:
+            return std::unique_ptr<description const>(new rowversion_description);
+        case type_code::guid:
+            return std::unique_ptr<description const>(new guid_description);
+        case type_code::time:
+            return std::unique_ptr<description const>(new time_description);
+        case type_code::timestamp_nanoseconds:
+            return std::unique_ptr<description const>(new nanosecond_timestamp_description);
+        case type_code::timestamp_offset:
+            return std::unique_ptr<description const>(new timestamp_offset_description);
+        case type_code::timestamp_offset_nanoseconds:
+            return std::unique_ptr<description const>(new timestamp_offset_description(true));
         default:
             return std::unique_ptr<description const>(new integer_description);
     }
@@ -18,8 +18,14 @@ std::unique_ptr<field_translator const> make_field_translator(turbodbc::column_i
 			return std::unique_ptr<date_translator>(new date_translator());
 		case type_code::floating_point:
 			return std::unique_ptr<float64_translator>(new float64_translator());
+		case type_code::floating_point_32:
+			return std::unique_ptr<float32_translator>(new float32_translator());
 		case type_code::integer:
 			return std::unique_ptr<int64_translator>(new int64_translator());
+		case type_code::integer_8:
+		case type_code::integer_16:
+		case type_code::integer_32:
+			return std::unique_ptr<narrow_integer_translator>(new narrow_integer_translator(source.element_size));
 		case type_code::string:
 			return std::unique_ptr<string_translator>(new string_translator());
 		case type_code::timestamp:
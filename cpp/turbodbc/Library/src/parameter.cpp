@@ -21,10 +21,23 @@ namespace {
 
 parameter::parameter(cpp_odbc::statement const &statement, std::size_t one_based_index, std::size_t buffered_rows,
                      std::unique_ptr<description const> description) :
+    parameter(buffered_rows, std::move(description)) {
+    bind(statement, one_based_index);
+}
+
+parameter::parameter(std::size_t buffered_rows, std::unique_ptr<description const> description) :
     description_(std::move(description)),
     buffer_(description_->element_size(), buffered_rows) {
-    statement.bind_input_parameter(one_based_index, description_->column_c_type(), description_->column_sql_type(),
-                                   description_->digits(), buffer_);
+}
+
+void parameter::bind(cpp_odbc::statement const &statement, std::size_t one_based_index) {
+    if (description_->get_type_code() == type_code::decimal) {
+        statement.bind_numeric_input_parameter(one_based_index, description_->column_sql_type(),
+                                               description_->precision(), description_->digits(), buffer_);
+    } else {
+        statement.bind_input_parameter(one_based_index, description_->column_c_type(), description_->column_sql_type(),
+                                       description_->digits(), buffer_);
+    }
 }
 
 parameter::~parameter() = default;
@@ -1,12 +1,16 @@
 #include <turbodbc/parameter_sets/bound_parameter_set.h>
 
 #include <turbodbc/make_description.h>
+#include <turbodbc/sql_server_types.h>
+#include <turbodbc/errors.h>
 
 #include <cpp_odbc/error.h>
 
 #include <stdexcept>
 #include <sqlext.h>
 
+#include <algorithm>
+#include <exception>
 #include <functional>
 #include <ciso646>
 
@@ -14,14 +18,37 @@ namespace turbodbc {
 
 namespace {
     std::size_t const max_initial_string_length = 16;
+    std::size_t const bytes_per_megabyte = 1024 * 1024;
+
+    std::shared_ptr<parameter> make_default_parameter(cpp_odbc::statement const & statement, std::size_t one_based_index, turbodbc::configuration const & configuration)
+    {
+        auto const prefer_unicode = configuration.options.prefer_unicode;
+        type_code const code = prefer_unicode ? type_code::unicode : type_code::string;
+        auto description = make_description(code, 1);
+        return std::make_shared<parameter>(statement,
+                                           one_based_index,
+                                           configuration.options.parameter_sets_to_buffer,
+                                           std::move(description));
+    }
 
     std::shared_ptr<parameter> make_suggested_parameter(cpp_odbc::statement const & statement, std::size_t one_based_index, turbodbc::configuration const & configuration)
     {
-        auto description = make_description(statement.describe_parameter(one_based_index), configuration.options);
-        if (((description->get_type_code() == type_code::string) or (description->get_type_code() == type_code::unicode))
-            and (description->element_size() > (max_initial_string_length + 1)))
+        auto const suggestion = statement.describe_parameter(one_based_index);
+        if (suggestion.data_type == sql_ss_table) {
+            // table-valued parameters are bound by dedicated parameter sets
+            return make_default_parameter(statement, one_based_index, configuration);
+        }
+        auto description = make_description(suggestion, configuration.options);
+        auto const code = description->get_type_code();
+        // Declared lengths are only trusted if requested; (MAX) types report zero
+        bool const keep_declared_size = configuration.options.presize_string_parameters
+                                        and (suggestion.size != 0)
+                                        and (suggestion.size <= configuration.options.varchar_max_character_limit);
+        if (((code == type_code::string) or (code == type_code::unicode) or (code == type_code::binary))
+            and (description->element_size() > (max_initial_string_length + 1))
+            and not keep_declared_size)
         {
-            auto modified_description = statement.describe_parameter(one_based_index);
+            auto modified_description = suggestion;
             modified_description.size = max_initial_string_length;
             description = make_description(modified_description, configuration.options);
         }
@@ -31,27 +58,49 @@ namespace {
                                            std::move(description));
     }
 
-    std::shared_ptr<parameter> make_default_parameter(cpp_odbc::statement const & statement, std::size_t one_based_index, turbodbc::configuration const & configuration)
+    std::unique_ptr<parameter_set_tuner> make_tuner(turbodbc::configuration const & configuration)
     {
-        auto const prefer_unicode = configuration.options.prefer_unicode;
-        type_code const code = prefer_unicode ? type_code::unicode : type_code::string;
-        auto description = make_description(code, 1);
-        return std::make_shared<parameter>(statement,
-                                           one_based_index,
-                                           configuration.options.parameter_sets_to_buffer,
-                                           std::move(description));
+        if (not configuration.options.adaptive_parameter_sets) {
+            return nullptr;
+        }
+        std::chrono::milliseconds const latency_target(configuration.options.parameter_batch_milliseconds);
+        return std::unique_ptr<parameter_set_tuner>(new parameter_set_tuner(configuration.options.parameter_sets_to_buffer, latency_target));
     }
 
     using parameter_factory = std::function<std::shared_ptr<parameter>(cpp_odbc::statement const &, std::size_t, turbodbc::configuration const &)>;
+
+    int const sql_server_deadlock_victim = 1205;
+
+    // Errors which roll back the transaction and may succeed when executed again
+    bool is_retryable(cpp_odbc::level2::diagnostic_record const & record)
+    {
+        return (record.odbc_status_code.compare(0, 2, "40") == 0)
+            or (record.native_error_code == sql_server_deadlock_victim);
+    }
 }
 
 
 bound_parameter_set::bound_parameter_set(cpp_odbc::statement const & statement,
                                          turbodbc::configuration const & configuration) :
+        bound_parameter_set(statement, configuration, false)
+{
+}
+
+bound_parameter_set::bound_parameter_set(cpp_odbc::statement const & statement,
+                                         turbodbc::configuration const & configuration,
+                                         bool bind_on_execute) :
         statement_(statement),
+        bind_on_execute_(bind_on_execute),
+        bindings_valid_(true),
         buffered_sets_(configuration.options.parameter_sets_to_buffer),
         transferred_sets_(0),
-        confirmed_last_batch_(0)
+        confirmed_last_batch_(0),
+        table_valued_(false),
+        table_rows_(0),
+        tuner_(make_tuner(configuration)),
+        buffer_memory_limit_(configuration.options.parameter_buffer_megabytes * bytes_per_megabyte),
+        retries_(configuration.options.autocommit ? configuration.options.parameter_set_retries : 0),
+        executed_sets_(0)
 {
     std::size_t const n_parameters = statement_.number_of_parameters();
     auto const query_db_for_initial_types = configuration.capabilities.supports_describe_parameter;
@@ -65,6 +114,36 @@ bound_parameter_set::bound_parameter_set(cpp_odbc::statement const & statement,
         initial_parameter_types_.push_back(parameters_.back()->get_type_code());
     }
     statement_.set_attribute(SQL_ATTR_PARAMS_PROCESSED_PTR, &confirmed_last_batch_);
+    status_.resize(buffered_sets_, SQL_PARAM_UNUSED);
+    statement_.set_attribute(SQL_ATTR_PARAM_STATUS_PTR, status_.data());
+}
+
+bound_parameter_set::bound_parameter_set(cpp_odbc::statement const & statement,
+                                         turbodbc::configuration const & configuration,
+                                         std::u16string table_type_name,
+                                         std::size_t number_of_columns) :
+        statement_(statement),
+        bind_on_execute_(true),
+        bindings_valid_(true),
+        buffered_sets_(configuration.options.parameter_sets_to_buffer),
+        transferred_sets_(0),
+        confirmed_last_batch_(0),
+        table_valued_(true),
+        table_type_name_(std::move(table_type_name)),
+        table_rows_(0),
+        tuner_(make_tuner(configuration)),
+        buffer_memory_limit_(configuration.options.parameter_buffer_megabytes * bytes_per_megabyte),
+        retries_(configuration.options.autocommit ? configuration.options.parameter_set_retries : 0),
+        executed_sets_(0)
+{
+    if (statement_.number_of_parameters() != 1) {
+        throw interface_error("A table-valued parameter must be the only parameter of the statement");
+    }
+    type_code const code = configuration.options.prefer_unicode ? type_code::unicode : type_code::string;
+    for (std::size_t i = 0; i != number_of_columns; ++i) {
+        parameters_.push_back(std::make_shared<parameter>(buffered_sets_, make_description(code, 1)));
+        initial_parameter_types_.push_back(code);
+    }
 }
 
 std::size_t bound_parameter_set::buffered_sets() const
@@ -90,13 +169,36 @@ std::vector<std::shared_ptr<parameter>> const & bound_parameter_set::get_paramet
 }
 
 
+std::vector<failed_parameter_set> const & bound_parameter_set::failed_sets() const
+{
+    return failed_sets_;
+}
+
+
 void bound_parameter_set::execute_batch(std::size_t sets_in_batch)
 {
     if ((sets_in_batch != 0) and not parameters_.empty()) {
         if (sets_in_batch <= buffered_sets_) {
-            statement_.set_attribute(SQL_ATTR_PARAMSET_SIZE, sets_in_batch);
-            statement_.execute_prepared();
-            transferred_sets_ += confirmed_last_batch_;
+            if (bind_on_execute_ or not bindings_valid_) {
+                bind();
+            }
+            auto const start = std::chrono::steady_clock::now();
+            if (table_valued_) {
+                // all sets are rows of a single table parameter
+                table_rows_ = sets_in_batch;
+                statement_.set_attribute(SQL_ATTR_PARAMSET_SIZE, 1);
+                executed_sets_ += sets_in_batch;
+                statement_.execute_prepared();
+                transferred_sets_ += confirmed_last_batch_ * sets_in_batch;
+            } else {
+                statement_.set_attribute(SQL_ATTR_PARAMSET_SIZE, sets_in_batch);
+                auto const first_set = executed_sets_;
+                executed_sets_ += sets_in_batch;
+                execute_isolating_failures(first_set, sets_in_batch);
+            }
+            if (tuner_) {
+                adapt_buffered_sets(sets_in_batch, std::chrono::steady_clock::now() - start);
+            }
         } else {
             throw std::logic_error("A batch cannot be larger than the number of buffered sets");
         }
@@ -107,10 +209,159 @@ void bound_parameter_set::execute_batch(std::size_t sets_in_batch)
 void bound_parameter_set::rebind(std::size_t parameter_index,
                                  std::unique_ptr<description const> parameter_description)
 {
-    parameters_[parameter_index] = std::make_shared<parameter>(statement_,
-                                                               parameter_index + 1,
-                                                               buffered_sets_,
-                                                               std::move(parameter_description));
+    if (bind_on_execute_) {
+        parameters_[parameter_index] = std::make_shared<parameter>(buffered_sets_,
+                                                                   std::move(parameter_description));
+    } else {
+        parameters_[parameter_index] = std::make_shared<parameter>(statement_,
+                                                                   parameter_index + 1,
+                                                                   buffered_sets_,
+                                                                   std::move(parameter_description));
+    }
+}
+
+
+bool bound_parameter_set::ensure_capacity(std::size_t parameter_index, type_code type, std::size_t value_size)
+{
+    if (parameters_[parameter_index]->is_suitable_for(type, value_size)) {
+        return false;
+    }
+    rebind(parameter_index, make_description(type, value_size));
+    return true;
+}
+
+
+void bound_parameter_set::invalidate_bindings()
+{
+    bindings_valid_ = false;
+}
+
+
+void bound_parameter_set::ensure_bound()
+{
+    if (not bindings_valid_) {
+        bind();
+    }
+}
+
+
+void bound_parameter_set::bind()
+{
+    if (not bindings_valid_) {
+        // drop bindings of other sets, including columns of table-valued parameters
+        statement_.unbind_all_parameters();
+        bindings_valid_ = true;
+    }
+    if (table_valued_) {
+        statement_.bind_table_input_parameter(1, table_type_name_, buffered_sets_, &table_rows_);
+        statement_.set_attribute(sql_sopt_ss_param_focus, static_cast<intptr_t>(1));
+    }
+    for (std::size_t i = 0; i != parameters_.size(); ++i) {
+        parameters_[i]->bind(statement_, i + 1);
+    }
+    if (table_valued_) {
+        statement_.set_attribute(sql_sopt_ss_param_focus, static_cast<intptr_t>(0));
+    }
+    statement_.set_attribute(SQL_ATTR_PARAMS_PROCESSED_PTR, &confirmed_last_batch_);
+    if (table_valued_) {
+        // the table is a single set without status; drop the array of other sets
+        statement_.set_attribute(SQL_ATTR_PARAM_STATUS_PTR, static_cast<SQLUSMALLINT *>(nullptr));
+    } else {
+        statement_.set_attribute(SQL_ATTR_PARAM_STATUS_PTR, status_.data());
+    }
+}
+
+void bound_parameter_set::execute_isolating_failures(std::size_t first_set, std::size_t sets_in_batch)
+{
+    std::exception_ptr error;
+    std::vector<cpp_odbc::level2::row_diagnostic_record> diagnostics;
+    for (std::size_t attempt = 0; ; ++attempt) {
+        // Drivers leave the status of sets they did not get to untouched
+        std::fill_n(status_.begin(), sets_in_batch, SQL_PARAM_UNUSED);
+        error = nullptr;
+        try {
+            statement_.execute_prepared();
+        } catch (cpp_odbc::error const &) {
+            error = std::current_exception();
+        }
+        bool const any_rejected = std::find(status_.begin(), status_.begin() + sets_in_batch, SQL_PARAM_ERROR)
+                                  != status_.begin() + sets_in_batch;
+        if (not (error or any_rejected)) {
+            diagnostics.clear();
+            break;
+        }
+        diagnostics = statement_.get_row_diagnostic_records();
+
+        // Only a batch failing as a whole was rolled back completely. Resubmitting
+        // single sets would duplicate the others, so these are not retried.
+        bool const rolled_back = error and std::any_of(diagnostics.begin(), diagnostics.end(),
+                                                       [](cpp_odbc::level2::row_diagnostic_record const & record) {
+                                                           return is_retryable(record.record);
+                                                       });
+        if (not (rolled_back and (attempt != retries_))) {
+            break;
+        }
+    }
+
+    bool const status_reported = std::any_of(status_.begin(), status_.begin() + sets_in_batch,
+                                             [](SQLUSMALLINT status) { return status != SQL_PARAM_UNUSED; });
+    if (not (error or status_reported)) {
+        // the driver does not fill the status array
+        transferred_sets_ += confirmed_last_batch_;
+        return;
+    }
+
+    for (std::size_t i = 0; i != sets_in_batch; ++i) {
+        auto const status = status_[i];
+        bool const succeeded = (status == SQL_PARAM_SUCCESS) or (status == SQL_PARAM_SUCCESS_WITH_INFO);
+        if (succeeded and not error) {
+            ++transferred_sets_;
+        } else if (error or (status == SQL_PARAM_ERROR)) {
+            // If the batch failed as a whole, the database may have rolled back
+            // sets it reported as successful, e.g. after a deadlock or with XACT_ABORT
+            failed_parameter_set failure = {first_set + i, status == SQL_PARAM_ERROR, {}};
+            // row numbers of diagnostics are one-based positions in the parameter array
+            auto const match = std::find_if(diagnostics.begin(), diagnostics.end(),
+                                            [i](cpp_odbc::level2::row_diagnostic_record const & record) {
+                                                return record.row_number == static_cast<SQLLEN>(i + 1);
+                                            });
+            if (match != diagnostics.end()) {
+                failure.diagnostic = match->record;
+            }
+            failed_sets_.push_back(std::move(failure));
+        }
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+void bound_parameter_set::adapt_buffered_sets(std::size_t sets_in_batch, std::chrono::nanoseconds latency)
+{
+    std::size_t bytes_per_set = 0;
+    for (auto const & parameter : parameters_) {
+        bytes_per_set += parameter->get_buffer().capacity_per_element() + sizeof(intptr_t);
+    }
+    tuner_->record(sets_in_batch, latency, buffer_memory_limit_ / std::max(bytes_per_set, std::size_t(1)));
+
+    // Buffers never shrink. Values of a set which was only partially written
+    // before the batch was executed thus survive the resize.
+    buffered_sets_ = tuner_->recommended_sets();
+    bool grown = false;
+    if ((not table_valued_) and (status_.size() < buffered_sets_)) {
+        status_.resize(buffered_sets_, SQL_PARAM_UNUSED);
+        grown = true;
+    }
+    for (auto & parameter : parameters_) {
+        auto & buffer = parameter->get_buffer();
+        if (buffer.number_of_elements() < buffered_sets_) {
+            buffer.resize(buffered_sets_);
+            grown = true;
+        }
+    }
+    if (grown and not bind_on_execute_) {
+        bind();
+    }
 }
 
 std::vector<type_code> const & bound_parameter_set::get_initial_parameter_types() const
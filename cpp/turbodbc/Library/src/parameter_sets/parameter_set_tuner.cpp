@@ -0,0 +1,85 @@
+#include <turbodbc/parameter_sets/parameter_set_tuner.h>
+
+#include <algorithm>
+#include <limits>
+#include <ciso646>
+
+namespace turbodbc {
+
+namespace {
+    // growing only pays off if throughput improves noticeably; smaller
+    // gains are usually measurement noise
+    double const minimum_improvement = 1.05;
+    // settled batches which could have doubled before sizes are probed again
+    std::size_t const batches_before_regrowth = 16;
+}
+
+parameter_set_tuner::parameter_set_tuner(std::size_t initial_sets, std::chrono::milliseconds latency_target) :
+    current_sets_(std::max(initial_sets, std::size_t(1))),
+    best_sets_(current_sets_),
+    best_throughput_(0.0),
+    settled_(false),
+    batches_with_headroom_(0),
+    latency_target_(latency_target)
+{
+}
+
+std::size_t parameter_set_tuner::recommended_sets() const
+{
+    return current_sets_;
+}
+
+void parameter_set_tuner::record(std::size_t sets, std::chrono::nanoseconds latency, std::size_t maximum_sets)
+{
+    maximum_sets = std::max(maximum_sets, std::size_t(1));
+    if (sets >= current_sets_) {
+        auto const seconds = std::chrono::duration<double>(latency).count();
+        auto const throughput = (seconds > 0.0) ? sets / seconds : std::numeric_limits<double>::max();
+
+        if (latency > latency_target_) {
+            // long batches block other writers, whatever their throughput
+            current_sets_ = std::max(current_sets_ / 2, std::size_t(1));
+            best_sets_ = std::min(best_sets_, current_sets_);
+            settled_ = true;
+            batches_with_headroom_ = 0;
+        } else if (settled_) {
+            // conditions change, e.g. a slow batch may have been an outlier
+            bool const has_headroom = (2 * latency <= latency_target_) and (2 * current_sets_ <= maximum_sets);
+            batches_with_headroom_ = has_headroom ? batches_with_headroom_ + 1 : 0;
+            if (batches_with_headroom_ == batches_before_regrowth) {
+                best_throughput_ = throughput;
+                best_sets_ = current_sets_;
+                current_sets_ *= 2;
+                settled_ = false;
+                batches_with_headroom_ = 0;
+            }
+        } else {
+            if (throughput > best_throughput_ * minimum_improvement) {
+                best_throughput_ = throughput;
+                best_sets_ = current_sets_;
+                // latency grows about linearly with the batch size
+                if ((2 * latency <= latency_target_) and (2 * current_sets_ <= maximum_sets)) {
+                    current_sets_ *= 2;
+                } else {
+                    settled_ = true;
+                }
+            } else {
+                current_sets_ = best_sets_;
+                settled_ = true;
+            }
+        }
+    }
+    current_sets_ = std::min(current_sets_, maximum_sets);
+}
+
+double parameter_set_tuner::best_throughput() const
+{
+    return best_throughput_;
+}
+
+bool parameter_set_tuner::is_settled() const
+{
+    return settled_;
+}
+
+}
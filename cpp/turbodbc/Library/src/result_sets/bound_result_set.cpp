@@ -92,4 +92,11 @@ std::vector<std::reference_wrapper<cpp_odbc::multi_value_buffer const>> bound_re
 }
 
 
+bool bound_result_set::do_bind_external_data(std::size_t zero_based_column, char * data)
+{
+    columns_[zero_based_column].bind_external_data(data);
+    return true;
+}
+
+
 } }
@@ -7,42 +7,75 @@
 #include <boost/variant.hpp>
 #include <sqlext.h>
 
+#include <algorithm>
 #include <future>
+#include <limits>
 
 namespace turbodbc { namespace result_sets {
 
 namespace {
 
-    std::size_t const stop_fetching_results = 2;
+    std::size_t const stop_fetching_results = std::numeric_limits<std::size_t>::max();
+    std::size_t const minimum_slots = 2;
 
     void reader_thread(detail::message_queue<std::size_t> & read_requests,
                        detail::message_queue<std::shared_future<std::size_t>> & read_responses,
-                       std::array<bound_result_set, 2> & batches)
+                       std::vector<bound_result_set> & batches,
+                       std::atomic<std::size_t> & fetched_ahead,
+                       std::atomic<std::int64_t> & producer_wait)
     {
         std::size_t batch_id = 0;
+        bool exhausted = false;
         do {
             // catch exceptions since uncaught exceptions in threads are deadly
             try {
+                auto const waiting_since = std::chrono::steady_clock::now();
                 batch_id = read_requests.pull();
                 if (batch_id != stop_fetching_results) {
-                    batches[batch_id].rebind();
+                    if (not exhausted) {
+                        auto const waited = std::chrono::steady_clock::now() - waiting_since;
+                        producer_wait += std::chrono::duration_cast<std::chrono::nanoseconds>(waited).count();
+                    }
                     std::promise<std::size_t> promise;
-                    promise.set_value(batches[batch_id].fetch_next_batch());
+                    if (exhausted) {
+                        // do not bother the database once the result set is exhausted
+                        promise.set_value(0);
+                    } else {
+                        batches[batch_id].rebind();
+                        auto const rows = batches[batch_id].fetch_next_batch();
+                        exhausted = (rows == 0);
+                        promise.set_value(rows);
+                    }
                     read_responses.push(promise.get_future().share());
+                    ++fetched_ahead;
                 }
             } catch (...) {
                 std::promise<std::size_t> promise;
                 promise.set_exception(std::current_exception());
                 read_responses.push(promise.get_future().share());
+                ++fetched_ahead;
             }
         } while (batch_id != stop_fetching_results);
 
     }
 
-    turbodbc::options options_with_half_read_buffer(turbodbc::options options)
+    std::size_t number_of_slots(turbodbc::options const & options)
     {
-        options.read_buffer_size = boost::apply_visitor(halve_buffer_size(), options.read_buffer_size);
-        return options;
+        return std::max(options.prefetch_slots, minimum_slots);
+    }
+
+    std::vector<bound_result_set> make_slots(std::shared_ptr<cpp_odbc::statement const> const & statement,
+                                             turbodbc::options options)
+    {
+        auto const slots = number_of_slots(options);
+        options.read_buffer_size = boost::apply_visitor(split_buffer_size(slots), options.read_buffer_size);
+
+        std::vector<bound_result_set> batches;
+        batches.reserve(slots);
+        for (std::size_t i = 0; i != slots; ++i) {
+            batches.emplace_back(statement, options);
+        }
+        return batches;
     }
 
 }
@@ -51,30 +84,67 @@ namespace {
 double_buffered_result_set::double_buffered_result_set(std::shared_ptr<cpp_odbc::statement const> statement,
                                                        turbodbc::options const & options) :
     statement_(statement),
-    batches_{{bound_result_set(statement_, options_with_half_read_buffer(options)),
-              bound_result_set(statement_, options_with_half_read_buffer(options))}},
+    batches_(make_slots(statement_, options)),
     active_reading_batch_(0),
+    fetched_ahead_(0),
+    producer_wait_(0),
+    statistics_{batches_.size(), 0, 0, 0, 0, std::chrono::nanoseconds(0), std::chrono::nanoseconds(0)},
     reader_(reader_thread,
             std::ref(read_requests_),
             std::ref(read_responses_),
-            std::ref(batches_))
+            std::ref(batches_),
+            std::ref(fetched_ahead_),
+            std::ref(producer_wait_))
 {
-    read_requests_.push(active_reading_batch_);
-    active_reading_batch_ = 1;
+    // the reader fetches into all slots but the one the consumer holds
+    for (; active_reading_batch_ + 1 != batches_.size(); ++active_reading_batch_) {
+        read_requests_.push(active_reading_batch_);
+    }
 }
 
 double_buffered_result_set::~double_buffered_result_set()
 {
-    read_requests_.push(stop_fetching_results);
-    reader_.join();
+    stop_reader();
+}
+
+void double_buffered_result_set::stop_reader()
+{
+    if (reader_.joinable()) {
+        // the reader finishes outstanding requests first
+        read_requests_.push(stop_fetching_results);
+        reader_.join();
+    }
+}
+
+
+prefetch_statistics double_buffered_result_set::get_prefetch_statistics() const
+{
+    auto statistics = statistics_;
+    statistics.producer_wait = std::chrono::nanoseconds(producer_wait_.load());
+    return statistics;
 }
 
 
 std::size_t double_buffered_result_set::do_fetch_next_batch()
 {
+    auto const ahead = fetched_ahead_.load();
+    ++statistics_.requested_batches;
+    statistics_.fetched_ahead += ahead;
+    if (ahead == 0) {
+        ++statistics_.requests_finding_ring_empty;
+    }
+    if (ahead + 1 == batches_.size()) {
+        ++statistics_.requests_finding_ring_full;
+    }
+
     read_requests_.push(active_reading_batch_);
-    active_reading_batch_ = (active_reading_batch_ == 0) ? 1 : 0;
-    return read_responses_.pull().get();
+    active_reading_batch_ = (active_reading_batch_ + 1) % batches_.size();
+
+    auto const waiting_since = std::chrono::steady_clock::now();
+    auto response = read_responses_.pull();
+    statistics_.consumer_wait += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - waiting_since);
+    --fetched_ahead_;
+    return response.get();
 }
 
 
@@ -89,4 +159,10 @@ std::vector<std::reference_wrapper<cpp_odbc::multi_value_buffer const>> double_b
     return batches_[active_reading_batch_].get_buffers();
 }
 
+
+void double_buffered_result_set::do_close()
+{
+    stop_reader();
+}
+
 } }
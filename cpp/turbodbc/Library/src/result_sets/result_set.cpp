@@ -1,12 +1,31 @@
 #include <turbodbc/result_sets/result_set.h>
 
+#include <turbodbc/errors.h>
+
 namespace turbodbc { namespace result_sets {
 
-result_set::result_set() = default;
+namespace {
+
+	void throw_if_closed(bool closed)
+	{
+		if (closed) {
+			throw interface_error("The result set was closed");
+		}
+	}
+
+}
+
+result_set::result_set() :
+	closed_(false)
+{
+}
+
 result_set::~result_set() = default;
 
 std::size_t result_set::fetch_next_batch()
 {
+	std::lock_guard<std::mutex> lock(statement_mutex_);
+	throw_if_closed(closed_);
 	return do_fetch_next_batch();
 }
 
@@ -20,5 +39,30 @@ std::vector<std::reference_wrapper<cpp_odbc::multi_value_buffer const>> result_s
 	return do_get_buffers();
 }
 
+bool result_set::bind_external_data(std::size_t zero_based_column, char * data)
+{
+	std::lock_guard<std::mutex> lock(statement_mutex_);
+	throw_if_closed(closed_);
+	return do_bind_external_data(zero_based_column, data);
+}
+
+void result_set::close()
+{
+	std::lock_guard<std::mutex> lock(statement_mutex_);
+	if (not closed_) {
+		closed_ = true;
+		do_close();
+	}
+}
+
+bool result_set::do_bind_external_data(std::size_t, char *)
+{
+	return false;
+}
+
+void result_set::do_close()
+{
+}
+
 
 } }
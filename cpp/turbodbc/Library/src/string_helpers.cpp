@@ -1,12 +1,18 @@
 #include <turbodbc/string_helpers.h>
 
 #include <algorithm>
+#include <ciso646>
 
 #ifdef _WIN32
 #include <windows.h>
 #endif
 #include <sqlext.h>
 
+#if defined(__SSE2__) or defined(_M_X64)
+    #define TURBODBC_HAS_SSE2 1
+    #include <emmintrin.h>
+#endif
+
 
 namespace turbodbc {
 
@@ -21,4 +27,200 @@ std::size_t buffered_string_size(intptr_t length_indicator, std::size_t maximum_
 }
 
 
+namespace {
+
+    bool is_high_surrogate(char32_t unit)
+    {
+        return (unit >= 0xD800) and (unit <= 0xDBFF);
+    }
+
+    bool is_low_surrogate(char32_t unit)
+    {
+        return (unit >= 0xDC00) and (unit <= 0xDFFF);
+    }
+
+    char * encode_utf8(char32_t code_point, char * output)
+    {
+        if (code_point < 0x80) {
+            *output++ = static_cast<char>(code_point);
+        } else if (code_point < 0x800) {
+            *output++ = static_cast<char>(0xC0 | (code_point >> 6));
+            *output++ = static_cast<char>(0x80 | (code_point & 0x3F));
+        } else if (code_point < 0x10000) {
+            *output++ = static_cast<char>(0xE0 | (code_point >> 12));
+            *output++ = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+            *output++ = static_cast<char>(0x80 | (code_point & 0x3F));
+        } else {
+            *output++ = static_cast<char>(0xF0 | (code_point >> 18));
+            *output++ = static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+            *output++ = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+            *output++ = static_cast<char>(0x80 | (code_point & 0x3F));
+        }
+        return output;
+    }
+
+    std::size_t const block_size = 8;
+    std::size_t const utf8_block_size = 16;
+
+    bool is_continuation(unsigned char byte)
+    {
+        return (byte & 0xC0) == 0x80;
+    }
+
+    /**
+     * @brief Decode the sequence starting at input[i] and advance i past it.
+     *        Invalid sequences consume a single byte and yield U+FFFD.
+     */
+    char32_t decode_utf8(unsigned char const * input, std::size_t length, std::size_t & i)
+    {
+        unsigned char const lead = input[i];
+        std::size_t const remaining = length - i;
+        if (lead < 0x80) {
+            ++i;
+            return lead;
+        }
+        if ((lead >= 0xC2) and (lead <= 0xDF)) {
+            if ((remaining >= 2) and is_continuation(input[i + 1])) {
+                char32_t const code_point = ((lead & 0x1F) << 6) | (input[i + 1] & 0x3F);
+                i += 2;
+                return code_point;
+            }
+        } else if ((lead >= 0xE0) and (lead <= 0xEF)) {
+            // exclude overlong encodings and UTF-16 surrogates
+            unsigned char const minimum = (lead == 0xE0) ? 0xA0 : 0x80;
+            unsigned char const maximum = (lead == 0xED) ? 0x9F : 0xBF;
+            if ((remaining >= 3) and (input[i + 1] >= minimum) and (input[i + 1] <= maximum)
+                and is_continuation(input[i + 2])) {
+                char32_t const code_point = ((lead & 0x0F) << 12) | ((input[i + 1] & 0x3F) << 6) | (input[i + 2] & 0x3F);
+                i += 3;
+                return code_point;
+            }
+        } else if ((lead >= 0xF0) and (lead <= 0xF4)) {
+            // exclude overlong encodings and code points beyond U+10FFFF
+            unsigned char const minimum = (lead == 0xF0) ? 0x90 : 0x80;
+            unsigned char const maximum = (lead == 0xF4) ? 0x8F : 0xBF;
+            if ((remaining >= 4) and (input[i + 1] >= minimum) and (input[i + 1] <= maximum)
+                and is_continuation(input[i + 2]) and is_continuation(input[i + 3])) {
+                char32_t const code_point = ((lead & 0x07) << 18) | ((input[i + 1] & 0x3F) << 12)
+                                            | ((input[i + 2] & 0x3F) << 6) | (input[i + 3] & 0x3F);
+                i += 4;
+                return code_point;
+            }
+        }
+        ++i;
+        return 0xFFFD;
+    }
+
+#ifdef TURBODBC_HAS_SSE2
+    bool is_ascii_block(unsigned char const * input)
+    {
+        auto const bytes = _mm_loadu_si128(reinterpret_cast<__m128i const *>(input));
+        return _mm_movemask_epi8(bytes) == 0;
+    }
+#endif
+
+}
+
+
+std::size_t utf16_to_utf8(char16_t const * input, std::size_t length, char * output)
+{
+    char * out = output;
+    std::size_t i = 0;
+#ifdef TURBODBC_HAS_SSE2
+    __m128i const non_ascii_bits = _mm_set1_epi16(static_cast<short>(0xFF80));
+    __m128i const zero = _mm_setzero_si128();
+#endif
+
+    while (i != length) {
+#ifdef TURBODBC_HAS_SSE2
+        // ASCII fast path: narrow eight code units at once while all of them are below 0x80
+        while (length - i >= block_size) {
+            auto const units = _mm_loadu_si128(reinterpret_cast<__m128i const *>(input + i));
+            auto const is_ascii = _mm_cmpeq_epi16(_mm_and_si128(units, non_ascii_bits), zero);
+            if (_mm_movemask_epi8(is_ascii) != 0xFFFF) {
+                break;
+            }
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(out), _mm_packus_epi16(units, units));
+            out += block_size;
+            i += block_size;
+        }
+#endif
+        // Scalar path for (at least) the next block before trying the fast path again
+        std::size_t const block_end = std::min(i + block_size, length);
+        while (i < block_end) {
+            char32_t const unit = input[i++];
+            if (unit < 0x80) {
+                *out++ = static_cast<char>(unit);
+            } else if (is_high_surrogate(unit) and (i != length) and is_low_surrogate(input[i])) {
+                char32_t const low = input[i++];
+                out = encode_utf8(0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00), out);
+            } else if (is_high_surrogate(unit) or is_low_surrogate(unit)) {
+                out = encode_utf8(0xFFFD, out);
+            } else {
+                out = encode_utf8(unit, out);
+            }
+        }
+    }
+    return out - output;
+}
+
+
+
+std::size_t utf8_to_utf16_length(char const * input, std::size_t length)
+{
+    auto const bytes = reinterpret_cast<unsigned char const *>(input);
+    std::size_t units = 0;
+    std::size_t i = 0;
+
+    while (i != length) {
+#ifdef TURBODBC_HAS_SSE2
+        while ((length - i >= utf8_block_size) and is_ascii_block(bytes + i)) {
+            units += utf8_block_size;
+            i += utf8_block_size;
+        }
+#endif
+        std::size_t const block_end = std::min(i + utf8_block_size, length);
+        while (i < block_end) {
+            units += (decode_utf8(bytes, length, i) < 0x10000) ? 1 : 2;
+        }
+    }
+    return units;
+}
+
+
+std::size_t utf8_to_utf16(char const * input, std::size_t length, char16_t * output)
+{
+    auto const bytes = reinterpret_cast<unsigned char const *>(input);
+    char16_t * out = output;
+    std::size_t i = 0;
+#ifdef TURBODBC_HAS_SSE2
+    __m128i const zero = _mm_setzero_si128();
+#endif
+
+    while (i != length) {
+#ifdef TURBODBC_HAS_SSE2
+        // ASCII fast path: widen sixteen bytes at once while none of them has the high bit set
+        while ((length - i >= utf8_block_size) and is_ascii_block(bytes + i)) {
+            auto const block = _mm_loadu_si128(reinterpret_cast<__m128i const *>(bytes + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm_unpacklo_epi8(block, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 8), _mm_unpackhi_epi8(block, zero));
+            out += utf8_block_size;
+            i += utf8_block_size;
+        }
+#endif
+        std::size_t const block_end = std::min(i + utf8_block_size, length);
+        while (i < block_end) {
+            char32_t const code_point = decode_utf8(bytes, length, i);
+            if (code_point < 0x10000) {
+                *out++ = static_cast<char16_t>(code_point);
+            } else {
+                *out++ = static_cast<char16_t>(0xD800 + ((code_point - 0x10000) >> 10));
+                *out++ = static_cast<char16_t>(0xDC00 + ((code_point - 0x10000) & 0x3FF));
+            }
+        }
+    }
+    return out - output;
+}
+
+
 }
\ No newline at end of file
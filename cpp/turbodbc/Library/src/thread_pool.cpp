@@ -0,0 +1,160 @@
+#include <turbodbc/thread_pool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <ciso646>
+
+namespace turbodbc {
+
+namespace {
+
+    /**
+     * @brief State which is shared between all workers of a single parallel_for
+     *        invocation. It is kept alive by the workers since the calling
+     *        thread may return while pool threads still hold a reference.
+     */
+    struct parallel_for_state {
+        parallel_for_state(std::size_t n_tasks, std::function<void(std::size_t)> const & task) :
+            n_tasks(n_tasks), task(task), next_task(0), active_workers(0)
+        {
+        }
+
+        void run()
+        {
+            for (auto i = next_task++; i < n_tasks; i = next_task++) {
+                try {
+                    task(i);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (not error) {
+                        error = std::current_exception();
+                    }
+                    next_task = n_tasks;
+                }
+            }
+        }
+
+        /**
+         * @brief Register a pool thread as a worker. Helpers which start after
+         *        all tasks have been claimed do not register, so that the
+         *        calling thread does not wait for helpers stuck in the queue.
+         */
+        bool start_worker()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (next_task >= n_tasks) {
+                return false;
+            }
+            ++active_workers;
+            return true;
+        }
+
+        void finish_worker()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                --active_workers;
+            }
+            done.notify_all();
+        }
+
+        std::size_t const n_tasks;
+        std::function<void(std::size_t)> const & task;
+        std::atomic<std::size_t> next_task;
+        std::size_t active_workers;
+        std::exception_ptr error;
+        std::mutex mutex;
+        std::condition_variable done;
+    };
+
+}
+
+thread_pool::thread_pool(std::size_t n_threads) :
+    stopping_(false)
+{
+    workers_.reserve(n_threads);
+    for (std::size_t i = 0; i != n_threads; ++i) {
+        workers_.emplace_back([this](){ work(); });
+    }
+}
+
+thread_pool::~thread_pool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    condition_.notify_all();
+    for (auto & worker : workers_) {
+        worker.join();
+    }
+}
+
+std::size_t thread_pool::size() const
+{
+    return workers_.size();
+}
+
+void thread_pool::parallel_for(std::size_t n_tasks, std::size_t max_workers,
+                               std::function<void(std::size_t)> const & task)
+{
+    if (n_tasks == 0) {
+        return;
+    }
+
+    auto state = std::make_shared<parallel_for_state>(n_tasks, task);
+    auto const helpers = std::min({n_tasks, std::max<std::size_t>(max_workers, 1), size() + 1}) - 1;
+
+    for (std::size_t i = 0; i != helpers; ++i) {
+        submit([state](){
+            if (state->start_worker()) {
+                state->run();
+                state->finish_worker();
+            }
+        });
+    }
+
+    state->run();
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->done.wait(lock, [&](){ return state->active_workers == 0; });
+    if (state->error) {
+        std::rethrow_exception(state->error);
+    }
+}
+
+thread_pool & thread_pool::shared()
+{
+    static thread_pool pool(std::max(std::thread::hardware_concurrency(), 1u));
+    return pool;
+}
+
+void thread_pool::submit(std::function<void()> job)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        jobs_.push(std::move(job));
+    }
+    condition_.notify_one();
+}
+
+void thread_pool::work()
+{
+    while (true) {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            condition_.wait(lock, [&](){ return stopping_ or not jobs_.empty(); });
+            if (jobs_.empty()) {
+                return;
+            }
+            job = std::move(jobs_.front());
+            jobs_.pop();
+        }
+        job();
+    }
+}
+
+}
@@ -1,84 +1,386 @@
 #include <turbodbc/time_helpers.h>
+#include <turbodbc/errors.h>
+#include <turbodbc/sql_server_types.h>
 
 #ifdef _WIN32
 #include <windows.h>
 #endif
-#include <cstring>
 #include <sql.h>
 
-#include <boost/date_time/gregorian/gregorian_types.hpp>
-#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <cstdio>
 
 namespace turbodbc {
 
 namespace {
-    boost::posix_time::ptime const timestamp_epoch({1970, 1, 1}, {0, 0, 0, 0});
-    boost::gregorian::date const date_epoch(1970, 1, 1);
+
+    int64_t const seconds_per_day = 86400;
+    int64_t const milliseconds_per_second = 1000;
+    int64_t const microseconds_per_second = 1000000;
+    int64_t const nanoseconds_per_second = 1000000000;
+    int64_t const nanoseconds_per_microsecond = 1000;
+
+    // Whole seconds since the epoch whose nanoseconds fit into int64_t with any
+    // fraction, i.e., 1677-09-21T00:12:44 to 2262-04-11T23:47:15
+    int64_t const minimum_nanosecond_seconds = -9223372036;
+    int64_t const maximum_nanosecond_seconds = 9223372035;
+
+    // Division rounding towards negative infinity for positive divisors
+    inline int64_t floor_divide(int64_t value, int64_t divisor)
+    {
+        int64_t const quotient = value / divisor;
+        return quotient - ((value % divisor) < 0);
+    }
+
+    // Non-negative remainder matching floor_divide
+    inline int64_t floor_modulo(int64_t value, int64_t divisor)
+    {
+        int64_t const remainder = value % divisor;
+        return remainder + (remainder < 0) * divisor;
+    }
+
+    // Days since 1970-01-01 in the proleptic Gregorian calendar.
+    // Algorithm by Howard Hinnant, see http://howardhinnant.github.io/date_algorithms.html
+    inline int64_t days_from_civil(int64_t year, int64_t month, int64_t day)
+    {
+        year -= (month <= 2);
+        int64_t const era = floor_divide(year, 400);
+        int64_t const year_of_era = year - era * 400;
+        int64_t const day_of_year = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+        int64_t const day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+        return era * 146097 + day_of_era - 719468;
+    }
+
+    struct civil_date {
+        int64_t year;
+        int64_t month;
+        int64_t day;
+    };
+
+    // Inverse of days_from_civil
+    inline civil_date civil_from_days(int64_t days)
+    {
+        days += 719468;
+        int64_t const era = floor_divide(days, 146097);
+        int64_t const day_of_era = days - era * 146097;
+        int64_t const year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+        int64_t const day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+        int64_t const shifted_month = (5 * day_of_year + 2) / 153;
+        int64_t const month = shifted_month < 10 ? shifted_month + 3 : shifted_month - 9;
+        return {year_of_era + era * 400 + (month <= 2), month, day_of_year - (153 * shifted_month + 2) / 5 + 1};
+    }
+
+    inline int64_t to_seconds(SQL_TIMESTAMP_STRUCT const & sql_ts)
+    {
+        return days_from_civil(sql_ts.year, sql_ts.month, sql_ts.day) * seconds_per_day
+             + sql_ts.hour * 3600 + sql_ts.minute * 60 + sql_ts.second;
+    }
+
+    inline int64_t to_seconds(ss_timestampoffset_struct const & sql_ts)
+    {
+        // the offset is added to UTC to obtain the stored local time
+        int64_t const offset_minutes = sql_ts.timezone_hour * 60 + sql_ts.timezone_minute;
+        return days_from_civil(sql_ts.year, sql_ts.month, sql_ts.day) * seconds_per_day
+             + sql_ts.hour * 3600 + (sql_ts.minute - offset_minutes) * 60 + sql_ts.second;
+    }
+
+    // Microseconds cover all years SQL Server supports
+    template <typename Struct>
+    inline int64_t to_microseconds(Struct const & sql_ts)
+    {
+        return to_seconds(sql_ts) * microseconds_per_second + sql_ts.fraction / nanoseconds_per_microsecond;
+    }
+
+    inline int64_t to_nanoseconds(ss_time2_struct const & sql_time)
+    {
+        int64_t const seconds = sql_time.hour * 3600 + sql_time.minute * 60 + sql_time.second;
+        return seconds * nanoseconds_per_second + sql_time.fraction;
+    }
+
+    template <typename Struct>
+    [[noreturn]] void throw_out_of_nanosecond_range(Struct const & sql_ts)
+    {
+        char value[48];
+        std::snprintf(value, sizeof(value), "%04d-%02d-%02d %02d:%02d:%02d",
+                      static_cast<int>(sql_ts.year), static_cast<int>(sql_ts.month), static_cast<int>(sql_ts.day),
+                      static_cast<int>(sql_ts.hour), static_cast<int>(sql_ts.minute), static_cast<int>(sql_ts.second));
+        throw interface_error(std::string("Timestamp ") + value + " is outside the range 1677-09-21 to 2262-04-11 "
+                              "of nanosecond timestamps. Disable fetch_nanosecond_timestamps to fetch it "
+                              "with microsecond resolution.");
+    }
+
+    template <typename Struct>
+    void to_nanoseconds_impl(char const * data_pointer, intptr_t const * indicators, std::size_t n_values, int64_t * nanoseconds)
+    {
+        auto const values = reinterpret_cast<Struct const *>(data_pointer);
+        bool out_of_range = false;
+        for (std::size_t i = 0; i != n_values; ++i) {
+            auto const seconds = to_seconds(values[i]);
+            bool const in_range = (minimum_nanosecond_seconds <= seconds) and (seconds <= maximum_nanosecond_seconds);
+            bool const is_null = (indicators[i] == SQL_NULL_DATA);
+            out_of_range = out_of_range or not (in_range or is_null);
+            nanoseconds[i] = (in_range and not is_null) ? seconds * nanoseconds_per_second + values[i].fraction : 0;
+        }
+        if (out_of_range) {
+            for (std::size_t i = 0; i != n_values; ++i) {
+                auto const seconds = to_seconds(values[i]);
+                if ((indicators[i] != SQL_NULL_DATA) and ((seconds < minimum_nanosecond_seconds) or (seconds > maximum_nanosecond_seconds))) {
+                    throw_out_of_nanosecond_range(values[i]);
+                }
+            }
+        }
+    }
+
+    template <typename Struct>
+    void to_microseconds_impl(char const * data_pointer, intptr_t const * indicators, std::size_t n_values, int64_t * microseconds)
+    {
+        auto const values = reinterpret_cast<Struct const *>(data_pointer);
+        for (std::size_t i = 0; i != n_values; ++i) {
+            auto const value = to_microseconds(values[i]);
+            microseconds[i] = (indicators[i] == SQL_NULL_DATA) ? 0 : value;
+        }
+    }
+
+    inline int64_t to_days(SQL_DATE_STRUCT const & sql_date)
+    {
+        return days_from_civil(sql_date.year, sql_date.month, sql_date.day);
+    }
+
+    // Fills an SQL_TIMESTAMP_STRUCT from a count of ticks since the epoch
+    template <int64_t TicksPerSecond>
+    inline void ticks_to_timestamp(int64_t ticks, SQL_TIMESTAMP_STRUCT & sql_ts)
+    {
+        int64_t const seconds = floor_divide(ticks, TicksPerSecond);
+        int64_t const days = floor_divide(seconds, seconds_per_day);
+        int64_t const seconds_of_day = seconds - days * seconds_per_day;
+        auto const date = civil_from_days(days);
+        sql_ts.year = static_cast<SQLSMALLINT>(date.year);
+        sql_ts.month = static_cast<SQLUSMALLINT>(date.month);
+        sql_ts.day = static_cast<SQLUSMALLINT>(date.day);
+        sql_ts.hour = static_cast<SQLUSMALLINT>(seconds_of_day / 3600);
+        sql_ts.minute = static_cast<SQLUSMALLINT>((seconds_of_day / 60) % 60);
+        sql_ts.second = static_cast<SQLUSMALLINT>(seconds_of_day % 60);
+        sql_ts.fraction = static_cast<SQLUINTEGER>(floor_modulo(ticks, TicksPerSecond) * (nanoseconds_per_second / TicksPerSecond));
+    }
+
+    inline void days_to_sql_date(int64_t days, SQL_DATE_STRUCT & sql_date)
+    {
+        auto const date = civil_from_days(days);
+        sql_date.year = static_cast<SQLSMALLINT>(date.year);
+        sql_date.month = static_cast<SQLUSMALLINT>(date.month);
+        sql_date.day = static_cast<SQLUSMALLINT>(date.day);
+    }
+
+    // The batch loops contain no data-dependent branches so that compilers may vectorize them
+
+    template <typename Day>
+    void dates_to_days_impl(char const * data_pointer, intptr_t const * indicators, std::size_t n_values, Day * days)
+    {
+        auto const dates = reinterpret_cast<SQL_DATE_STRUCT const *>(data_pointer);
+        for (std::size_t i = 0; i != n_values; ++i) {
+            auto const value = static_cast<Day>(to_days(dates[i]));
+            days[i] = (indicators[i] == SQL_NULL_DATA) ? 0 : value;
+        }
+    }
+
+    template <typename Day>
+    void days_to_dates_impl(Day const * days, std::size_t n_values, char * data_pointer)
+    {
+        auto const dates = reinterpret_cast<SQL_DATE_STRUCT *>(data_pointer);
+        for (std::size_t i = 0; i != n_values; ++i) {
+            days_to_sql_date(days[i], dates[i]);
+        }
+    }
+
+    // Fills an SS_TIME2_STRUCT from a count of ticks since midnight
+    template <int64_t TicksPerSecond, typename Tick>
+    inline void ticks_to_time(Tick ticks, ss_time2_struct & sql_time)
+    {
+        int64_t const seconds_of_day = floor_modulo(floor_divide(ticks, TicksPerSecond), seconds_per_day);
+        sql_time.hour = static_cast<SQLUSMALLINT>(seconds_of_day / 3600);
+        sql_time.minute = static_cast<SQLUSMALLINT>((seconds_of_day / 60) % 60);
+        sql_time.second = static_cast<SQLUSMALLINT>(seconds_of_day % 60);
+        sql_time.fraction = static_cast<SQLUINTEGER>(floor_modulo(ticks, TicksPerSecond) * (nanoseconds_per_second / TicksPerSecond));
+    }
+
+    template <int64_t TicksPerSecond, typename Tick>
+    void ticks_to_times(Tick const * ticks, std::size_t n_values, char * data_pointer)
+    {
+        auto const times = reinterpret_cast<ss_time2_struct *>(data_pointer);
+        for (std::size_t i = 0; i != n_values; ++i) {
+            ticks_to_time<TicksPerSecond>(ticks[i], times[i]);
+        }
+    }
+
+    template <int64_t TicksPerSecond>
+    void ticks_to_timestamps(int64_t const * ticks, std::size_t n_values, char * data_pointer)
+    {
+        auto const timestamps = reinterpret_cast<SQL_TIMESTAMP_STRUCT *>(data_pointer);
+        for (std::size_t i = 0; i != n_values; ++i) {
+            ticks_to_timestamp<TicksPerSecond>(ticks[i], timestamps[i]);
+        }
+    }
+
 }
 
 
 int64_t timestamp_to_microseconds(char const * data_pointer)
 {
-    auto & sql_ts = *reinterpret_cast<SQL_TIMESTAMP_STRUCT const *>(data_pointer);
-    intptr_t const microseconds = sql_ts.fraction / 1000;
-    boost::posix_time::ptime const ts({static_cast<unsigned short>(sql_ts.year), sql_ts.month, sql_ts.day},
-            {sql_ts.hour, sql_ts.minute, sql_ts.second, microseconds});
-    return (ts - timestamp_epoch).total_microseconds();
+    return to_microseconds(*reinterpret_cast<SQL_TIMESTAMP_STRUCT const *>(data_pointer));
 }
 
 
 void microseconds_to_timestamp(int64_t microseconds, char * data_pointer)
 {
-    // use time duration constructor instead of boost::posix_time::microseconds here
-    // because some older version of boost cause an overflow, see https://svn.boost.org/trac10/ticket/3471
-    // Debian 7's boost 1.49 seems to be affected, though the fix claims to be done with boost 1.43.
-    auto const ptime = timestamp_epoch + boost::posix_time::time_duration(0, 0, 0, microseconds);
-    auto const date = ptime.date();
-    auto const time = ptime.time_of_day();
-    auto & sql_ts = *reinterpret_cast<SQL_TIMESTAMP_STRUCT *>(data_pointer);
-    sql_ts.year = date.year();
-    sql_ts.month = date.month();
-    sql_ts.day = date.day();
-    sql_ts.hour = time.hours();
-    sql_ts.minute = time.minutes();
-    sql_ts.second = time.seconds();
-    sql_ts.fraction = time.fractional_seconds() * 1000;
+    ticks_to_timestamp<microseconds_per_second>(microseconds, *reinterpret_cast<SQL_TIMESTAMP_STRUCT *>(data_pointer));
 }
 
 
 void nanoseconds_to_timestamp(int64_t nanoseconds, char * data_pointer)
 {
-    // use time duration constructor instead of boost::posix_time::microseconds here
-    // because some older version of boost cause an overflow, see https://svn.boost.org/trac10/ticket/3471
-    // Debian 7's boost 1.49 seems to be affected, though the fix claims to be done with boost 1.43.
-    auto const ptime = timestamp_epoch + boost::posix_time::time_duration(0, 0, 0, nanoseconds / 1000);
-    auto const date = ptime.date();
-    auto const time = ptime.time_of_day();
-    auto & sql_ts = *reinterpret_cast<SQL_TIMESTAMP_STRUCT *>(data_pointer);
-    sql_ts.year = date.year();
-    sql_ts.month = date.month();
-    sql_ts.day = date.day();
-    sql_ts.hour = time.hours();
-    sql_ts.minute = time.minutes();
-    sql_ts.second = time.seconds();
-    sql_ts.fraction = time.fractional_seconds() * 1000 + nanoseconds % 1000;
+    ticks_to_timestamp<nanoseconds_per_second>(nanoseconds, *reinterpret_cast<SQL_TIMESTAMP_STRUCT *>(data_pointer));
 }
 
 
 int64_t date_to_days(char const * data_pointer)
 {
-    auto & sql_date = *reinterpret_cast<SQL_DATE_STRUCT const *>(data_pointer);
-    boost::gregorian::date const date(sql_date.year, sql_date.month, sql_date.day);
-    return (date - date_epoch).days();
+    return to_days(*reinterpret_cast<SQL_DATE_STRUCT const *>(data_pointer));
 }
 
 
 void days_to_date(int64_t days, char * data_pointer) {
-    auto const date = date_epoch + boost::gregorian::date_duration(days);
-    auto &sql_date = *reinterpret_cast<SQL_DATE_STRUCT *>(data_pointer);
-    sql_date.year = date.year();
-    sql_date.month = date.month();
-    sql_date.day = date.day();
+    days_to_sql_date(days, *reinterpret_cast<SQL_DATE_STRUCT *>(data_pointer));
+}
+
+
+void timestamps_to_microseconds(char const * data_pointer, intptr_t const * indicators,
+                                std::size_t n_values, int64_t * microseconds)
+{
+    to_microseconds_impl<SQL_TIMESTAMP_STRUCT>(data_pointer, indicators, n_values, microseconds);
+}
+
+
+void timestamps_to_nanoseconds(char const * data_pointer, intptr_t const * indicators,
+                               std::size_t n_values, int64_t * nanoseconds)
+{
+    to_nanoseconds_impl<SQL_TIMESTAMP_STRUCT>(data_pointer, indicators, n_values, nanoseconds);
+}
+
+
+void timestamp_offsets_to_microseconds(char const * data_pointer, intptr_t const * indicators,
+                                       std::size_t n_values, int64_t * microseconds)
+{
+    to_microseconds_impl<ss_timestampoffset_struct>(data_pointer, indicators, n_values, microseconds);
+}
+
+
+void timestamp_offsets_to_nanoseconds(char const * data_pointer, intptr_t const * indicators,
+                                      std::size_t n_values, int64_t * nanoseconds)
+{
+    to_nanoseconds_impl<ss_timestampoffset_struct>(data_pointer, indicators, n_values, nanoseconds);
+}
+
+
+void timestamp_offset_to_utc_timestamp(char const * data_pointer, char * timestamp_pointer)
+{
+    auto const & value = *reinterpret_cast<ss_timestampoffset_struct const *>(data_pointer);
+    auto & timestamp = *reinterpret_cast<SQL_TIMESTAMP_STRUCT *>(timestamp_pointer);
+    ticks_to_timestamp<1>(to_seconds(value), timestamp);
+    timestamp.fraction = value.fraction;
+}
+
+
+void times_to_nanoseconds(char const * data_pointer, intptr_t const * indicators,
+                          std::size_t n_values, int64_t * nanoseconds)
+{
+    auto const times = reinterpret_cast<ss_time2_struct const *>(data_pointer);
+    for (std::size_t i = 0; i != n_values; ++i) {
+        auto const value = to_nanoseconds(times[i]);
+        nanoseconds[i] = (indicators[i] == SQL_NULL_DATA) ? 0 : value;
+    }
+}
+
+
+void dates_to_days(char const * data_pointer, intptr_t const * indicators,
+                   std::size_t n_values, int64_t * days)
+{
+    dates_to_days_impl(data_pointer, indicators, n_values, days);
+}
+
+
+void dates_to_days(char const * data_pointer, intptr_t const * indicators,
+                   std::size_t n_values, int32_t * days)
+{
+    dates_to_days_impl(data_pointer, indicators, n_values, days);
+}
+
+
+void seconds_to_timestamps(int64_t const * seconds, std::size_t n_values, char * data_pointer)
+{
+    ticks_to_timestamps<1>(seconds, n_values, data_pointer);
+}
+
+
+void milliseconds_to_timestamps(int64_t const * milliseconds, std::size_t n_values, char * data_pointer)
+{
+    ticks_to_timestamps<milliseconds_per_second>(milliseconds, n_values, data_pointer);
+}
+
+
+void microseconds_to_timestamps(int64_t const * microseconds, std::size_t n_values, char * data_pointer)
+{
+    ticks_to_timestamps<microseconds_per_second>(microseconds, n_values, data_pointer);
+}
+
+
+void nanoseconds_to_timestamps(int64_t const * nanoseconds, std::size_t n_values, char * data_pointer)
+{
+    ticks_to_timestamps<nanoseconds_per_second>(nanoseconds, n_values, data_pointer);
+}
+
+
+void days_to_dates(int64_t const * days, std::size_t n_values, char * data_pointer)
+{
+    days_to_dates_impl(days, n_values, data_pointer);
+}
+
+
+void days_to_dates(int32_t const * days, std::size_t n_values, char * data_pointer)
+{
+    days_to_dates_impl(days, n_values, data_pointer);
+}
+
+
+void milliseconds_to_dates(int64_t const * milliseconds, std::size_t n_values, char * data_pointer)
+{
+    auto const dates = reinterpret_cast<SQL_DATE_STRUCT *>(data_pointer);
+    int64_t const milliseconds_per_day = seconds_per_day * milliseconds_per_second;
+    for (std::size_t i = 0; i != n_values; ++i) {
+        days_to_sql_date(floor_divide(milliseconds[i], milliseconds_per_day), dates[i]);
+    }
+}
+
+
+void seconds_to_times(int32_t const * seconds, std::size_t n_values, char * data_pointer)
+{
+    ticks_to_times<1>(seconds, n_values, data_pointer);
+}
+
+
+void milliseconds_to_times(int32_t const * milliseconds, std::size_t n_values, char * data_pointer)
+{
+    ticks_to_times<milliseconds_per_second>(milliseconds, n_values, data_pointer);
+}
+
+
+void microseconds_to_times(int64_t const * microseconds, std::size_t n_values, char * data_pointer)
+{
+    ticks_to_times<microseconds_per_second>(microseconds, n_values, data_pointer);
+}
+
+
+void nanoseconds_to_times(int64_t const * nanoseconds, std::size_t n_values, char * data_pointer)
+{
+    ticks_to_times<nanoseconds_per_second>(nanoseconds, n_values, data_pointer);
 }
 
 
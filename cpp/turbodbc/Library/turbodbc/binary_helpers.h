@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace turbodbc {
+
+/**
+ * @brief Convert n_values consecutive ROWVERSION values starting at
+ *        data_pointer, eight big-endian bytes each, to unsigned integers.
+ *        Values whose indicator is SQL_NULL_DATA yield 0.
+ */
+void rowversions_to_integers(char const * data_pointer, intptr_t const * indicators,
+                             std::size_t n_values, uint64_t * values);
+
+/**
+ * @brief Convert the ROWVERSION value stored at data_pointer to an unsigned integer
+ */
+uint64_t rowversion_to_integer(char const * data_pointer);
+
+/**
+ * @brief Copy the SQLGUID stored at data_pointer to 16 bytes in the
+ *        big-endian order of RFC 4122, as expected by uuid.UUID(bytes=...)
+ */
+void guid_to_bytes(char const * data_pointer, uint8_t * bytes);
+
+/**
+ * @brief Convert n_values consecutive SQLGUIDs starting at data_pointer to
+ *        16 bytes each as described above. Values whose indicator is
+ *        SQL_NULL_DATA yield zeros.
+ */
+void guids_to_bytes(char const * data_pointer, intptr_t const * indicators,
+                    std::size_t n_values, uint8_t * bytes);
+
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <ciso646>
+
+namespace turbodbc {
+
+/**
+ * @brief A thread-safe first-in first-out queue which holds at most capacity
+ *        values. Producers block while the queue is full, consumers block
+ *        while it is empty. Closing the queue releases all blocked threads.
+ */
+template <typename Value>
+class bounded_queue {
+public:
+    explicit bounded_queue(std::size_t capacity) :
+        capacity_(capacity == 0 ? 1 : capacity),
+        closed_(false)
+    {
+    }
+
+    /**
+     * @brief Append a value, waiting for free space if necessary.
+     * @return false if the queue was closed and the value was discarded
+     */
+    bool push(Value value)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            not_full_.wait(lock, [&](){ return closed_ or values_.size() < capacity_; });
+            if (closed_) {
+                return false;
+            }
+            values_.push_back(std::move(value));
+        }
+        not_empty_.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Remove the oldest value, waiting for one if necessary.
+     * @return false if the queue was closed and no values are left
+     */
+    bool pull(Value & value)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            not_empty_.wait(lock, [&](){ return closed_ or not values_.empty(); });
+            if (values_.empty()) {
+                return false;
+            }
+            value = std::move(values_.front());
+            values_.pop_front();
+        }
+        not_full_.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Reject further values. Values which are already queued may
+     *        still be pulled.
+     */
+    void close()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_ = true;
+        }
+        not_full_.notify_all();
+        not_empty_.notify_all();
+    }
+
+    std::size_t capacity() const
+    {
+        return capacity_;
+    }
+
+private:
+    std::size_t const capacity_;
+    bool closed_;
+    std::mutex mutex_;
+    std::condition_variable not_full_;
+    std::condition_variable not_empty_;
+    std::deque<Value> values_;
+};
+
+}
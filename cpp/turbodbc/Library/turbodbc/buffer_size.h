@@ -56,4 +56,21 @@ public:
     buffer_size operator()(megabytes const& m) const;
 };
 
+
+/**
+ * @brief A visitor used to divide a buffer size into a number of equal parts.
+ *        Parts are rounded up and hold at least one row or megabyte.
+ */
+class split_buffer_size
+    : public boost::static_visitor<buffer_size>
+{
+public:
+    split_buffer_size(std::size_t parts);
+    buffer_size operator()(rows const& r) const;
+    buffer_size operator()(megabytes const& m) const;
+
+private:
+    std::size_t parts_;
+};
+
 }
\ No newline at end of file
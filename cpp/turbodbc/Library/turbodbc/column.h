@@ -31,6 +31,15 @@ public:
 	 */
 	void bind();
 
+	/**
+	 * @brief Let the database write values of this column to external memory
+	 *        instead of the internal buffer and rebind the column. The indicators
+	 *        remain in the internal buffer.
+	 * @param data Memory suitable to hold one buffered batch of values, or nullptr
+	 *        to return to the internal buffer
+	 */
+	void bind_external_data(char * data);
+
 	column_info get_info() const;
 
 	/**
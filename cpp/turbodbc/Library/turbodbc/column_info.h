@@ -10,6 +10,8 @@ struct column_info {
     type_code type;
     std::size_t element_size;
     bool supports_null_values;
+    std::size_t precision = 0;   ///< significant digits of decimal columns
+    std::size_t scale = 0;       ///< digits right of the decimal point of decimal columns
 };
 
 }
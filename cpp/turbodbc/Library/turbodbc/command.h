@@ -36,6 +36,25 @@ public:
      */
     bound_parameter_set &get_parameters();
 
+    /**
+     * @brief Create an additional parameter set for this command which binds
+     *        its buffers only when a batch is executed. Several such sets may
+     *        be filled concurrently while one of them executes. Sets which
+     *        are transferred this way are not reflected by get_row_count().
+     *        The parameters returned by get_parameters() are bound again
+     *        before they are executed next.
+     */
+    std::unique_ptr<bound_parameter_set> make_parameters_bound_on_execute();
+
+    /**
+     * @brief Create a parameter set which sends its sets as the rows of a single
+     *        table-valued parameter of the given table type. The command's
+     *        statement must take the table as its only parameter. Like for
+     *        make_parameters_bound_on_execute(), the parameters returned by
+     *        get_parameters() are bound again before they are executed next.
+     */
+    std::unique_ptr<bound_parameter_set> make_table_parameter(std::u16string table_type_name, std::size_t number_of_columns);
+
     int64_t get_row_count();
 
     /**
@@ -43,6 +62,9 @@ public:
      * 
      * This should only be called directly prior to the destructor; it is not
      * valid to call any other method (except the destructor) after calling finalize.
+     * If the result set is still shared with others, e.g. a pipelined Arrow
+     * reader, it is closed first. This waits for a fetch in progress, and
+     * later fetches raise an interface_error.
      */
     void finalize();
 
@@ -17,6 +17,17 @@ struct options {
     bool limit_varchar_results_to_max;
     bool force_extra_capacity_for_unicode;
     bool fetch_wchar_as_char;
+    bool fetch_narrow_numeric_types;
+    bool fetch_exact_decimals;
+    bool fetch_rowversion_as_integer;
+    bool fetch_nanosecond_timestamps;
+    bool presize_string_parameters;
+    bool enable_bulk_copy;
+    bool adaptive_parameter_sets;
+    std::size_t parameter_buffer_megabytes;
+    std::size_t parameter_batch_milliseconds;
+    std::size_t parameter_set_retries;
+    std::size_t prefetch_slots;
 };
 
 struct capabilities {
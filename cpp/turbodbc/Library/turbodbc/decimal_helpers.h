@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace turbodbc {
+
+/**
+ * @brief Convert n_values consecutive SQL_NUMERIC_STRUCTs starting at
+ *        data_pointer to 128 bit two's complement integers with 16 little
+ *        endian bytes each, which is the layout of Arrow's Decimal128 values.
+ *        The scale is that of the bound descriptor. Values whose indicator
+ *        is SQL_NULL_DATA yield 0.
+ */
+void numerics_to_decimal128(char const * data_pointer, intptr_t const * indicators,
+                            std::size_t n_values, uint8_t * decimals);
+
+/**
+ * @brief Convert n_values 128 bit two's complement integers with 16 little
+ *        endian bytes each to SQL_NUMERIC_STRUCTs with the given precision
+ *        and scale, starting at data_pointer
+ */
+void decimal128_to_numerics(uint8_t const * decimals, std::size_t n_values,
+                            int precision, int scale, char * data_pointer);
+
+/**
+ * @brief Same as above, but for 256 bit integers with 32 little endian
+ *        bytes each as used by Arrow's Decimal256. Only the lower 128 bits
+ *        are kept, which suffices for precisions up to 38.
+ */
+void decimal256_to_numerics(uint8_t const * decimals, std::size_t n_values,
+                            int precision, int scale, char * data_pointer);
+
+/**
+ * @brief Convert n_values unsigned 64 bit integers to SQL_NUMERIC_STRUCTs
+ *        with precision 20 and scale 0, starting at data_pointer
+ */
+void uint64_to_numerics(uint64_t const * values, std::size_t n_values, char * data_pointer);
+
+/**
+ * @brief Convert n_values consecutive SQL_NUMERIC_STRUCTs with the given
+ *        scale starting at data_pointer to the nearest double precision
+ *        values. Values whose indicator is SQL_NULL_DATA yield 0.
+ */
+void numerics_to_doubles(char const * data_pointer, intptr_t const * indicators,
+                         std::size_t n_values, int scale, double * values);
+
+/**
+ * @brief Format the SQL_NUMERIC_STRUCT stored at data_pointer with the
+ *        given scale as a decimal number such as "-123.45"
+ */
+std::string numeric_to_string(char const * data_pointer, int scale);
+
+}
@@ -36,6 +36,12 @@ public:
 	 */
 	SQLSMALLINT digits() const;
 
+	/**
+	 * @brief Returns the number of significant digits of exact numeric types,
+	 *        or 0 for all other types
+	 */
+	SQLSMALLINT precision() const;
+
 	/**
 	 * @brief Retrieve a code which indicates this field's type
 	 */
@@ -64,6 +70,7 @@ private:
 	virtual SQLSMALLINT do_column_sql_type() const = 0;
 	virtual SQLSMALLINT do_digits() const = 0;
 	virtual type_code do_get_type_code() const = 0;
+	virtual SQLSMALLINT do_precision() const;
 
 	std::string name_;
 	bool supports_null_;
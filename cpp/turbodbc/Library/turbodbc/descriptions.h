@@ -1,9 +1,18 @@
 #pragma once
 
+#include <turbodbc/descriptions/binary_description.h>
 #include <turbodbc/descriptions/boolean_description.h>
 #include <turbodbc/descriptions/date_description.h>
+#include <turbodbc/descriptions/decimal_description.h>
 #include <turbodbc/descriptions/floating_point_description.h>
+#include <turbodbc/descriptions/floating_point_32_description.h>
+#include <turbodbc/descriptions/guid_description.h>
 #include <turbodbc/descriptions/integer_description.h>
+#include <turbodbc/descriptions/nanosecond_timestamp_description.h>
+#include <turbodbc/descriptions/narrow_integer_description.h>
+#include <turbodbc/descriptions/rowversion_description.h>
 #include <turbodbc/descriptions/string_description.h>
+#include <turbodbc/descriptions/time_description.h>
 #include <turbodbc/descriptions/timestamp_description.h>
+#include <turbodbc/descriptions/timestamp_offset_description.h>
 #include <turbodbc/descriptions/unicode_description.h>
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <turbodbc/description.h>
+
+namespace turbodbc {
+
+/**
+ * @brief Represents a description to bind a buffer holding exact decimal
+ *        values as SQL_NUMERIC_STRUCT
+ */
+class decimal_description : public description {
+public:
+	/**
+	 * @brief Largest precision which fits into 128 bit integers
+	 */
+	static SQLSMALLINT const maximum_precision = 38;
+
+	decimal_description(SQLSMALLINT precision, SQLSMALLINT scale);
+	decimal_description(std::string name, bool supports_null, SQLSMALLINT precision, SQLSMALLINT scale);
+	~decimal_description();
+private:
+	std::size_t do_element_size() const final;
+	SQLSMALLINT do_column_c_type() const final;
+	SQLSMALLINT do_column_sql_type() const final;
+	SQLSMALLINT do_digits() const final;
+	type_code do_get_type_code() const final;
+	SQLSMALLINT do_precision() const final;
+
+	SQLSMALLINT precision_;
+	SQLSMALLINT scale_;
+};
+
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <turbodbc/description.h>
+
+namespace turbodbc {
+
+/**
+ * @brief Represents a description to bind a buffer holding unique identifiers
+ */
+class guid_description : public description {
+public:
+	guid_description();
+	guid_description(std::string name, bool supports_null);
+	~guid_description();
+private:
+	std::size_t do_element_size() const final;
+	SQLSMALLINT do_column_c_type() const final;
+	SQLSMALLINT do_column_sql_type() const final;
+	SQLSMALLINT do_digits() const final;
+	type_code do_get_type_code() const final;
+};
+
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <turbodbc/description.h>
+
+namespace turbodbc {
+
+/**
+ * @brief Represents a description to bind a buffer holding 8, 16, or 32 bit
+ *        integer values
+ */
+class narrow_integer_description : public description {
+public:
+	/**
+	 * @param element_size Size of a single value in bytes. Must be 1, 2, or 4
+	 */
+	narrow_integer_description(std::size_t element_size);
+	narrow_integer_description(std::string name, bool supports_null, std::size_t element_size);
+	~narrow_integer_description();
+private:
+	std::size_t do_element_size() const final;
+	SQLSMALLINT do_column_c_type() const final;
+	SQLSMALLINT do_column_sql_type() const final;
+	SQLSMALLINT do_digits() const final;
+	type_code do_get_type_code() const final;
+
+	std::size_t element_size_;
+};
+
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <turbodbc/description.h>
+
+namespace turbodbc {
+
+/**
+ * @brief Represents a description to bind a buffer holding ROWVERSION values,
+ *        which are eight byte big-endian counters transferred as BINARY(8)
+ */
+class rowversion_description : public description {
+public:
+	rowversion_description();
+	rowversion_description(std::string name, bool supports_null);
+	~rowversion_description();
+private:
+	std::size_t do_element_size() const final;
+	SQLSMALLINT do_column_c_type() const final;
+	SQLSMALLINT do_column_sql_type() const final;
+	SQLSMALLINT do_digits() const final;
+	type_code do_get_type_code() const final;
+};
+
+}
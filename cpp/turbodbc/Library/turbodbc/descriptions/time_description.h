@@ -0,0 +1,24 @@
+#pragma once
+
+#include <turbodbc/description.h>
+
+namespace turbodbc {
+
+/**
+ * @brief Represents a description to bind a buffer holding SQL Server
+ *        TIME values with nanosecond resolution
+ */
+class time_description : public description {
+public:
+	time_description();
+	time_description(std::string name, bool supports_null);
+	~time_description();
+private:
+	std::size_t do_element_size() const final;
+	SQLSMALLINT do_column_c_type() const final;
+	SQLSMALLINT do_column_sql_type() const final;
+	SQLSMALLINT do_digits() const final;
+	type_code do_get_type_code() const final;
+};
+
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <turbodbc/description.h>
+
+namespace turbodbc {
+
+/**
+ * @brief Represents a description to bind a buffer holding SQL Server
+ *        DATETIMEOFFSET values
+ */
+class timestamp_offset_description : public description {
+public:
+	/**
+	 * @param nanoseconds If true, values are reported with nanosecond instead of
+	 *        microsecond resolution
+	 */
+	timestamp_offset_description(bool nanoseconds = false);
+	timestamp_offset_description(std::string name, bool supports_null, bool nanoseconds = false);
+	~timestamp_offset_description();
+private:
+	std::size_t do_element_size() const final;
+	SQLSMALLINT do_column_c_type() const final;
+	SQLSMALLINT do_column_sql_type() const final;
+	SQLSMALLINT do_digits() const final;
+	type_code do_get_type_code() const final;
+
+	bool nanoseconds_;
+};
+
+}
@@ -2,7 +2,9 @@
 
 #include <turbodbc/field_translators/boolean_translator.h>
 #include <turbodbc/field_translators/date_translator.h>
+#include <turbodbc/field_translators/float32_translator.h>
 #include <turbodbc/field_translators/float64_translator.h>
 #include <turbodbc/field_translators/int64_translator.h>
+#include <turbodbc/field_translators/narrow_integer_translator.h>
 #include <turbodbc/field_translators/string_translator.h>
 #include <turbodbc/field_translators/timestamp_translator.h>
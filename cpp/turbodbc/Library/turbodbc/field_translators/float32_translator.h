@@ -0,0 +1,19 @@
+#pragma once
+
+#include <turbodbc/field_translator.h>
+
+namespace turbodbc { namespace field_translators {
+
+/**
+ * @brief Translates single precision floating point values into buffer elements
+ *        and vice versa. Fields always hold double precision values.
+ */
+class float32_translator : public field_translator {
+public:
+	float32_translator();
+	~float32_translator();
+private:
+	field do_make_field(char const * data_pointer) const final;
+};
+
+} }
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <turbodbc/field_translator.h>
+
+namespace turbodbc { namespace field_translators {
+
+/**
+ * @brief Translates 8, 16, or 32 bit integer values into buffer elements
+ *        and vice versa. Fields always hold 64 bit integers.
+ */
+class narrow_integer_translator : public field_translator {
+public:
+	narrow_integer_translator(std::size_t element_size);
+	~narrow_integer_translator();
+private:
+	field do_make_field(char const * data_pointer) const final;
+
+	std::size_t element_size_;
+};
+
+} }
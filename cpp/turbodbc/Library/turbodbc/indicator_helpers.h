@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace turbodbc {
+
+/**
+ * @brief Pack n_values ODBC indicators into an Arrow validity bitmap, i.e.,
+ *        bit i is set unless indicators[i] equals SQL_NULL_DATA. The bitmap
+ *        must provide (n_values + 7) / 8 bytes; unused trailing bits are
+ *        cleared.
+ * @return The number of null values
+ */
+std::size_t indicators_to_validity_bitmap(intptr_t const * indicators, std::size_t n_values, uint8_t * bitmap);
+
+/**
+ * @brief Write one byte per value to mask which is 1 for null values and 0 otherwise,
+ *        as used for numpy masked arrays
+ * @return The number of null values
+ */
+std::size_t indicators_to_null_mask(intptr_t const * indicators, std::size_t n_values, uint8_t * mask);
+
+/**
+ * @brief Write one byte per value to mask which is 1 for valid values and 0 for
+ *        null values, as used by Arrow's array builders
+ * @return The number of null values
+ */
+std::size_t indicators_to_valid_mask(intptr_t const * indicators, std::size_t n_values, uint8_t * mask);
+
+/**
+ * @brief Expand n_values bits of an Arrow validity bitmap, starting at bit
+ *        bit_offset, to ODBC indicators. Set bits become valid_indicator,
+ *        cleared bits become SQL_NULL_DATA.
+ * @return The number of null values
+ */
+std::size_t validity_bitmap_to_indicators(uint8_t const * bitmap, std::size_t bit_offset, std::size_t n_values,
+                                          intptr_t valid_indicator, intptr_t * indicators);
+
+/**
+ * @brief Set indicators to SQL_NULL_DATA where the one-byte-per-value mask is
+ *        nonzero and to valid_indicator elsewhere, as for numpy masked arrays
+ * @return The number of null values
+ */
+std::size_t null_mask_to_indicators(uint8_t const * mask, std::size_t n_values,
+                                    intptr_t valid_indicator, intptr_t * indicators);
+
+}
@@ -21,6 +21,22 @@ public:
 	 */
 	parameter(cpp_odbc::statement const & statement, std::size_t one_based_index, std::size_t buffered_rows, std::unique_ptr<description const> description);
 
+	/**
+	 * @brief Create a new parameter without binding its buffer to a statement.
+	 *        Use bind() before the statement is executed.
+	 * @param buffered_rows Number of rows for which the buffer should be allocated
+	 * @param desription Description concerning data type of parameter
+	 */
+	parameter(std::size_t buffered_rows, std::unique_ptr<description const> description);
+
+	/**
+	 * @brief Bind the internal buffer to the statement, replacing any buffer
+	 *        previously bound to the same parameter index
+	 * @param statement The statement for which to bind the buffer
+	 * @param one_based_index One-based parameter index for bind command
+	 */
+	void bind(cpp_odbc::statement const & statement, std::size_t one_based_index);
+
 	/**
 	 * @brief Return the parameter's type code
 	 */
@@ -1,28 +1,87 @@
 #pragma once
 
 #include <cpp_odbc/statement.h>
+#include <cpp_odbc/level2/diagnostic_record.h>
 #include <turbodbc/parameter.h>
+#include <turbodbc/parameter_sets/parameter_set_tuner.h>
 #include <turbodbc/configuration.h>
 
+#include <string>
+#include <chrono>
+#include <memory>
 #include <vector>
 
 
 namespace turbodbc {
 
 
+/**
+ * @brief Describes a parameter set which the database did not accept
+ */
+struct failed_parameter_set {
+    std::size_t index;                               ///< zero-based index among all sets executed with the bound_parameter_set
+    bool processed;                                  ///< false if the database did not get to the set or may have rolled it back
+    cpp_odbc::level2::diagnostic_record diagnostic;  ///< empty if the database did not report diagnostics for the set
+};
+
+
 /**
  * @brief This class manages a set of parameters that is bound to a
  *        statement. The class tracks the number of transferred records
  *        and manages parameter buffers.
+ *
+ *        If options::adaptive_parameter_sets is set, the number of buffered
+ *        sets changes after executed batches as chosen by a parameter_set_tuner.
+ *        Buffers only grow, up to options::parameter_buffer_megabytes, and keep
+ *        their values when they do. Fill at most buffered_sets() sets before
+ *        each call to execute_batch().
+ *
+ *        The database reports the outcome of each set of a batch in a status
+ *        array (SQL_ATTR_PARAM_STATUS_PTR). Sets which fail are listed by
+ *        failed_sets(). If a batch fails as a whole, none of its sets count as
+ *        transferred and all sets not marked as rejected are reported with
+ *        processed set to false, since the database may have rolled them back.
+ *
+ *        If options::parameter_set_retries is nonzero and options::autocommit is
+ *        set, a batch which fails as a whole with an error that rolls back the
+ *        transaction (SQLSTATE class 40, or SQL Server's deadlock error 1205) is
+ *        executed again as a whole. Other errors, e.g., constraint violations, are not
+ *        retried. Without autocommit, earlier batches of the transaction are
+ *        lost as well, so such batches are never retried.
  */
 class bound_parameter_set {
 public:
     bound_parameter_set(cpp_odbc::statement const & statement,
                         turbodbc::configuration const & configuration);
+
+    /**
+     * @brief Create a parameter set. If bind_on_execute is set, rebind()
+     *        does not touch the statement. Instead, all buffers are bound
+     *        right before each batch is executed. This allows filling one
+     *        parameter set while another set of the same statement executes.
+     */
+    bound_parameter_set(cpp_odbc::statement const & statement,
+                        turbodbc::configuration const & configuration,
+                        bool bind_on_execute);
+
+    /**
+     * @brief Create a parameter set whose parameters are the columns of a single
+     *        table-valued parameter (SQL Server's SQL_SS_TABLE) with the given
+     *        table type. The table must be the only parameter of the statement.
+     *        Each batch executes the statement once and sends all sets of the
+     *        batch as rows of the table. Buffers are bound right before execution.
+     * @param table_type_name Name of the table type, e.g. u"dbo.row_type"
+     * @param number_of_columns Number of columns of the table type
+     */
+    bound_parameter_set(cpp_odbc::statement const & statement,
+                        turbodbc::configuration const & configuration,
+                        std::u16string table_type_name,
+                        std::size_t number_of_columns);
     
     /**
      * @brief Retrieve the number of buffered sets, i.e, the size
-     *        of the parameter buffers in rows
+     *        of the parameter buffers in rows. In adaptive mode, this is the
+     *        number of sets the tuner has chosen for the next batch.
      */
     std::size_t buffered_sets() const;
 
@@ -33,7 +92,8 @@ public:
     std::size_t transferred_sets() const;
 
     /**
-     * @brief Retrieve the number of parameters in this set
+     * @brief Retrieve the number of parameters in this set. For table-valued
+     *        parameters, this is the number of columns of the table.
      */
     std::size_t number_of_parameters() const;
 
@@ -46,10 +106,21 @@ public:
      * @brief Execute the current prepared statement with a batch
      *        of parameters. The statement will not be executed
      *        if no parameter sets are available.
+     *        If the transaction was rolled back, the batch is resubmitted up to
+     *        options::parameter_set_retries times. Sets which still fail are
+     *        added to failed_sets() and the error raised by the last attempt,
+     *        if any, is rethrown.
      * @param sets_in_batch The number of parameter sets in the batch.
      */
     void execute_batch(std::size_t sets_in_batch);
 
+    /**
+     * @brief Retrieve all sets which the database did not accept, in the order
+     *        in which they were executed. Table-valued parameters succeed or fail
+     *        as a whole and are not reported here.
+     */
+    std::vector<failed_parameter_set> const & failed_sets() const;
+
     /**
      * @brief Replace the current parameter bound for a given index with a
      *        new one based on the provided type information. The current
@@ -59,19 +130,62 @@ public:
      */
     void rebind(std::size_t zero_based_parameter_index, std::unique_ptr<description const> parameter_description);
 
+    /**
+     * @brief Make sure the parameter for a given index can hold values of the
+     *        given type and size. The parameter is only rebound if its type
+     *        differs or its buffer is too small. New buffers leave room for
+     *        larger values, so buffers grow rarely for varying string lengths.
+     * @param zero_based_parameter_index Index of the column. First column has index 0.
+     * @param type Type of the values
+     * @param value_size Size of the largest value in characters or bytes
+     * @return True if the parameter was rebound
+     */
+    bool ensure_capacity(std::size_t zero_based_parameter_index, type_code type, std::size_t value_size);
+
     /**
      * @brief Retrieve type codes of the initially bound parameter types.
      *        Useful for reverting to the original suggestion after rebinding.
      * @return
      */
     std::vector<type_code> const & get_initial_parameter_types() const;
+
+    /**
+     * @brief Note that another parameter set of the same statement has replaced
+     *        the statement's parameter bindings and attributes, e.g. one created
+     *        by command::make_parameters_bound_on_execute(). Before the next
+     *        batch is executed, the statement's parameters are reset and this
+     *        set binds its buffers and attributes again.
+     */
+    void invalidate_bindings();
+
+    /**
+     * @brief Bind all buffers and attributes again if they were invalidated.
+     *        execute_batch() does this automatically. Call this before the
+     *        statement is executed without parameters.
+     */
+    void ensure_bound();
 private:
+    void bind();
+    void execute_isolating_failures(std::size_t first_set, std::size_t sets_in_batch);
+    void adapt_buffered_sets(std::size_t sets_in_batch, std::chrono::nanoseconds latency);
+
     cpp_odbc::statement const & statement_;
+    bool bind_on_execute_;
+    bool bindings_valid_;
     std::size_t buffered_sets_;
     std::size_t transferred_sets_;
     SQLULEN confirmed_last_batch_;
     std::vector<std::shared_ptr<parameter>> parameters_;
     std::vector<type_code> initial_parameter_types_;
+    bool table_valued_;
+    std::u16string table_type_name_;
+    SQLLEN table_rows_;
+    std::unique_ptr<parameter_set_tuner> tuner_;
+    std::size_t buffer_memory_limit_;
+    std::size_t retries_;
+    std::size_t executed_sets_;
+    std::vector<SQLUSMALLINT> status_;
+    std::vector<failed_parameter_set> failed_sets_;
 };
 
 
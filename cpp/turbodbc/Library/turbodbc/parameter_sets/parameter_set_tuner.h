@@ -0,0 +1,60 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+namespace turbodbc {
+
+/**
+ * @brief Chooses the number of parameter sets per batch from measured batch
+ *        latencies. Starting from an initial size, the number of sets is
+ *        doubled as long as this improves the throughput in rows per second
+ *        and the latency stays below the target. Once the throughput stops
+ *        improving, the tuner settles on the best size measured so far.
+ *        Batches which exceed the latency target halve the size. If many
+ *        batches in a row could have doubled without exceeding the target,
+ *        e.g. after a single slow batch, the tuner starts growing again.
+ */
+class parameter_set_tuner {
+public:
+    /**
+     * @param initial_sets Number of sets of the first batches
+     * @param latency_target Batches should not take longer than this
+     */
+    parameter_set_tuner(std::size_t initial_sets, std::chrono::milliseconds latency_target);
+
+    /**
+     * @brief Retrieve the number of sets recommended for the next batch
+     */
+    std::size_t recommended_sets() const;
+
+    /**
+     * @brief Account for an executed batch and update the recommendation
+     * @param sets Number of sets in the batch. Batches with fewer sets than
+     *        recommended are ignored since they do not measure the current size.
+     * @param latency Time it took to execute the batch
+     * @param maximum_sets The recommendation never exceeds this value, e.g.,
+     *        because larger buffers would exceed the memory budget
+     */
+    void record(std::size_t sets, std::chrono::nanoseconds latency, std::size_t maximum_sets);
+
+    /**
+     * @brief Retrieve the best throughput measured so far in sets per second
+     */
+    double best_throughput() const;
+
+    /**
+     * @brief True if the tuner has stopped growing batches
+     */
+    bool is_settled() const;
+
+private:
+    std::size_t current_sets_;
+    std::size_t best_sets_;
+    double best_throughput_;
+    bool settled_;
+    std::size_t batches_with_headroom_;
+    std::chrono::nanoseconds latency_target_;
+};
+
+}
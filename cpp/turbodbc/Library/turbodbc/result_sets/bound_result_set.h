@@ -38,6 +38,7 @@ private:
     std::size_t do_fetch_next_batch() final;
     std::vector<column_info> do_get_column_info() const final;
     std::vector<std::reference_wrapper<cpp_odbc::multi_value_buffer const>> do_get_buffers() const final;
+    bool do_bind_external_data(std::size_t zero_based_column, char * data) final;
 
     std::shared_ptr<cpp_odbc::statement const> statement_;
     std::vector<column> columns_;
@@ -7,7 +7,8 @@
 
 #include <cpp_odbc/statement.h>
 #include <memory>
-#include <array>
+#include <atomic>
+#include <chrono>
 #include <thread>
 #include <mutex>
 #include <condition_variable>
@@ -52,9 +53,29 @@ namespace detail {
 }
 
 /**
- * @brief This class implements result_set by double buffering real ODBC
- *        result sets. This means that while one buffer is filled by the database,
- *        users retrieve values from a previously filled buffer.
+ * @brief Tells whether the database or the consumer of a
+ *        double_buffered_result_set limits the throughput. If requests usually
+ *        find the ring empty, the database is the bottleneck. If they usually
+ *        find it full, the consumer is.
+ */
+struct prefetch_statistics {
+    std::size_t slots;                          ///< number of slots in the ring
+    std::size_t requested_batches;              ///< number of calls to fetch_next_batch()
+    std::size_t requests_finding_ring_empty;    ///< requests which had to wait for the database
+    std::size_t requests_finding_ring_full;     ///< requests which found all other slots fetched ahead
+    std::size_t fetched_ahead;                  ///< sum of the batches fetched ahead at each request
+    std::chrono::nanoseconds consumer_wait;     ///< time fetch_next_batch() waited for the database
+    std::chrono::nanoseconds producer_wait;     ///< time fetching paused because all slots were fetched ahead
+};
+
+
+/**
+ * @brief This class implements result_set by buffering real ODBC result sets
+ *        in a ring of options::prefetch_slots slots. While users retrieve values
+ *        from one slot, a background thread fetches the following batches into
+ *        all other slots and keeps running ahead until the ring is full. The read
+ *        buffer size is split evenly across the slots. With two slots, this is
+ *        classic double buffering.
  */
 class double_buffered_result_set : public turbodbc::result_sets::result_set {
 public:
@@ -66,16 +87,26 @@ public:
                                turbodbc::options const & options);
     virtual ~double_buffered_result_set();
 
+    /**
+     * @brief Retrieve counters on how well prefetching keeps up with the consumer
+     */
+    prefetch_statistics get_prefetch_statistics() const;
+
 private:
     std::size_t do_fetch_next_batch() final;
     std::vector<column_info> do_get_column_info() const final;
     std::vector<std::reference_wrapper<cpp_odbc::multi_value_buffer const>> do_get_buffers() const final;
+    void do_close() final;
+    void stop_reader();
 
     std::shared_ptr<cpp_odbc::statement const> statement_;
-    std::array<bound_result_set, 2> batches_;
+    std::vector<bound_result_set> batches_;
     std::size_t active_reading_batch_;
     detail::message_queue<std::size_t> read_requests_;
     detail::message_queue<std::shared_future<std::size_t>> read_responses_;
+    std::atomic<std::size_t> fetched_ahead_;
+    std::atomic<std::int64_t> producer_wait_;
+    prefetch_statistics statistics_;
     std::thread reader_;
 };
 
@@ -6,6 +6,7 @@
 
 #include <vector>
 #include <functional>
+#include <mutex>
 
 namespace turbodbc { namespace result_sets {
 
@@ -22,6 +23,7 @@ public:
 	 *        Invalidates buffers previously retrieved with get_buffers()
 	 *
 	 * @return The number of rows which came with this batch
+	 * @throw interface_error if the result set was closed
 	 */
 	std::size_t fetch_next_batch();
 
@@ -36,6 +38,26 @@ public:
 	 */
 	std::vector<std::reference_wrapper<cpp_odbc::multi_value_buffer const>> get_buffers() const;
 
+	/**
+	 * @brief Ask the result set to write the values of the given column directly
+	 *        to external memory with subsequent calls to fetch_next_batch().
+	 *        Indicators are still available via get_buffers().
+	 * @param zero_based_column Index of the column. First column has index 0.
+	 * @param data Memory which can hold as many elements as the column's buffer,
+	 *        or nullptr to return to the result set's own buffer
+	 * @return false if the result set does not support external memory. In
+	 *         this case, values remain in the buffers retrieved by get_buffers().
+	 */
+	bool bind_external_data(std::size_t zero_based_column, char * data);
+
+	/**
+	 * @brief Stop using the statement so that it can be freed. Waits for a
+	 *        fetch in progress on another thread, e.g. a pipelined Arrow reader.
+	 *        Afterwards, fetch_next_batch() and bind_external_data() throw.
+	 *        Buffers retrieved before remain valid.
+	 */
+	void close();
+
 protected:
 	result_set();
 
@@ -46,6 +68,11 @@ private:
 	virtual std::size_t do_fetch_next_batch() = 0;
 	virtual std::vector<column_info> do_get_column_info() const = 0;
 	virtual std::vector<std::reference_wrapper<cpp_odbc::multi_value_buffer const>> do_get_buffers() const = 0;
+	virtual bool do_bind_external_data(std::size_t zero_based_column, char * data);
+	virtual void do_close();
+
+	std::mutex statement_mutex_;
+	bool closed_;
 };
 
 } }
@@ -0,0 +1,91 @@
+#pragma once
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+#include <sqltypes.h>
+
+#include <cpp_odbc/sql_server_types.h>
+
+#include <cstdint>
+
+namespace turbodbc {
+
+/**
+ * @brief SQL Server's type identifier for TIME columns, SQL_SS_TIME2 in msodbcsql.h
+ */
+SQLSMALLINT const sql_ss_time2 = -154;
+
+/**
+ * @brief SQL Server's type identifier for DATETIMEOFFSET columns,
+ *        SQL_SS_TIMESTAMPOFFSET in msodbcsql.h
+ */
+SQLSMALLINT const sql_ss_timestampoffset = -155;
+
+using cpp_odbc::sql_ss_table;
+
+/**
+ * @brief Statement attribute which selects the table-valued parameter whose columns
+ *        are bound next, SQL_SOPT_SS_PARAM_FOCUS in msodbcsql.h. Zero selects the
+ *        parameters of the statement itself.
+ */
+SQLINTEGER const sql_sopt_ss_param_focus = 1236;
+
+/**
+ * @brief Connection attribute which enables the bulk copy API, SQL_COPT_SS_BCP in
+ *        msodbcsql.h. It must be set to sql_bcp_on before the connection is established.
+ */
+SQLINTEGER const sql_copt_ss_bcp = 1219;
+intptr_t const sql_bcp_on = 1;
+
+/**
+ * @brief Option of bcp_control() which marks the running bulk copy as failed, BCPABORT
+ *        in msodbcsql.h. The following bcp_done() then discards all rows which have
+ *        not been committed by bcp_batch().
+ */
+int const bcp_abort = 6;
+
+/**
+ * @brief SQL Server's type tokens which describe program variables in bcp_bind()
+ */
+namespace bcp_types {
+    int const tinyint = 0x30;           ///< SQLINT1, unsigned 8 bit integer
+    int const smallint = 0x34;          ///< SQLINT2
+    int const integer = 0x38;           ///< SQLINT4
+    int const bigint = 0x7f;            ///< SQLINT8
+    int const real = 0x3b;              ///< SQLFLT4
+    int const float_ = 0x3e;            ///< SQLFLT8
+    int const bit = 0x32;               ///< SQLBIT, one byte with value 0 or 1
+    int const nvarchar = 0xe7;          ///< SQLNVARCHAR, UTF-16 characters
+    int const varbinary = 0xa5;         ///< SQLBIGVARBINARY
+    int const date = 0x28;              ///< SQLDATEN, SQL_DATE_STRUCT
+    int const datetime2 = 0x2a;         ///< SQLDATETIME2N, SQL_TIMESTAMP_STRUCT
+    int const numeric = 0x6c;           ///< SQLNUMERICN, SQL_NUMERIC_STRUCT
+}
+
+/**
+ * @brief Layout of SQL_SS_TIME2_STRUCT, which is transferred as SQL_C_BINARY
+ */
+struct ss_time2_struct {
+    SQLUSMALLINT hour;
+    SQLUSMALLINT minute;
+    SQLUSMALLINT second;
+    SQLUINTEGER fraction;   ///< nanoseconds
+};
+
+/**
+ * @brief Layout of SQL_SS_TIMESTAMPOFFSET_STRUCT, which is transferred as SQL_C_BINARY
+ */
+struct ss_timestampoffset_struct {
+    SQLSMALLINT year;
+    SQLUSMALLINT month;
+    SQLUSMALLINT day;
+    SQLUSMALLINT hour;
+    SQLUSMALLINT minute;
+    SQLUSMALLINT second;
+    SQLUINTEGER fraction;   ///< nanoseconds
+    SQLSMALLINT timezone_hour;
+    SQLSMALLINT timezone_minute;
+};
+
+}
@@ -5,4 +5,26 @@ namespace turbodbc {
 
 std::size_t buffered_string_size(intptr_t length_indicator, std::size_t maximum_string_size);
 
+/**
+ * @brief Transcode length UTF-16 code units to UTF-8. output must provide
+ *        space for 3 * length bytes. Unpaired surrogates are replaced
+ *        with U+FFFD.
+ * @return The number of bytes written to output
+ */
+std::size_t utf16_to_utf8(char16_t const * input, std::size_t length, char * output);
+
+/**
+ * @brief Count the UTF-16 code units utf8_to_utf16 produces for length
+ *        bytes of UTF-8 input.
+ */
+std::size_t utf8_to_utf16_length(char const * input, std::size_t length);
+
+/**
+ * @brief Transcode length bytes of UTF-8 to UTF-16. output must provide
+ *        space for utf8_to_utf16_length(input, length) code units. Each
+ *        byte that does not start a valid sequence is replaced with U+FFFD.
+ * @return The number of code units written to output
+ */
+std::size_t utf8_to_utf16(char const * input, std::size_t length, char16_t * output);
+
 }
\ No newline at end of file
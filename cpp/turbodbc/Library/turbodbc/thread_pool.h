@@ -0,0 +1,67 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace turbodbc {
+
+/**
+ * @brief A fixed set of worker threads which execute independent tasks.
+ *        The pool is meant to be shared by all result sets and parameter sets
+ *        of a process, see shared().
+ */
+class thread_pool {
+public:
+    /**
+     * @brief Start n_threads worker threads
+     */
+    explicit thread_pool(std::size_t n_threads);
+
+    thread_pool(thread_pool const &) = delete;
+    thread_pool & operator=(thread_pool const &) = delete;
+
+    /**
+     * @brief Stop and join all worker threads. Tasks which are still queued
+     *        are executed before the threads exit.
+     */
+    ~thread_pool();
+
+    /**
+     * @brief Retrieve the number of worker threads
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Call task(i) for all i in [0, n_tasks) and block until all calls
+     *        have returned. Tasks are started in ascending order of i and are
+     *        distributed over at most max_workers threads, one of which is the
+     *        calling thread. If a task throws, no further tasks are started and
+     *        the first exception is rethrown in the calling thread. The call
+     *        returns as soon as all tasks have finished, even if some helper
+     *        jobs are still queued behind other work, so it may be nested.
+     */
+    void parallel_for(std::size_t n_tasks, std::size_t max_workers,
+                      std::function<void(std::size_t)> const & task);
+
+    /**
+     * @brief Retrieve the process-wide pool with one thread per hardware thread
+     */
+    static thread_pool & shared();
+
+private:
+    void submit(std::function<void()> job);
+    void work();
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::queue<std::function<void()>> jobs_;
+    bool stopping_;
+    std::vector<std::thread> workers_;
+};
+
+}
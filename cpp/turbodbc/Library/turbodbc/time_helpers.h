@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 namespace turbodbc {
@@ -39,4 +40,132 @@ int64_t date_to_days(char const * data_pointer);
  */
 void days_to_date(int64_t days, char * data_pointer);
 
+
+/**
+ * @brief Convert n_values consecutive SQL_TIMESTAMP_STRUCTs starting at
+ *        data_pointer to microseconds since the POSIX epoch. Values whose
+ *        indicator is SQL_NULL_DATA yield 0.
+ */
+void timestamps_to_microseconds(char const * data_pointer, intptr_t const * indicators,
+                                std::size_t n_values, int64_t * microseconds);
+
+/**
+ * @brief Same as above, but keeps the full nanosecond resolution of the fraction.
+ *        Throws an interface_error if a value lies outside the range
+ *        1677-09-21 to 2262-04-11 which nanoseconds in 64 bits can represent.
+ */
+void timestamps_to_nanoseconds(char const * data_pointer, intptr_t const * indicators,
+                               std::size_t n_values, int64_t * nanoseconds);
+
+/**
+ * @brief Convert n_values consecutive SQL Server DATETIMEOFFSET values starting
+ *        at data_pointer to microseconds since the POSIX epoch in UTC. Values
+ *        whose indicator is SQL_NULL_DATA yield 0.
+ */
+void timestamp_offsets_to_microseconds(char const * data_pointer, intptr_t const * indicators,
+                                       std::size_t n_values, int64_t * microseconds);
+
+/**
+ * @brief Same as above, but keeps the full nanosecond resolution of the fraction.
+ *        Throws an interface_error if a value lies outside the range
+ *        1677-09-21 to 2262-04-11 which nanoseconds in 64 bits can represent.
+ */
+void timestamp_offsets_to_nanoseconds(char const * data_pointer, intptr_t const * indicators,
+                                      std::size_t n_values, int64_t * nanoseconds);
+
+/**
+ * @brief Convert the SQL Server DATETIMEOFFSET value at data_pointer to an
+ *        SQL_TIMESTAMP_STRUCT in UTC located at timestamp_pointer. The fraction
+ *        keeps its nanosecond resolution.
+ */
+void timestamp_offset_to_utc_timestamp(char const * data_pointer, char * timestamp_pointer);
+
+/**
+ * @brief Convert n_values consecutive SQL Server TIME values starting at
+ *        data_pointer to nanoseconds since midnight. Values whose
+ *        indicator is SQL_NULL_DATA yield 0.
+ */
+void times_to_nanoseconds(char const * data_pointer, intptr_t const * indicators,
+                          std::size_t n_values, int64_t * nanoseconds);
+
+/**
+ * @brief Convert n_values consecutive SQL_DATE_STRUCTs starting at
+ *        data_pointer to days since the POSIX epoch. Values whose
+ *        indicator is SQL_NULL_DATA yield 0.
+ */
+void dates_to_days(char const * data_pointer, intptr_t const * indicators,
+                   std::size_t n_values, int64_t * days);
+
+/**
+ * @brief Same as above, but for 32 bit day counts as used by Arrow's date32
+ */
+void dates_to_days(char const * data_pointer, intptr_t const * indicators,
+                   std::size_t n_values, int32_t * days);
+
+/**
+ * @brief Convert n_values seconds since the POSIX epoch to consecutive
+ *        SQL_TIMESTAMP_STRUCTs starting at data_pointer. Indicators are
+ *        left to the caller.
+ */
+void seconds_to_timestamps(int64_t const * seconds, std::size_t n_values, char * data_pointer);
+
+/**
+ * @brief Same as above, but for milliseconds since the POSIX epoch
+ */
+void milliseconds_to_timestamps(int64_t const * milliseconds, std::size_t n_values, char * data_pointer);
+
+/**
+ * @brief Convert n_values microseconds since the POSIX epoch to consecutive
+ *        SQL_TIMESTAMP_STRUCTs starting at data_pointer. Indicators are
+ *        left to the caller.
+ */
+void microseconds_to_timestamps(int64_t const * microseconds, std::size_t n_values, char * data_pointer);
+
+/**
+ * @brief Convert n_values nanoseconds since the POSIX epoch to consecutive
+ *        SQL_TIMESTAMP_STRUCTs starting at data_pointer. Indicators are
+ *        left to the caller.
+ */
+void nanoseconds_to_timestamps(int64_t const * nanoseconds, std::size_t n_values, char * data_pointer);
+
+/**
+ * @brief Convert n_values days since the POSIX epoch to consecutive
+ *        SQL_DATE_STRUCTs starting at data_pointer. Indicators are left
+ *        to the caller.
+ */
+void days_to_dates(int64_t const * days, std::size_t n_values, char * data_pointer);
+
+/**
+ * @brief Same as above, but for 32 bit day counts as used by Arrow's date32
+ */
+void days_to_dates(int32_t const * days, std::size_t n_values, char * data_pointer);
+
+/**
+ * @brief Convert n_values milliseconds since the POSIX epoch, as used by
+ *        Arrow's date64, to consecutive SQL_DATE_STRUCTs starting at
+ *        data_pointer. Times of day are truncated towards the past.
+ */
+void milliseconds_to_dates(int64_t const * milliseconds, std::size_t n_values, char * data_pointer);
+
+/**
+ * @brief Convert n_values seconds since midnight to consecutive SQL Server
+ *        TIME values starting at data_pointer. Indicators are left to the caller.
+ */
+void seconds_to_times(int32_t const * seconds, std::size_t n_values, char * data_pointer);
+
+/**
+ * @brief Same as above, but for milliseconds since midnight
+ */
+void milliseconds_to_times(int32_t const * milliseconds, std::size_t n_values, char * data_pointer);
+
+/**
+ * @brief Same as above, but for microseconds since midnight
+ */
+void microseconds_to_times(int64_t const * microseconds, std::size_t n_values, char * data_pointer);
+
+/**
+ * @brief Same as above, but for nanoseconds since midnight
+ */
+void nanoseconds_to_times(int64_t const * nanoseconds, std::size_t n_values, char * data_pointer);
+
 }
@@ -6,13 +6,25 @@ namespace turbodbc {
  * This enumeration assigns integer values to certain database types
  */
 enum class type_code : int {
-	boolean = 0,            ///< boolean type
-	integer = 10,           ///< integer types
-	floating_point = 20,    ///< floating point types
-	string = 30,            ///< string types
-	unicode = 31,           ///< unicode types
-	timestamp = 40,         ///< timestamp types
-	date = 41               ///< date type
+	boolean = 0,                ///< boolean type
+	integer = 10,               ///< integer types
+	integer_8 = 11,             ///< 8 bit integer types
+	integer_16 = 12,            ///< 16 bit integer types
+	integer_32 = 13,            ///< 32 bit integer types
+	rowversion = 15,            ///< ROWVERSION values as unsigned 64 bit integers
+	floating_point = 20,        ///< floating point types
+	floating_point_32 = 21,     ///< single precision floating point types
+	decimal = 25,               ///< exact decimal types
+	string = 30,                ///< string types
+	unicode = 31,               ///< unicode types
+	binary = 32,                ///< binary types
+	guid = 33,                  ///< unique identifier types
+	timestamp = 40,             ///< timestamp types
+	date = 41,                  ///< date type
+	time = 42,                  ///< time of day types
+	timestamp_nanoseconds = 43, ///< timestamp types with nanosecond resolution
+	timestamp_offset = 44,      ///< timestamps with time zone offset
+	timestamp_offset_nanoseconds = 45   ///< timestamps with time zone offset and nanosecond resolution
 };
 
 }
@@ -0,0 +1,67 @@
+#include "turbodbc/binary_helpers.h"
+
+#include <gtest/gtest.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+#include <sql.h>
+
+#include <vector>
+
+using turbodbc::rowversion_to_integer;
+using turbodbc::rowversions_to_integers;
+using turbodbc::guid_to_bytes;
+using turbodbc::guids_to_bytes;
+
+TEST(BinaryHelpersTest, RowversionToIntegerIsBigEndian)
+{
+    unsigned char const data[8] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03};
+    EXPECT_EQ(0x010203u, rowversion_to_integer(reinterpret_cast<char const *>(data)));
+}
+
+TEST(BinaryHelpersTest, RowversionToIntegerUsesAllBytes)
+{
+    unsigned char const data[8] = {0xff, 0xee, 0xdd, 0xcc, 0xbb, 0xaa, 0x99, 0x88};
+    EXPECT_EQ(0xffeeddccbbaa9988u, rowversion_to_integer(reinterpret_cast<char const *>(data)));
+}
+
+TEST(BinaryHelpersTest, RowversionsToIntegers)
+{
+    unsigned char const data[24] = {0, 0, 0, 0, 0, 0, 0, 1,
+                                    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
+                                    0, 0, 0, 0, 0, 0, 1, 0};
+    std::vector<intptr_t> const indicators = {8, SQL_NULL_DATA, 8};
+    std::vector<uint64_t> values(3, 42);
+
+    rowversions_to_integers(reinterpret_cast<char const *>(data), indicators.data(), 3, values.data());
+
+    EXPECT_EQ(1u, values[0]);
+    EXPECT_EQ(0u, values[1]);
+    EXPECT_EQ(256u, values[2]);
+}
+
+TEST(BinaryHelpersTest, GuidToBytesUsesRfc4122Order)
+{
+    // 6f9619ff-8b86-d011-b42d-00c04fc964ff
+    SQLGUID const guid = {0x6f9619ff, 0x8b86, 0xd011, {0xb4, 0x2d, 0x00, 0xc0, 0x4f, 0xc9, 0x64, 0xff}};
+    std::vector<uint8_t> bytes(16);
+    guid_to_bytes(reinterpret_cast<char const *>(&guid), bytes.data());
+
+    std::vector<uint8_t> const expected = {0x6f, 0x96, 0x19, 0xff, 0x8b, 0x86, 0xd0, 0x11,
+                                           0xb4, 0x2d, 0x00, 0xc0, 0x4f, 0xc9, 0x64, 0xff};
+    EXPECT_EQ(expected, bytes);
+}
+
+TEST(BinaryHelpersTest, GuidsToBytes)
+{
+    std::vector<SQLGUID> const guids = {{1, 2, 3, {4, 5, 6, 7, 8, 9, 10, 11}},
+                                        {1, 2, 3, {4, 5, 6, 7, 8, 9, 10, 11}}};
+    std::vector<intptr_t> const indicators = {sizeof(SQLGUID), SQL_NULL_DATA};
+    std::vector<uint8_t> bytes(32, 0xab);
+    guids_to_bytes(reinterpret_cast<char const *>(guids.data()), indicators.data(), 2, bytes.data());
+
+    std::vector<uint8_t> const expected = {0, 0, 0, 1, 0, 2, 0, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    EXPECT_EQ(expected, std::vector<uint8_t>(bytes.begin(), bytes.begin() + 16));
+    EXPECT_EQ(std::vector<uint8_t>(16, 0), std::vector<uint8_t>(bytes.begin() + 16, bytes.end()));
+}
@@ -0,0 +1,83 @@
+#include <turbodbc/bounded_queue.h>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+
+using turbodbc::bounded_queue;
+
+
+TEST(BoundedQueueTest, Capacity)
+{
+    EXPECT_EQ(3, bounded_queue<int>(3).capacity());
+    EXPECT_EQ(1, bounded_queue<int>(0).capacity());
+}
+
+
+TEST(BoundedQueueTest, FirstInFirstOut)
+{
+    bounded_queue<int> queue(3);
+    EXPECT_TRUE(queue.push(1));
+    EXPECT_TRUE(queue.push(2));
+
+    int value = 0;
+    ASSERT_TRUE(queue.pull(value));
+    EXPECT_EQ(1, value);
+    ASSERT_TRUE(queue.pull(value));
+    EXPECT_EQ(2, value);
+}
+
+
+TEST(BoundedQueueTest, CloseRejectsPushButDrainsValues)
+{
+    bounded_queue<int> queue(2);
+    queue.push(42);
+    queue.close();
+
+    EXPECT_FALSE(queue.push(23));
+    int value = 0;
+    ASSERT_TRUE(queue.pull(value));
+    EXPECT_EQ(42, value);
+    EXPECT_FALSE(queue.pull(value));
+}
+
+
+TEST(BoundedQueueTest, CloseReleasesBlockedProducer)
+{
+    bounded_queue<int> queue(1);
+    queue.push(1);
+
+    bool pushed = true;
+    std::thread producer([&](){ pushed = queue.push(2); });
+    queue.close();
+    producer.join();
+
+    EXPECT_FALSE(pushed);
+}
+
+
+TEST(BoundedQueueTest, ProducerAndConsumer)
+{
+    int const n_values = 1000;
+    bounded_queue<int> queue(4);
+
+    std::thread producer([&](){
+        for (int i = 0; i != n_values; ++i) {
+            queue.push(i);
+        }
+    });
+
+    std::vector<int> received;
+    int value = 0;
+    while (received.size() != n_values and queue.pull(value)) {
+        received.push_back(value);
+    }
+    producer.join();
+
+    ASSERT_EQ(n_values, received.size());
+    for (int i = 0; i != n_values; ++i) {
+        EXPECT_EQ(i, received[i]);
+    }
+}
@@ -84,6 +84,24 @@ TEST(BufferSizeTest, HalveBufferSizeWithRows)
     EXPECT_EQ(21, boost::get<turbodbc::rows>(boost::apply_visitor(turbodbc::halve_buffer_size(), even)).value);
 }
 
+TEST(BufferSizeTest, SplitBufferSizeWithRows)
+{
+    turbodbc::buffer_size size(turbodbc::rows(31));
+
+    EXPECT_EQ(8, boost::get<turbodbc::rows>(boost::apply_visitor(turbodbc::split_buffer_size(4), size)).value);
+    EXPECT_EQ(31, boost::get<turbodbc::rows>(boost::apply_visitor(turbodbc::split_buffer_size(1), size)).value);
+    EXPECT_EQ(1, boost::get<turbodbc::rows>(boost::apply_visitor(turbodbc::split_buffer_size(100), size)).value);
+}
+
+TEST(BufferSizeTest, SplitBufferSizeWithMegabytes)
+{
+    turbodbc::buffer_size size(turbodbc::megabytes(20));
+
+    EXPECT_EQ(7, boost::get<turbodbc::megabytes>(boost::apply_visitor(turbodbc::split_buffer_size(3), size)).value);
+    EXPECT_EQ(5, boost::get<turbodbc::megabytes>(boost::apply_visitor(turbodbc::split_buffer_size(4), size)).value);
+    EXPECT_EQ(1, boost::get<turbodbc::megabytes>(boost::apply_visitor(turbodbc::split_buffer_size(64), size)).value);
+}
+
 TEST(BufferSizeTest, HalveBufferSizeWithMegabytes)
 {
     turbodbc::buffer_size odd(turbodbc::megabytes(31));
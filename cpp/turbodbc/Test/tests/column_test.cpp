@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 #include "mock_classes.h"
 
+#include <turbodbc/descriptions/decimal_description.h>
 #include <turbodbc/descriptions/string_description.h>
 #include <boost/variant/get.hpp>
 
@@ -35,6 +36,33 @@ TEST(ColumnTest, GetInfo)
 }
 
 
+TEST(ColumnTest, GetInfoForDecimal)
+{
+	std::unique_ptr<turbodbc::decimal_description> description(new turbodbc::decimal_description("custom_name", true, 20, 4));
+
+	turbodbc_test::mock_statement statement;
+	turbodbc::column column(statement, 0, 10, std::move(description));
+
+	auto const info = column.get_info();
+	EXPECT_EQ(turbodbc::type_code::decimal, info.type);
+	EXPECT_EQ(20, info.precision);
+	EXPECT_EQ(4, info.scale);
+}
+
+
+TEST(ColumnTest, BindDecimalUsesNumericBinding)
+{
+	std::unique_ptr<turbodbc::decimal_description> description(new turbodbc::decimal_description(20, 4));
+
+	turbodbc_test::mock_statement statement;
+	turbodbc::column column(statement, column_index, 100, std::move(description));
+
+	EXPECT_CALL(statement, do_bind_numeric_column(column_index, 20, 4, testing::_)).Times(1);
+	EXPECT_CALL(statement, do_bind_column(testing::_, testing::_, testing::_)).Times(0);
+
+	column.bind();
+}
+
 TEST(ColumnTest, GetBuffer)
 {
 	std::unique_ptr<turbodbc::string_description> description(new turbodbc::string_description(128));
@@ -73,3 +101,22 @@ TEST(ColumnTest, MoveConstructor)
 		.WillOnce(store_pointer_to_buffer_in(&buffer));
 	ASSERT_NO_THROW(column.bind());
 }
+
+
+TEST(ColumnTest, BindExternalData)
+{
+	std::unique_ptr<turbodbc::string_description> description(new turbodbc::string_description(128));
+
+	turbodbc_test::mock_statement statement;
+	turbodbc::column column(statement, column_index, 100, std::move(description));
+	auto const internal_data_pointer = column.get_buffer().data_pointer();
+	std::vector<char> external(column.get_buffer().capacity_per_element() * 100);
+
+	EXPECT_CALL(statement, do_bind_column(column_index, testing::_, testing::_)).Times(2);
+
+	column.bind_external_data(external.data());
+	EXPECT_EQ(external.data(), column.get_buffer().data_pointer());
+
+	column.bind_external_data(nullptr);
+	EXPECT_EQ(internal_data_pointer, column.get_buffer().data_pointer());
+}
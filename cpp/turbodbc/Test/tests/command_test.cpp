@@ -7,8 +7,13 @@
 #include <cpp_odbc/connection.h>
 
 #include "mock_classes.h"
+#include <turbodbc/errors.h>
 #include <sqlext.h>
 
+#include <atomic>
+#include <chrono>
+#include <future>
+
 
 using turbodbc_test::mock_connection;
 using turbodbc_test::mock_statement;
@@ -123,6 +128,65 @@ TEST(CommandTest, UseAsyncIOAffectsResultSet)
     test_async_io<turbodbc::result_sets::double_buffered_result_set>(enable_async_io);
 }
 
+TEST(CommandTest, FinalizeFreesStatement)
+{
+    auto statement = std::make_shared<mock_statement>();
+    prepare_single_column_result_set(*statement);
+    EXPECT_CALL(*statement, do_finalize()).Times(1);
+
+    turbodbc::command command(statement, make_config());
+    command.execute();
+    command.finalize();
+}
+
+TEST(CommandTest, FinalizeClosesSharedResultSet)
+{
+    auto statement = std::make_shared<mock_statement>();
+    prepare_single_column_result_set(*statement);
+    EXPECT_CALL(*statement, do_finalize()).Times(1);
+    EXPECT_CALL(*statement, do_fetch_next()).Times(0);
+
+    turbodbc::command command(statement, make_config());
+    command.execute();
+    auto const results = command.get_results();
+    command.finalize();
+    EXPECT_THROW(results->fetch_next_batch(), turbodbc::interface_error);
+}
+
+TEST(CommandTest, FinalizeWaitsForFetchInProgress)
+{
+    auto statement = std::make_shared<mock_statement>();
+    prepare_single_column_result_set(*statement);
+
+    std::promise<void> fetch_started;
+    std::promise<void> release_fetch;
+    auto const released = release_fetch.get_future().share();
+    std::atomic<bool> fetching(false);
+    EXPECT_CALL(*statement, do_fetch_next()).WillOnce(testing::Invoke([&]() {
+        fetching = true;
+        fetch_started.set_value();
+        released.wait();
+        fetching = false;
+        return false;
+    }));
+    EXPECT_CALL(*statement, do_finalize()).WillOnce(testing::Invoke([&]() {
+        EXPECT_FALSE(fetching);
+    }));
+
+    turbodbc::command command(statement, make_config());
+    command.execute();
+    auto const results = command.get_results();
+    // a pipelined Arrow reader fetches on its own thread
+    auto fetch = std::async(std::launch::async, [results]() { return results->fetch_next_batch(); });
+    fetch_started.get_future().wait();
+
+    auto finalize = std::async(std::launch::async, [&command]() { command.finalize(); });
+    EXPECT_EQ(finalize.wait_for(std::chrono::milliseconds(50)), std::future_status::timeout);
+    release_fetch.set_value();
+    finalize.get();
+    EXPECT_EQ(0, fetch.get());
+}
+
 TEST(CommandTest, GetParameters)
 {
     auto statement = std::make_shared<mock_statement>();
@@ -21,6 +21,17 @@ TEST(ConfigurationTest, OptionsDefaults)
     EXPECT_FALSE(options.limit_varchar_results_to_max);
     EXPECT_FALSE(options.force_extra_capacity_for_unicode);
     EXPECT_FALSE(options.fetch_wchar_as_char);
+    EXPECT_FALSE(options.fetch_narrow_numeric_types);
+    EXPECT_FALSE(options.fetch_exact_decimals);
+    EXPECT_FALSE(options.fetch_rowversion_as_integer);
+    EXPECT_FALSE(options.fetch_nanosecond_timestamps);
+    EXPECT_FALSE(options.presize_string_parameters);
+    EXPECT_FALSE(options.enable_bulk_copy);
+    EXPECT_FALSE(options.adaptive_parameter_sets);
+    EXPECT_EQ(options.parameter_buffer_megabytes, 64);
+    EXPECT_EQ(options.parameter_batch_milliseconds, 1000);
+    EXPECT_EQ(options.parameter_set_retries, 0);
+    EXPECT_EQ(options.prefetch_slots, 2);
 }
 
 
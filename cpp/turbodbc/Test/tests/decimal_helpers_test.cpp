@@ -0,0 +1,179 @@
+#include "turbodbc/decimal_helpers.h"
+
+#include <gtest/gtest.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+#include <sql.h>
+
+#include <cstring>
+#include <vector>
+
+using turbodbc::numerics_to_decimal128;
+using turbodbc::decimal128_to_numerics;
+using turbodbc::decimal256_to_numerics;
+using turbodbc::uint64_to_numerics;
+using turbodbc::numerics_to_doubles;
+using turbodbc::numeric_to_string;
+
+namespace {
+
+    SQL_NUMERIC_STRUCT make_numeric(uint64_t magnitude, bool positive, int scale)
+    {
+        SQL_NUMERIC_STRUCT numeric;
+        std::memset(&numeric, 0, sizeof(numeric));
+        numeric.precision = 38;
+        numeric.scale = static_cast<SQLSCHAR>(scale);
+        numeric.sign = positive ? 1 : 0;
+        for (int i = 0; i != 8; ++i) {
+            numeric.val[i] = static_cast<SQLCHAR>(magnitude >> (8 * i));
+        }
+        return numeric;
+    }
+
+    std::vector<uint8_t> make_decimal(int64_t value)
+    {
+        std::vector<uint8_t> bytes(16, value < 0 ? 0xff : 0x00);
+        for (int i = 0; i != 8; ++i) {
+            bytes[i] = static_cast<uint8_t>(static_cast<uint64_t>(value) >> (8 * i));
+        }
+        return bytes;
+    }
+
+}
+
+TEST(DecimalHelpersTest, NumericsToDecimal128)
+{
+    std::vector<SQL_NUMERIC_STRUCT> numerics = {make_numeric(12345, true, 2),
+                                                make_numeric(12345, false, 2),
+                                                make_numeric(0, true, 2)};
+    std::vector<intptr_t> indicators = {sizeof(SQL_NUMERIC_STRUCT), sizeof(SQL_NUMERIC_STRUCT), SQL_NULL_DATA};
+    std::vector<uint8_t> decimals(16 * numerics.size(), 0xab);
+
+    numerics_to_decimal128(reinterpret_cast<char const *>(numerics.data()), indicators.data(),
+                           numerics.size(), decimals.data());
+
+    EXPECT_EQ(make_decimal(12345), std::vector<uint8_t>(decimals.begin(), decimals.begin() + 16));
+    EXPECT_EQ(make_decimal(-12345), std::vector<uint8_t>(decimals.begin() + 16, decimals.begin() + 32));
+    EXPECT_EQ(make_decimal(0), std::vector<uint8_t>(decimals.begin() + 32, decimals.end()));
+}
+
+TEST(DecimalHelpersTest, NumericsToDecimal128UsesHighBytes)
+{
+    auto numeric = make_numeric(0, true, 0);
+    numeric.val[8] = 1;
+    intptr_t indicator = sizeof(SQL_NUMERIC_STRUCT);
+    std::vector<uint8_t> decimal(16);
+
+    numerics_to_decimal128(reinterpret_cast<char const *>(&numeric), &indicator, 1, decimal.data());
+
+    std::vector<uint8_t> expected(16, 0);
+    expected[8] = 1;
+    EXPECT_EQ(expected, decimal);
+}
+
+TEST(DecimalHelpersTest, Decimal128ToNumericsRoundtrip)
+{
+    auto const positive = make_decimal(987654321);
+    auto const negative = make_decimal(-42);
+    std::vector<uint8_t> decimals(positive);
+    decimals.insert(decimals.end(), negative.begin(), negative.end());
+    std::vector<SQL_NUMERIC_STRUCT> numerics(2);
+
+    decimal128_to_numerics(decimals.data(), 2, 20, 4, reinterpret_cast<char *>(numerics.data()));
+
+    EXPECT_EQ(20, numerics[0].precision);
+    EXPECT_EQ(4, numerics[0].scale);
+    EXPECT_EQ(1, numerics[0].sign);
+    EXPECT_EQ(0, numerics[1].sign);
+    EXPECT_EQ(42, numerics[1].val[0]);
+    EXPECT_EQ(0, numerics[1].val[15]);
+
+    std::vector<intptr_t> indicators(2, sizeof(SQL_NUMERIC_STRUCT));
+    std::vector<uint8_t> roundtrip(decimals.size());
+    numerics_to_decimal128(reinterpret_cast<char const *>(numerics.data()), indicators.data(),
+                           2, roundtrip.data());
+    EXPECT_EQ(decimals, roundtrip);
+}
+
+TEST(DecimalHelpersTest, Decimal256ToNumerics)
+{
+    std::vector<uint8_t> decimals_128;
+    std::vector<uint8_t> decimals_256;
+    for (auto const value : {int64_t(987654321), int64_t(-42)}) {
+        auto const decimal = make_decimal(value);
+        decimals_128.insert(decimals_128.end(), decimal.begin(), decimal.end());
+        decimals_256.insert(decimals_256.end(), decimal.begin(), decimal.end());
+        // sign extension into the upper 128 bits
+        decimals_256.insert(decimals_256.end(), 16, value < 0 ? 0xff : 0x00);
+    }
+    std::vector<SQL_NUMERIC_STRUCT> expected(2);
+    std::vector<SQL_NUMERIC_STRUCT> numerics(2);
+
+    decimal128_to_numerics(decimals_128.data(), 2, 20, 4, reinterpret_cast<char *>(expected.data()));
+    decimal256_to_numerics(decimals_256.data(), 2, 20, 4, reinterpret_cast<char *>(numerics.data()));
+
+    EXPECT_EQ(0, std::memcmp(expected.data(), numerics.data(), sizeof(SQL_NUMERIC_STRUCT) * 2));
+}
+
+TEST(DecimalHelpersTest, Uint64ToNumerics)
+{
+    std::vector<uint64_t> const values = {0, 18446744073709551615ULL};
+    std::vector<SQL_NUMERIC_STRUCT> numerics(values.size());
+
+    uint64_to_numerics(values.data(), values.size(), reinterpret_cast<char *>(numerics.data()));
+
+    for (auto const & numeric : numerics) {
+        EXPECT_EQ(20, numeric.precision);
+        EXPECT_EQ(0, numeric.scale);
+        EXPECT_EQ(1, numeric.sign);
+    }
+    EXPECT_EQ(0, numerics[0].val[0]);
+    for (int i = 0; i != 8; ++i) {
+        EXPECT_EQ(0xff, numerics[1].val[i]);
+        EXPECT_EQ(0, numerics[1].val[i + 8]);
+    }
+}
+
+TEST(DecimalHelpersTest, NumericsToDoubles)
+{
+    std::vector<SQL_NUMERIC_STRUCT> numerics = {make_numeric(12345, true, 2),
+                                                make_numeric(5, false, 2),
+                                                make_numeric(99, true, 2)};
+    std::vector<intptr_t> indicators = {sizeof(SQL_NUMERIC_STRUCT), sizeof(SQL_NUMERIC_STRUCT), SQL_NULL_DATA};
+    std::vector<double> values(numerics.size(), 1.0);
+
+    numerics_to_doubles(reinterpret_cast<char const *>(numerics.data()), indicators.data(),
+                        numerics.size(), 2, values.data());
+
+    EXPECT_DOUBLE_EQ(123.45, values[0]);
+    EXPECT_DOUBLE_EQ(-0.05, values[1]);
+    EXPECT_EQ(0.0, values[2]);
+}
+
+TEST(DecimalHelpersTest, NumericToString)
+{
+    auto const positive = make_numeric(12345, true, 2);
+    auto const negative = make_numeric(5, false, 3);
+    auto const zero = make_numeric(0, false, 2);
+    auto const integral = make_numeric(42, true, 0);
+    auto const negative_scale = make_numeric(42, true, -2);
+
+    EXPECT_EQ("123.45", numeric_to_string(reinterpret_cast<char const *>(&positive), 2));
+    EXPECT_EQ("-0.005", numeric_to_string(reinterpret_cast<char const *>(&negative), 3));
+    EXPECT_EQ("0.00", numeric_to_string(reinterpret_cast<char const *>(&zero), 2));
+    EXPECT_EQ("42", numeric_to_string(reinterpret_cast<char const *>(&integral), 0));
+    EXPECT_EQ("4200", numeric_to_string(reinterpret_cast<char const *>(&negative_scale), -2));
+}
+
+TEST(DecimalHelpersTest, NumericToStringWithThirtyEightDigits)
+{
+    auto numeric = make_numeric(0, true, 0);
+    // 10^38 - 1 = 0x4B3B4CA85A86C47A098A223FFFFFFFFF
+    uint8_t const maximum[16] = {0xff, 0xff, 0xff, 0xff, 0x3f, 0x22, 0x8a, 0x09,
+                                 0x7a, 0xc4, 0x86, 0x5a, 0xa8, 0x4c, 0x3b, 0x4b};
+    std::memcpy(numeric.val, maximum, 16);
+
+    EXPECT_EQ(std::string(38, '9'), numeric_to_string(reinterpret_cast<char const *>(&numeric), 0));
+}
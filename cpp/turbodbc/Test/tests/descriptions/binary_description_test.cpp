@@ -0,0 +1,33 @@
+#include "turbodbc/descriptions/binary_description.h"
+
+#include <gtest/gtest.h>
+#include <sqlext.h>
+
+
+TEST(BinaryDescriptionTest, BasicProperties)
+{
+	std::size_t const size = 42;
+	turbodbc::binary_description const description(size);
+
+	EXPECT_EQ(size, description.element_size());
+	EXPECT_EQ(SQL_C_BINARY, description.column_c_type());
+	EXPECT_EQ(SQL_VARBINARY, description.column_sql_type());
+	EXPECT_EQ(0, description.digits());
+}
+
+TEST(BinaryDescriptionTest, GetTypeCode)
+{
+	turbodbc::binary_description const description(42);
+	EXPECT_EQ(turbodbc::type_code::binary, description.get_type_code());
+}
+
+TEST(BinaryDescriptionTest, CustomNameAndNullableSupport)
+{
+	std::string const expected_name("my_name");
+	bool const expected_supports_null = false;
+
+	turbodbc::binary_description const description(expected_name, expected_supports_null, 42);
+
+	EXPECT_EQ(expected_name, description.name());
+	EXPECT_EQ(expected_supports_null, description.supports_null_values());
+}
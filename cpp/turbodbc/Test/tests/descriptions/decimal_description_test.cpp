@@ -0,0 +1,35 @@
+#include "turbodbc/descriptions/decimal_description.h"
+
+#include <gtest/gtest.h>
+#include <sqlext.h>
+
+
+TEST(DecimalDescriptionTest, BasicProperties)
+{
+	turbodbc::decimal_description const description(18, 3);
+
+	EXPECT_EQ(sizeof(SQL_NUMERIC_STRUCT), description.element_size());
+	EXPECT_EQ(SQL_C_NUMERIC, description.column_c_type());
+	EXPECT_EQ(SQL_DECIMAL, description.column_sql_type());
+	EXPECT_EQ(3, description.digits());
+	EXPECT_EQ(18, description.precision());
+}
+
+TEST(DecimalDescriptionTest, GetTypeCode)
+{
+	turbodbc::decimal_description const description(18, 3);
+	EXPECT_EQ(turbodbc::type_code::decimal, description.get_type_code());
+}
+
+TEST(DecimalDescriptionTest, CustomNameAndNullableSupport)
+{
+	std::string const expected_name("my_name");
+	bool const expected_supports_null = false;
+
+	turbodbc::decimal_description const description(expected_name, expected_supports_null, 10, 2);
+
+	EXPECT_EQ(expected_name, description.name());
+	EXPECT_EQ(expected_supports_null, description.supports_null_values());
+	EXPECT_EQ(10, description.precision());
+	EXPECT_EQ(2, description.digits());
+}
@@ -0,0 +1,32 @@
+#include "turbodbc/descriptions/floating_point_32_description.h"
+
+#include <gtest/gtest.h>
+#include <sqlext.h>
+
+
+TEST(FloatingPoint32DescriptionTest, BasicProperties)
+{
+	turbodbc::floating_point_32_description const description;
+
+	EXPECT_EQ(sizeof(float), description.element_size());
+	EXPECT_EQ(SQL_C_FLOAT, description.column_c_type());
+	EXPECT_EQ(SQL_REAL, description.column_sql_type());
+	EXPECT_EQ(0, description.digits());
+}
+
+TEST(FloatingPoint32DescriptionTest, GetTypeCode)
+{
+	turbodbc::floating_point_32_description const description;
+	EXPECT_EQ(turbodbc::type_code::floating_point_32, description.get_type_code());
+}
+
+TEST(FloatingPoint32DescriptionTest, CustomNameAndNullableSupport)
+{
+	std::string const expected_name("my_name");
+	bool const expected_supports_null = false;
+
+	turbodbc::floating_point_32_description const description(expected_name, expected_supports_null);
+
+	EXPECT_EQ(expected_name, description.name());
+	EXPECT_EQ(expected_supports_null, description.supports_null_values());
+}
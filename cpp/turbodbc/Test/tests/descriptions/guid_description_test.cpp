@@ -0,0 +1,32 @@
+#include "turbodbc/descriptions/guid_description.h"
+
+#include <gtest/gtest.h>
+#include <sqlext.h>
+
+
+TEST(GuidDescriptionTest, BasicProperties)
+{
+	turbodbc::guid_description const description;
+
+	EXPECT_EQ(sizeof(SQLGUID), description.element_size());
+	EXPECT_EQ(SQL_C_GUID, description.column_c_type());
+	EXPECT_EQ(SQL_GUID, description.column_sql_type());
+	EXPECT_EQ(0, description.digits());
+}
+
+TEST(GuidDescriptionTest, GetTypeCode)
+{
+	turbodbc::guid_description const description;
+	EXPECT_EQ(turbodbc::type_code::guid, description.get_type_code());
+}
+
+TEST(GuidDescriptionTest, CustomNameAndNullableSupport)
+{
+	std::string const expected_name("my_name");
+	bool const expected_supports_null = false;
+
+	turbodbc::guid_description const description(expected_name, expected_supports_null);
+
+	EXPECT_EQ(expected_name, description.name());
+	EXPECT_EQ(expected_supports_null, description.supports_null_values());
+}
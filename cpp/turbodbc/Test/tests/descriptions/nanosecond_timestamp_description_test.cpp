@@ -0,0 +1,32 @@
+#include "turbodbc/descriptions/nanosecond_timestamp_description.h"
+
+#include <gtest/gtest.h>
+#include <sqlext.h>
+
+
+TEST(NanosecondTimestampDescriptionTest, BasicProperties)
+{
+	turbodbc::nanosecond_timestamp_description const description;
+
+	EXPECT_EQ(sizeof(SQL_TIMESTAMP_STRUCT), description.element_size());
+	EXPECT_EQ(SQL_C_TYPE_TIMESTAMP, description.column_c_type());
+	EXPECT_EQ(SQL_TYPE_TIMESTAMP, description.column_sql_type());
+	EXPECT_EQ(7, description.digits());
+}
+
+TEST(NanosecondTimestampDescriptionTest, GetTypeCode)
+{
+	turbodbc::nanosecond_timestamp_description const description;
+	EXPECT_EQ(turbodbc::type_code::timestamp_nanoseconds, description.get_type_code());
+}
+
+TEST(NanosecondTimestampDescriptionTest, CustomNameAndNullableSupport)
+{
+	std::string const expected_name("my_name");
+	bool const expected_supports_null = false;
+
+	turbodbc::nanosecond_timestamp_description const description(expected_name, expected_supports_null);
+
+	EXPECT_EQ(expected_name, description.name());
+	EXPECT_EQ(expected_supports_null, description.supports_null_values());
+}
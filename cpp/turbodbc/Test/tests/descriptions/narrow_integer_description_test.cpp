@@ -0,0 +1,56 @@
+#include "turbodbc/descriptions/narrow_integer_description.h"
+
+#include <gtest/gtest.h>
+#include <sqlext.h>
+
+#include <stdexcept>
+
+
+TEST(NarrowIntegerDescriptionTest, BasicProperties8)
+{
+	turbodbc::narrow_integer_description const description(1);
+
+	EXPECT_EQ(sizeof(int8_t), description.element_size());
+	EXPECT_EQ(SQL_C_STINYINT, description.column_c_type());
+	EXPECT_EQ(SQL_TINYINT, description.column_sql_type());
+	EXPECT_EQ(0, description.digits());
+	EXPECT_EQ(turbodbc::type_code::integer_8, description.get_type_code());
+}
+
+TEST(NarrowIntegerDescriptionTest, BasicProperties16)
+{
+	turbodbc::narrow_integer_description const description(2);
+
+	EXPECT_EQ(sizeof(int16_t), description.element_size());
+	EXPECT_EQ(SQL_C_SSHORT, description.column_c_type());
+	EXPECT_EQ(SQL_SMALLINT, description.column_sql_type());
+	EXPECT_EQ(0, description.digits());
+	EXPECT_EQ(turbodbc::type_code::integer_16, description.get_type_code());
+}
+
+TEST(NarrowIntegerDescriptionTest, BasicProperties32)
+{
+	turbodbc::narrow_integer_description const description(4);
+
+	EXPECT_EQ(sizeof(int32_t), description.element_size());
+	EXPECT_EQ(SQL_C_SLONG, description.column_c_type());
+	EXPECT_EQ(SQL_INTEGER, description.column_sql_type());
+	EXPECT_EQ(0, description.digits());
+	EXPECT_EQ(turbodbc::type_code::integer_32, description.get_type_code());
+}
+
+TEST(NarrowIntegerDescriptionTest, UnsupportedSizeThrows)
+{
+	EXPECT_THROW(turbodbc::narrow_integer_description(8), std::logic_error);
+}
+
+TEST(NarrowIntegerDescriptionTest, CustomNameAndNullableSupport)
+{
+	std::string const expected_name("my_name");
+	bool const expected_supports_null = false;
+
+	turbodbc::narrow_integer_description const description(expected_name, expected_supports_null, 2);
+
+	EXPECT_EQ(expected_name, description.name());
+	EXPECT_EQ(expected_supports_null, description.supports_null_values());
+}
@@ -0,0 +1,32 @@
+#include "turbodbc/descriptions/rowversion_description.h"
+
+#include <gtest/gtest.h>
+#include <sqlext.h>
+
+
+TEST(RowversionDescriptionTest, BasicProperties)
+{
+	turbodbc::rowversion_description const description;
+
+	EXPECT_EQ(8, description.element_size());
+	EXPECT_EQ(SQL_C_BINARY, description.column_c_type());
+	EXPECT_EQ(SQL_BINARY, description.column_sql_type());
+	EXPECT_EQ(0, description.digits());
+}
+
+TEST(RowversionDescriptionTest, GetTypeCode)
+{
+	turbodbc::rowversion_description const description;
+	EXPECT_EQ(turbodbc::type_code::rowversion, description.get_type_code());
+}
+
+TEST(RowversionDescriptionTest, CustomNameAndNullableSupport)
+{
+	std::string const expected_name("my_name");
+	bool const expected_supports_null = false;
+
+	turbodbc::rowversion_description const description(expected_name, expected_supports_null);
+
+	EXPECT_EQ(expected_name, description.name());
+	EXPECT_EQ(expected_supports_null, description.supports_null_values());
+}
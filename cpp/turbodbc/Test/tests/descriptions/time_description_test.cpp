@@ -0,0 +1,33 @@
+#include "turbodbc/descriptions/time_description.h"
+
+#include <turbodbc/sql_server_types.h>
+#include <gtest/gtest.h>
+#include <sqlext.h>
+
+
+TEST(TimeDescriptionTest, BasicProperties)
+{
+	turbodbc::time_description const description;
+
+	EXPECT_EQ(sizeof(turbodbc::ss_time2_struct), description.element_size());
+	EXPECT_EQ(SQL_C_BINARY, description.column_c_type());
+	EXPECT_EQ(turbodbc::sql_ss_time2, description.column_sql_type());
+	EXPECT_EQ(7, description.digits());
+}
+
+TEST(TimeDescriptionTest, GetTypeCode)
+{
+	turbodbc::time_description const description;
+	EXPECT_EQ(turbodbc::type_code::time, description.get_type_code());
+}
+
+TEST(TimeDescriptionTest, CustomNameAndNullableSupport)
+{
+	std::string const expected_name("my_name");
+	bool const expected_supports_null = false;
+
+	turbodbc::time_description const description(expected_name, expected_supports_null);
+
+	EXPECT_EQ(expected_name, description.name());
+	EXPECT_EQ(expected_supports_null, description.supports_null_values());
+}
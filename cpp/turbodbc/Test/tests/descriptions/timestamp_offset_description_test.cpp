@@ -0,0 +1,36 @@
+#include "turbodbc/descriptions/timestamp_offset_description.h"
+
+#include <turbodbc/sql_server_types.h>
+#include <gtest/gtest.h>
+#include <sqlext.h>
+
+
+TEST(TimestampOffsetDescriptionTest, BasicProperties)
+{
+	turbodbc::timestamp_offset_description const description;
+
+	EXPECT_EQ(sizeof(turbodbc::ss_timestampoffset_struct), description.element_size());
+	EXPECT_EQ(SQL_C_BINARY, description.column_c_type());
+	EXPECT_EQ(turbodbc::sql_ss_timestampoffset, description.column_sql_type());
+	EXPECT_EQ(7, description.digits());
+}
+
+TEST(TimestampOffsetDescriptionTest, GetTypeCode)
+{
+	turbodbc::timestamp_offset_description const description;
+	EXPECT_EQ(turbodbc::type_code::timestamp_offset, description.get_type_code());
+
+	turbodbc::timestamp_offset_description const nanoseconds(true);
+	EXPECT_EQ(turbodbc::type_code::timestamp_offset_nanoseconds, nanoseconds.get_type_code());
+}
+
+TEST(TimestampOffsetDescriptionTest, CustomNameAndNullableSupport)
+{
+	std::string const expected_name("my_name");
+	bool const expected_supports_null = false;
+
+	turbodbc::timestamp_offset_description const description(expected_name, expected_supports_null);
+
+	EXPECT_EQ(expected_name, description.name());
+	EXPECT_EQ(expected_supports_null, description.supports_null_values());
+}
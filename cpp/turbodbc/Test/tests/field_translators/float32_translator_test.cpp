@@ -0,0 +1,19 @@
+#include "turbodbc/field_translators/float32_translator.h"
+
+#include <gtest/gtest.h>
+
+
+using turbodbc::field_translators::float32_translator;
+
+TEST(Float32TranslatorTest, MakeField)
+{
+	cpp_odbc::multi_value_buffer buffer(4, 1);
+	auto element = buffer[0];
+	element.indicator = 4;
+	auto const & as_const = buffer;
+
+	float32_translator const translator;
+
+	*reinterpret_cast<float *>(element.data_pointer) = 0.5;
+	EXPECT_EQ(turbodbc::field{0.5}, *(translator.make_field(as_const[0])));
+}
@@ -0,0 +1,45 @@
+#include "turbodbc/field_translators/narrow_integer_translator.h"
+
+#include <gtest/gtest.h>
+
+
+using turbodbc::field_translators::narrow_integer_translator;
+
+TEST(NarrowIntegerTranslatorTest, MakeField8)
+{
+	cpp_odbc::multi_value_buffer buffer(1, 1);
+	auto element = buffer[0];
+	element.indicator = 1;
+	auto const & as_const = buffer;
+
+	narrow_integer_translator const translator(1);
+
+	*reinterpret_cast<int8_t *>(element.data_pointer) = -42;
+	EXPECT_EQ(turbodbc::field{int64_t(-42)}, *(translator.make_field(as_const[0])));
+}
+
+TEST(NarrowIntegerTranslatorTest, MakeField16)
+{
+	cpp_odbc::multi_value_buffer buffer(2, 1);
+	auto element = buffer[0];
+	element.indicator = 2;
+	auto const & as_const = buffer;
+
+	narrow_integer_translator const translator(2);
+
+	*reinterpret_cast<int16_t *>(element.data_pointer) = -1234;
+	EXPECT_EQ(turbodbc::field{int64_t(-1234)}, *(translator.make_field(as_const[0])));
+}
+
+TEST(NarrowIntegerTranslatorTest, MakeField32)
+{
+	cpp_odbc::multi_value_buffer buffer(4, 1);
+	auto element = buffer[0];
+	element.indicator = 4;
+	auto const & as_const = buffer;
+
+	narrow_integer_translator const translator(4);
+
+	*reinterpret_cast<int32_t *>(element.data_pointer) = -123456789;
+	EXPECT_EQ(turbodbc::field{int64_t(-123456789)}, *(translator.make_field(as_const[0])));
+}
@@ -0,0 +1,154 @@
+#include "turbodbc/indicator_helpers.h"
+
+#include <gtest/gtest.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+#include <sql.h>
+#include <sqlext.h>
+
+#include <vector>
+
+using turbodbc::indicators_to_validity_bitmap;
+using turbodbc::indicators_to_null_mask;
+using turbodbc::indicators_to_valid_mask;
+using turbodbc::validity_bitmap_to_indicators;
+using turbodbc::null_mask_to_indicators;
+
+namespace {
+
+    // Lengths cover empty input, partial bytes, and several vector widths plus a tail
+    std::vector<std::size_t> const lengths = {0, 1, 7, 8, 9, 31, 64, 100, 4095, 4096, 4097, 10000};
+
+    std::vector<intptr_t> make_indicators(std::size_t size, std::size_t null_every)
+    {
+        std::vector<intptr_t> indicators(size, 8);
+        for (std::size_t i = 0; i < size; i += null_every) {
+            indicators[i] = SQL_NULL_DATA;
+        }
+        return indicators;
+    }
+
+}
+
+TEST(IndicatorHelpersTest, ValidityBitmap)
+{
+    for (auto const size : lengths) {
+        auto const indicators = make_indicators(size, 3);
+        std::vector<uint8_t> bitmap((size + 7) / 8, 0xAB);
+
+        auto const null_count = indicators_to_validity_bitmap(indicators.data(), size, bitmap.data());
+
+        EXPECT_EQ((size + 2) / 3, null_count) << "size " << size;
+        for (std::size_t i = 0; i != size; ++i) {
+            bool const valid = (bitmap[i / 8] >> (i % 8)) & 1;
+            ASSERT_EQ(i % 3 != 0, valid) << "size " << size << ", element " << i;
+        }
+        if (size % 8 != 0) {
+            EXPECT_EQ(0, bitmap.back() >> (size % 8)) << "size " << size;
+        }
+    }
+}
+
+TEST(IndicatorHelpersTest, ValidityBitmapWithoutNulls)
+{
+    std::vector<intptr_t> const indicators(100, 0);
+    std::vector<uint8_t> bitmap(13, 0);
+
+    EXPECT_EQ(0, indicators_to_validity_bitmap(indicators.data(), indicators.size(), bitmap.data()));
+    EXPECT_EQ(0xFF, bitmap.front());
+    EXPECT_EQ(0x0F, bitmap.back());
+}
+
+TEST(IndicatorHelpersTest, NullMask)
+{
+    for (auto const size : lengths) {
+        auto const indicators = make_indicators(size, 5);
+        std::vector<uint8_t> mask(size, 0xAB);
+
+        auto const null_count = indicators_to_null_mask(indicators.data(), size, mask.data());
+
+        EXPECT_EQ((size + 4) / 5, null_count) << "size " << size;
+        for (std::size_t i = 0; i != size; ++i) {
+            ASSERT_EQ(i % 5 == 0 ? 1 : 0, mask[i]) << "size " << size << ", element " << i;
+        }
+    }
+}
+
+TEST(IndicatorHelpersTest, ValidMask)
+{
+    for (auto const size : lengths) {
+        auto const indicators = make_indicators(size, 2);
+        std::vector<uint8_t> mask(size, 0xAB);
+
+        auto const null_count = indicators_to_valid_mask(indicators.data(), size, mask.data());
+
+        EXPECT_EQ((size + 1) / 2, null_count) << "size " << size;
+        for (std::size_t i = 0; i != size; ++i) {
+            ASSERT_EQ(i % 2 == 0 ? 0 : 1, mask[i]) << "size " << size << ", element " << i;
+        }
+    }
+}
+
+TEST(IndicatorHelpersTest, OnlyNullDataCountsAsNull)
+{
+    // Other negative indicators such as SQL_NO_TOTAL must not be mistaken for null values
+    std::vector<intptr_t> const indicators = {SQL_NO_TOTAL, SQL_NULL_DATA, 0, -2, 0x7FFFFFFF, -1, 5, 0xFFFFFFFF, 1};
+    std::vector<uint8_t> mask(indicators.size());
+
+    EXPECT_EQ(2, indicators_to_null_mask(indicators.data(), indicators.size(), mask.data()));
+    EXPECT_EQ((std::vector<uint8_t>{0, 1, 0, 0, 0, 1, 0, 0, 0}), mask);
+}
+
+TEST(IndicatorHelpersTest, ValidityBitmapToIndicators)
+{
+    for (auto const size : lengths) {
+        for (std::size_t const bit_offset : {0, 3, 8, 13}) {
+            // every third value starting at the offset is null
+            std::vector<uint8_t> bitmap((bit_offset + size + 7) / 8 + 1, 0xFF);
+            for (std::size_t i = 0; i < size; i += 3) {
+                bitmap[(bit_offset + i) / 8] &= static_cast<uint8_t>(~(1u << ((bit_offset + i) % 8)));
+            }
+            std::vector<intptr_t> indicators(size + 1, 42);
+
+            auto const null_count = validity_bitmap_to_indicators(bitmap.data(), bit_offset, size, 8, indicators.data());
+
+            EXPECT_EQ((size + 2) / 3, null_count) << "size " << size << ", offset " << bit_offset;
+            for (std::size_t i = 0; i != size; ++i) {
+                ASSERT_EQ(i % 3 == 0 ? SQL_NULL_DATA : 8, indicators[i]) << "size " << size << ", offset " << bit_offset << ", element " << i;
+            }
+            EXPECT_EQ(42, indicators.back()) << "size " << size << ", offset " << bit_offset;
+        }
+    }
+}
+
+TEST(IndicatorHelpersTest, ValidityBitmapToIndicatorsWithinOneByte)
+{
+    uint8_t const bitmap[] = {0x5A};
+    std::vector<intptr_t> indicators(3, 42);
+
+    EXPECT_EQ(1, validity_bitmap_to_indicators(bitmap, 2, 2, 4, indicators.data()));
+    EXPECT_EQ(SQL_NULL_DATA, indicators[0]);
+    EXPECT_EQ(4, indicators[1]);
+    EXPECT_EQ(42, indicators[2]);
+}
+
+TEST(IndicatorHelpersTest, NullMaskToIndicators)
+{
+    for (auto const size : lengths) {
+        std::vector<uint8_t> mask(size, 0);
+        for (std::size_t i = 0; i < size; i += 3) {
+            mask[i] = 1;
+        }
+        std::vector<intptr_t> indicators(size + 1, 42);
+
+        auto const null_count = null_mask_to_indicators(mask.data(), size, 8, indicators.data());
+
+        EXPECT_EQ((size + 2) / 3, null_count) << "size " << size;
+        for (std::size_t i = 0; i != size; ++i) {
+            ASSERT_EQ(i % 3 == 0 ? SQL_NULL_DATA : 8, indicators[i]) << "size " << size << ", element " << i;
+        }
+        EXPECT_EQ(42, indicators.back()) << "size " << size;
+    }
+}
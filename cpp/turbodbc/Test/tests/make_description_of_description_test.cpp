@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include <turbodbc/descriptions.h>
+#include <turbodbc/sql_server_types.h>
 
 #include <sqlext.h>
 #include <sstream>
@@ -96,7 +97,7 @@ namespace {
 
 TEST(MakeDescriptionOfDescriptionTest, UnsupportedTypeThrows)
 {
-    SQLSMALLINT const unsupported_type = SQL_GUID;
+    SQLSMALLINT const unsupported_type = SQL_TYPE_TIME;
     cpp_odbc::column_description column_description = {name, unsupported_type, 0, 0, supports_null_values};
     test_unsupported(column_description);
 }
@@ -328,6 +329,29 @@ TEST(MakeDescriptionOfDescriptionTest, FloatingPointTypes)
     }
 }
 
+TEST(MakeDescriptionOfDescriptionTest, NarrowNumericTypes)
+{
+    std::vector<std::pair<SQLSMALLINT, turbodbc::type_code>> const types = {
+            {SQL_TINYINT, turbodbc::type_code::integer_8},
+            {SQL_SMALLINT, turbodbc::type_code::integer_16},
+            {SQL_INTEGER, turbodbc::type_code::integer_32},
+            {SQL_BIGINT, turbodbc::type_code::integer},
+            {SQL_REAL, turbodbc::type_code::floating_point_32},
+            {SQL_DOUBLE, turbodbc::type_code::floating_point}
+        };
+
+    turbodbc::options options;
+    options.fetch_narrow_numeric_types = true;
+
+    for (auto const & type : types) {
+        cpp_odbc::column_description column_description = {name, type.first, 0, 0, supports_null_values};
+        auto const description = make_description(column_description, options);
+        EXPECT_EQ(type.second, description->get_type_code())
+            << "Unexpected type code for type identifier '" << type.first << "'";
+        assert_custom_name_and_nullable_support(*description);
+    }
+}
+
 TEST(MakeDescriptionOfDescriptionTest, BitType)
 {
     SQLSMALLINT const type = SQL_BIT;
@@ -411,3 +435,117 @@ TEST(MakeDescriptionOfDescriptionTest, LargeDecimalAsFloatingPoint)
     test_as_floating_point(make_decimal_column_description(size, 1), large_decimals_as_64_bit_types);
 }
 
+
+TEST(MakeDescriptionOfDescriptionTest, ExactDecimal)
+{
+    turbodbc::options options;
+    options.fetch_exact_decimals = true;
+
+    for (auto const & column_description : {make_decimal_column_description(38, 5),
+                                            make_numeric_column_description(10, 0)}) {
+        auto const description = make_description(column_description, options);
+        ASSERT_TRUE(dynamic_cast<turbodbc::decimal_description const *>(description.get()));
+        EXPECT_EQ(static_cast<SQLSMALLINT>(column_description.size), description->precision());
+        EXPECT_EQ(column_description.decimal_digits, description->digits());
+        assert_custom_name_and_nullable_support(*description);
+    }
+}
+
+TEST(MakeDescriptionOfDescriptionTest, ExactDecimalTooLargeFallsBack)
+{
+    turbodbc::options options;
+    options.fetch_exact_decimals = true;
+
+    auto const description = make_description(make_decimal_column_description(39, 5), options);
+    EXPECT_EQ(turbodbc::type_code::string, description->get_type_code());
+}
+
+TEST(MakeDescriptionOfDescriptionTest, BinaryTypes)
+{
+    std::vector<SQLSMALLINT> const types = {
+            SQL_BINARY, SQL_VARBINARY, SQL_LONGVARBINARY
+        };
+
+    std::size_t const size = 42;
+    for (auto const type : types) {
+        cpp_odbc::column_description column_description = {name, type, size, 0, supports_null_values};
+        test_text_with_string_preference<turbodbc::binary_description>(column_description, size);
+    }
+}
+
+TEST(MakeDescriptionOfDescriptionTest, BinaryMaxUsesVarcharLimit)
+{
+    turbodbc::options options;
+    options.varchar_max_character_limit = 100;
+
+    cpp_odbc::column_description column_description = {name, SQL_VARBINARY, 0, 0, supports_null_values};
+    auto const description = make_description(column_description, options);
+    ASSERT_TRUE(dynamic_cast<turbodbc::binary_description const *>(description.get()));
+    EXPECT_EQ(100, description->element_size());
+}
+
+TEST(MakeDescriptionOfDescriptionTest, RowversionAsInteger)
+{
+    turbodbc::options options;
+    options.fetch_rowversion_as_integer = true;
+
+    cpp_odbc::column_description rowversion = {name, SQL_BINARY, 8, 0, supports_null_values};
+    auto const description = make_description(rowversion, options);
+    EXPECT_EQ(turbodbc::type_code::rowversion, description->get_type_code());
+    assert_custom_name_and_nullable_support(*description);
+
+    cpp_odbc::column_description other_binary = {name, SQL_VARBINARY, 8, 0, supports_null_values};
+    EXPECT_EQ(turbodbc::type_code::binary, make_description(other_binary, options)->get_type_code());
+
+    options.fetch_rowversion_as_integer = false;
+    EXPECT_EQ(turbodbc::type_code::binary, make_description(rowversion, options)->get_type_code());
+}
+
+TEST(MakeDescriptionOfDescriptionTest, SqlServerTemporalAndGuidTypes)
+{
+    std::vector<std::pair<SQLSMALLINT, turbodbc::type_code>> const types = {
+            {turbodbc::sql_ss_time2, turbodbc::type_code::time},
+            {turbodbc::sql_ss_timestampoffset, turbodbc::type_code::timestamp_offset},
+            {SQL_GUID, turbodbc::type_code::guid}
+        };
+
+    for (auto const & type : types) {
+        cpp_odbc::column_description column_description = {name, type.first, 0, 7, supports_null_values};
+        auto const description = make_description(column_description, make_options(prefer_strings, large_decimals_as_strings));
+        EXPECT_EQ(type.second, description->get_type_code())
+            << "Unexpected type code for type identifier '" << type.first << "'";
+        assert_custom_name_and_nullable_support(*description);
+    }
+}
+
+TEST(MakeDescriptionOfDescriptionTest, NanosecondTimestamps)
+{
+    turbodbc::options options;
+    options.fetch_nanosecond_timestamps = true;
+
+    cpp_odbc::column_description datetime2 = {name, SQL_TYPE_TIMESTAMP, 27, 7, supports_null_values};
+    auto const description = make_description(datetime2, options);
+    ASSERT_TRUE(dynamic_cast<turbodbc::nanosecond_timestamp_description const *>(description.get()));
+    assert_custom_name_and_nullable_support(*description);
+
+    cpp_odbc::column_description datetime = {name, SQL_TYPE_TIMESTAMP, 23, 3, supports_null_values};
+    EXPECT_EQ(turbodbc::type_code::timestamp, make_description(datetime, options)->get_type_code());
+
+    options.fetch_nanosecond_timestamps = false;
+    EXPECT_EQ(turbodbc::type_code::timestamp, make_description(datetime2, options)->get_type_code());
+}
+
+TEST(MakeDescriptionOfDescriptionTest, NanosecondTimestampOffsets)
+{
+    turbodbc::options options;
+    cpp_odbc::column_description datetimeoffset = {name, turbodbc::sql_ss_timestampoffset, 34, 7, supports_null_values};
+    EXPECT_EQ(turbodbc::type_code::timestamp_offset, make_description(datetimeoffset, options)->get_type_code());
+
+    options.fetch_nanosecond_timestamps = true;
+    auto const description = make_description(datetimeoffset, options);
+    EXPECT_EQ(turbodbc::type_code::timestamp_offset_nanoseconds, description->get_type_code());
+    assert_custom_name_and_nullable_support(*description);
+
+    cpp_odbc::column_description datetimeoffset_3 = {name, turbodbc::sql_ss_timestampoffset, 30, 3, supports_null_values};
+    EXPECT_EQ(turbodbc::type_code::timestamp_offset, make_description(datetimeoffset_3, options)->get_type_code());
+}
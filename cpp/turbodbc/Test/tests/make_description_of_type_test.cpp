@@ -30,6 +30,25 @@ TEST(MakeDescriptionOfTypeTest, FromDouble)
 	ASSERT_TRUE( dynamic_cast<turbodbc::floating_point_description const *>(description.get()) );
 }
 
+TEST(MakeDescriptionOfTypeTest, FromNarrowInteger)
+{
+	auto description = make_description(type_code::integer_8, size_not_important);
+	ASSERT_TRUE( dynamic_cast<turbodbc::narrow_integer_description const *>(description.get()) );
+	EXPECT_EQ(type_code::integer_8, description->get_type_code());
+
+	description = make_description(type_code::integer_16, size_not_important);
+	EXPECT_EQ(type_code::integer_16, description->get_type_code());
+
+	description = make_description(type_code::integer_32, size_not_important);
+	EXPECT_EQ(type_code::integer_32, description->get_type_code());
+}
+
+TEST(MakeDescriptionOfTypeTest, FromFloat)
+{
+	auto description = make_description(type_code::floating_point_32, size_not_important);
+	ASSERT_TRUE( dynamic_cast<turbodbc::floating_point_32_description const *>(description.get()) );
+}
+
 TEST(MakeDescriptionOfTypeTest, FromBool)
 {
 	auto description = make_description(type_code::boolean, size_not_important);
@@ -89,3 +108,26 @@ TEST(MakeDescriptionOfTypeTest, FromUnicodeProvidesExtraSpaceForLargeStrings)
 
 	EXPECT_GT(as_unicode_description->element_size(), 2 * (large_string.size() + 1));
 }
+
+TEST(MakeDescriptionOfTypeTest, FromBinaryProvidesExtraSpace)
+{
+	std::size_t const size = 100;
+	auto description = make_description(type_code::binary, size);
+	ASSERT_TRUE( dynamic_cast<turbodbc::binary_description const *>(description.get()) );
+	EXPECT_GT(description->element_size(), size);
+}
+
+TEST(MakeDescriptionOfTypeTest, FromRowversion)
+{
+	auto description = make_description(type_code::rowversion, size_not_important);
+	ASSERT_TRUE( dynamic_cast<turbodbc::rowversion_description const *>(description.get()) );
+}
+
+TEST(MakeDescriptionOfTypeTest, FromTemporalAndGuidTypes)
+{
+	ASSERT_TRUE( dynamic_cast<turbodbc::time_description const *>(make_description(type_code::time, size_not_important).get()) );
+	ASSERT_TRUE( dynamic_cast<turbodbc::nanosecond_timestamp_description const *>(make_description(type_code::timestamp_nanoseconds, size_not_important).get()) );
+	ASSERT_TRUE( dynamic_cast<turbodbc::timestamp_offset_description const *>(make_description(type_code::timestamp_offset, size_not_important).get()) );
+	EXPECT_EQ(type_code::timestamp_offset_nanoseconds, make_description(type_code::timestamp_offset_nanoseconds, size_not_important)->get_type_code());
+	ASSERT_TRUE( dynamic_cast<turbodbc::guid_description const *>(make_description(type_code::guid, size_not_important).get()) );
+}
@@ -56,3 +56,17 @@ TEST(MakeFieldTranslatorTest, TimestampType)
 	turbodbc::column_info info = {"name", turbodbc::type_code::timestamp, size_unimportant, true};
 	EXPECT_TRUE(dynamic_cast<turbodbc::field_translators::timestamp_translator const *>(make_field_translator(info).get()));
 }
+
+TEST(MakeFieldTranslatorTest, Float32Type)
+{
+	turbodbc::column_info info = {"name", turbodbc::type_code::floating_point_32, 4, true};
+	EXPECT_TRUE(dynamic_cast<turbodbc::field_translators::float32_translator const *>(make_field_translator(info).get()));
+}
+
+TEST(MakeFieldTranslatorTest, NarrowIntegerTypes)
+{
+	for (auto const type : {turbodbc::type_code::integer_8, turbodbc::type_code::integer_16, turbodbc::type_code::integer_32}) {
+		turbodbc::column_info info = {"name", type, size_unimportant, true};
+		EXPECT_TRUE(dynamic_cast<turbodbc::field_translators::narrow_integer_translator const *>(make_field_translator(info).get()));
+	}
+}
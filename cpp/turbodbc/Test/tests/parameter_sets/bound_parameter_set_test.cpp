@@ -1,12 +1,18 @@
 #include "turbodbc/parameter_sets/bound_parameter_set.h"
 
 #include "turbodbc/make_description.h"
+#include "turbodbc/sql_server_types.h"
+#include "turbodbc/errors.h"
 #include <cpp_odbc/error.h>
 
 #include <gtest/gtest.h>
 #include <tests/mock_classes.h>
 
+#include <chrono>
+#include <map>
 #include <stdexcept>
+#include <string>
+#include <thread>
 #include <sqlext.h>
 
 
@@ -38,6 +44,8 @@ namespace {
     cpp_odbc::column_description const string_description_max_length = {"dummy", SQL_VARCHAR, 16, 0, true};
     cpp_odbc::column_description const string_description_slightly_too_long = {"dummy", SQL_VARCHAR, 17, 0, true};
     cpp_odbc::column_description const string_description_too_long = {"dummy", SQL_VARCHAR, 50, 0, true};
+    cpp_odbc::column_description const binary_description_short = {"dummy", SQL_VARBINARY, 7, 0, true};
+    cpp_odbc::column_description const binary_description_too_long = {"dummy", SQL_VARBINARY, 50, 0, true};
 
 }
 
@@ -150,6 +158,42 @@ TEST(BoundParameterSetTest, ConstructorOverridesStringParameterLengthSuggestions
 }
 
 
+TEST(BoundParameterSetTest, ConstructorKeepsDeclaredStringLengthsIfPresizing)
+{
+    mock_statement statement;
+    ON_CALL(statement, do_number_of_parameters()).WillByDefault(testing::Return(2));
+    ON_CALL(statement, do_describe_parameter(1))
+        .WillByDefault(testing::Return(string_description_too_long));
+    ON_CALL(statement, do_describe_parameter(2))
+        .WillByDefault(testing::Return(cpp_odbc::column_description{"dummy", SQL_VARCHAR, 0, 0, true}));
+
+    auto configuration = make_config(42, prefer_string, query_db_for_types);
+    configuration.options.presize_string_parameters = true;
+
+    bound_parameter_set params(statement, configuration);
+    EXPECT_EQ(params.get_parameters()[0]->get_buffer().capacity_per_element(), string_description_too_long.size + 1);
+    EXPECT_EQ(params.get_parameters()[1]->get_buffer().capacity_per_element(), string_description_max_length.size + 1);
+}
+
+
+TEST(BoundParameterSetTest, ConstructorOverridesBinaryParameterLengthSuggestions)
+{
+    mock_statement statement;
+    ON_CALL(statement, do_number_of_parameters()).WillByDefault(testing::Return(2));
+    ON_CALL(statement, do_describe_parameter(1))
+        .WillByDefault(testing::Return(binary_description_short));
+    ON_CALL(statement, do_describe_parameter(2))
+        .WillByDefault(testing::Return(binary_description_too_long));
+
+    EXPECT_CALL(statement, do_bind_input_parameter(1, SQL_C_BINARY, SQL_VARBINARY, testing::_, testing::_)).Times(1);
+    EXPECT_CALL(statement, do_bind_input_parameter(2, SQL_C_BINARY, SQL_VARBINARY, testing::_, testing::_)).Times(1);
+
+    bound_parameter_set params(statement, make_config(42, prefer_string, query_db_for_types));
+    EXPECT_EQ(params.get_parameters()[0]->get_buffer().capacity_per_element(), binary_description_short.size);
+    EXPECT_EQ(params.get_parameters()[1]->get_buffer().capacity_per_element(), 16);
+}
+
+
 TEST(BoundParameterSetTest, ConstructorOverridesUnicodeParameterLengthSuggestions)
 {
     mock_statement statement;
@@ -197,6 +241,106 @@ TEST(BoundParameterSetTest, Rebind)
     EXPECT_EQ(params.get_parameters()[1]->get_buffer().number_of_elements(), 42);
 }
 
+TEST(BoundParameterSetTest, EnsureCapacityKeepsSuitableParameter)
+{
+    mock_statement statement;
+    ON_CALL(statement, do_number_of_parameters()).WillByDefault(testing::Return(1));
+    ON_CALL(statement, do_describe_parameter(1))
+        .WillByDefault(testing::Return(string_description_short));
+
+    bound_parameter_set params(statement, make_config(42, prefer_string, query_db_for_types));
+    auto const original = params.get_parameters()[0];
+
+    EXPECT_CALL(statement, do_bind_input_parameter(testing::_, testing::_, testing::_, testing::_, testing::_)).Times(0);
+    EXPECT_FALSE(params.ensure_capacity(0, type_code::string, string_description_short.size));
+    EXPECT_FALSE(params.ensure_capacity(0, type_code::string, 3));
+    EXPECT_EQ(params.get_parameters()[0], original);
+}
+
+TEST(BoundParameterSetTest, EnsureCapacityGrowsTooSmallParameter)
+{
+    mock_statement statement;
+    ON_CALL(statement, do_number_of_parameters()).WillByDefault(testing::Return(1));
+    ON_CALL(statement, do_describe_parameter(1))
+        .WillByDefault(testing::Return(string_description_short));
+
+    bound_parameter_set params(statement, make_config(42, prefer_string, query_db_for_types));
+
+    EXPECT_CALL(statement, do_bind_input_parameter(1, SQL_C_CHAR, SQL_VARCHAR, testing::_, testing::_)).Times(1);
+    EXPECT_TRUE(params.ensure_capacity(0, type_code::string, 30));
+    EXPECT_GT(params.get_parameters()[0]->get_buffer().capacity_per_element(), 30);
+    EXPECT_FALSE(params.ensure_capacity(0, type_code::string, 30));
+}
+
+TEST(BoundParameterSetTest, EnsureCapacityRebindsOnTypeChange)
+{
+    mock_statement statement;
+    ON_CALL(statement, do_number_of_parameters()).WillByDefault(testing::Return(1));
+    ON_CALL(statement, do_describe_parameter(1))
+        .WillByDefault(testing::Return(string_description_short));
+
+    bound_parameter_set params(statement, make_config(42, prefer_string, query_db_for_types));
+
+    EXPECT_CALL(statement, do_bind_input_parameter(1, SQL_C_WCHAR, SQL_WVARCHAR, testing::_, testing::_)).Times(1);
+    EXPECT_TRUE(params.ensure_capacity(0, type_code::unicode, 3));
+}
+
+TEST(BoundParameterSetTest, BindOnExecute)
+{
+    mock_statement statement;
+    ON_CALL(statement, do_number_of_parameters()).WillByDefault(testing::Return(2));
+    ON_CALL(statement, do_describe_parameter(1))
+        .WillByDefault(testing::Return(int_description));
+    ON_CALL(statement, do_describe_parameter(2))
+        .WillByDefault(testing::Return(int_description));
+
+    bound_parameter_set params(statement, make_config(42, prefer_string, query_db_for_types), true);
+    testing::Mock::VerifyAndClearExpectations(&statement);
+
+    // rebinding only replaces the buffer
+    EXPECT_CALL(statement, do_bind_input_parameter(testing::_, testing::_, testing::_, testing::_, testing::_)).Times(0);
+    params.rebind(1, make_description(type_code::timestamp, 0));
+    testing::Mock::VerifyAndClearExpectations(&statement);
+
+    testing::InSequence ordered;
+    EXPECT_CALL(statement, do_bind_input_parameter(1, SQL_C_SBIGINT, SQL_BIGINT, 0, testing::Ref(params.get_parameters()[0]->get_buffer())));
+    EXPECT_CALL(statement, do_bind_input_parameter(2, SQL_C_TYPE_TIMESTAMP, SQL_TYPE_TIMESTAMP, 6, testing::Ref(params.get_parameters()[1]->get_buffer())));
+    EXPECT_CALL(statement, do_set_attribute(SQL_ATTR_PARAMS_PROCESSED_PTR, testing::An<SQLULEN *>()));
+    EXPECT_CALL(statement, do_set_attribute(SQL_ATTR_PARAMSET_SIZE, 23));
+    EXPECT_CALL(statement, do_execute_prepared());
+
+    params.execute_batch(23);
+}
+
+TEST(BoundParameterSetTest, InvalidatedBindingsAreRestoredOnExecute)
+{
+    mock_statement statement;
+    ON_CALL(statement, do_number_of_parameters()).WillByDefault(testing::Return(1));
+    ON_CALL(statement, do_describe_parameter(1))
+        .WillByDefault(testing::Return(int_description));
+
+    bound_parameter_set params(statement, make_config(42, prefer_string, query_db_for_types));
+    params.invalidate_bindings();
+    testing::Mock::VerifyAndClearExpectations(&statement);
+
+    {
+        testing::InSequence ordered;
+        EXPECT_CALL(statement, do_unbind_all_parameters());
+        EXPECT_CALL(statement, do_bind_input_parameter(1, SQL_C_SBIGINT, SQL_BIGINT, 0, testing::Ref(params.get_parameters()[0]->get_buffer())));
+        EXPECT_CALL(statement, do_set_attribute(SQL_ATTR_PARAMS_PROCESSED_PTR, testing::An<SQLULEN *>()));
+        EXPECT_CALL(statement, do_set_attribute(SQL_ATTR_PARAM_STATUS_PTR, testing::An<SQLUSMALLINT *>()));
+        EXPECT_CALL(statement, do_set_attribute(SQL_ATTR_PARAMSET_SIZE, 23));
+        EXPECT_CALL(statement, do_execute_prepared());
+    }
+    params.execute_batch(23);
+    testing::Mock::VerifyAndClearExpectations(&statement);
+
+    // bindings are restored only once
+    EXPECT_CALL(statement, do_unbind_all_parameters()).Times(0);
+    EXPECT_CALL(statement, do_bind_input_parameter(testing::_, testing::_, testing::_, testing::_, testing::_)).Times(0);
+    params.execute_batch(23);
+}
+
 namespace {
     template <typename MockStatement>
     void configure_single_param(MockStatement & statement) {
@@ -331,3 +475,405 @@ TEST(BoundParameterSetTest, TransferredSetsRespectsDatabaseFeedback)
     params.execute_batch(23);
     EXPECT_EQ(params.transferred_sets(), 46);
 }
+
+
+namespace {
+
+    turbodbc::configuration make_retry_config(std::size_t buffered_sets, std::size_t retries)
+    {
+        auto configuration = make_config(buffered_sets, prefer_string, query_db_for_types);
+        configuration.options.autocommit = true;
+        configuration.options.parameter_set_retries = retries;
+        return configuration;
+    }
+
+    // Fails the sets with the given indices a given number of times. Like a
+    // driver which stops at the first error, it may leave later sets unprocessed.
+    struct row_failing_statement : public turbodbc_test::default_mock_statement {
+        row_failing_statement() :
+                input(0),
+                processed_ptr(nullptr),
+                status_ptr(nullptr),
+                executions(0),
+                fail_as_a_whole(false),
+                stop_at_first_error(false),
+                sqlstate("23000"),
+                native_error_code(2627)
+        {}
+
+        void do_set_attribute(SQLINTEGER attribute, intptr_t value) const final
+        {
+            if (attribute == SQL_ATTR_PARAMSET_SIZE) {
+                input = value;
+            }
+        }
+
+        void do_set_attribute(SQLINTEGER attribute, SQLULEN * pointer) const final
+        {
+            if (attribute == SQL_ATTR_PARAMS_PROCESSED_PTR) {
+                processed_ptr = pointer;
+            }
+        }
+
+        void do_set_attribute(SQLINTEGER attribute, SQLUSMALLINT * pointer) const final
+        {
+            if (attribute == SQL_ATTR_PARAM_STATUS_PTR) {
+                status_ptr = pointer;
+            }
+        }
+
+        void do_execute_prepared() const final
+        {
+            ++executions;
+            failed_rows.clear();
+            std::size_t processed = 0;
+            for (std::size_t i = 0; i != input; ++i) {
+                if (stop_at_first_error and not failed_rows.empty()) {
+                    continue;
+                }
+                ++processed;
+                if (failures[i] != 0) {
+                    --failures[i];
+                    status_ptr[i] = SQL_PARAM_ERROR;
+                    failed_rows.push_back(i);
+                } else {
+                    status_ptr[i] = SQL_PARAM_SUCCESS;
+                }
+            }
+            *processed_ptr = processed;
+            if (fail_as_a_whole and not failed_rows.empty()) {
+                throw cpp_odbc::error("batch failed");
+            }
+        }
+
+        std::vector<cpp_odbc::level2::row_diagnostic_record> do_get_row_diagnostic_records() const final
+        {
+            std::vector<cpp_odbc::level2::row_diagnostic_record> records;
+            for (auto const i : failed_rows) {
+                auto const message = "error in set " + std::to_string(i) + " of execution " + std::to_string(executions);
+                records.push_back({static_cast<SQLLEN>(i + 1), {sqlstate, native_error_code, message}});
+            }
+            return records;
+        }
+
+        // Report errors which roll back the transaction
+        void fail_with_deadlocks()
+        {
+            fail_as_a_whole = true;
+            stop_at_first_error = true;
+            sqlstate = "40001";
+            native_error_code = 1205;
+        }
+
+        mutable std::size_t input;
+        mutable SQLULEN * processed_ptr;
+        mutable SQLUSMALLINT * status_ptr;
+        mutable std::map<std::size_t, std::size_t> failures;
+        mutable std::vector<std::size_t> failed_rows;
+        mutable std::size_t executions;
+        bool fail_as_a_whole;
+        bool stop_at_first_error;
+        std::string sqlstate;
+        int native_error_code;
+    };
+
+}
+
+
+TEST(BoundParameterSetTest, ConstructorBindsStatusArray)
+{
+    testing::NiceMock<row_failing_statement> statement;
+    configure_single_param(statement);
+
+    bound_parameter_set params(statement, make_config(42, prefer_string, query_db_for_types));
+    EXPECT_NE(statement.status_ptr, nullptr);
+}
+
+
+TEST(BoundParameterSetTest, FailedSetsReportsRowsWithDiagnostics)
+{
+    testing::NiceMock<row_failing_statement> statement;
+    configure_single_param(statement);
+
+    bound_parameter_set params(statement, make_config(42, prefer_string, query_db_for_types));
+
+    statement.failures = {{3, 1}, {7, 1}};
+    params.execute_batch(10);
+    statement.failures = {{1, 1}};
+    params.execute_batch(5);
+
+    EXPECT_EQ(params.transferred_sets(), 12);
+    auto const & failed = params.failed_sets();
+    ASSERT_EQ(failed.size(), 3);
+    EXPECT_EQ(failed[0].index, 3);
+    EXPECT_TRUE(failed[0].processed);
+    EXPECT_EQ(failed[0].diagnostic.odbc_status_code, "23000");
+    EXPECT_EQ(failed[0].diagnostic.message, "error in set 3 of execution 1");
+    EXPECT_EQ(failed[1].index, 7);
+    EXPECT_EQ(failed[2].index, 11);
+    EXPECT_EQ(failed[2].diagnostic.message, "error in set 1 of execution 2");
+}
+
+
+TEST(BoundParameterSetTest, FailedBatchDoesNotCountSetsAsTransferred)
+{
+    testing::NiceMock<row_failing_statement> statement;
+    configure_single_param(statement);
+    statement.fail_as_a_whole = true;
+    statement.stop_at_first_error = true;
+
+    bound_parameter_set params(statement, make_config(42, prefer_string, query_db_for_types));
+
+    statement.failures = {{2, 1}};
+    EXPECT_THROW(params.execute_batch(5), cpp_odbc::error);
+
+    // the database may have rolled back the sets it reported as successful
+    EXPECT_EQ(params.transferred_sets(), 0);
+    auto const & failed = params.failed_sets();
+    ASSERT_EQ(failed.size(), 5);
+    EXPECT_EQ(failed[0].index, 0);
+    EXPECT_FALSE(failed[0].processed);
+    EXPECT_EQ(failed[0].diagnostic.message, "");
+    EXPECT_EQ(failed[2].index, 2);
+    EXPECT_TRUE(failed[2].processed);
+    EXPECT_EQ(failed[2].diagnostic.message, "error in set 2 of execution 1");
+    EXPECT_EQ(failed[3].index, 3);
+    EXPECT_FALSE(failed[3].processed);
+}
+
+
+TEST(BoundParameterSetTest, RetriesResubmitRolledBackBatchAsAWhole)
+{
+    testing::NiceMock<row_failing_statement> statement;
+    configure_single_param(statement);
+    statement.fail_with_deadlocks();
+
+    bound_parameter_set params(statement, make_retry_config(42, 2));
+
+    statement.failures = {{2, 1}, {6, 1}};
+    params.execute_batch(10);
+
+    EXPECT_EQ(statement.executions, 3);
+    EXPECT_EQ(params.transferred_sets(), 10);
+    EXPECT_TRUE(params.failed_sets().empty());
+}
+
+
+TEST(BoundParameterSetTest, RetriesGiveUpAfterConfiguredAttempts)
+{
+    testing::NiceMock<row_failing_statement> statement;
+    configure_single_param(statement);
+    statement.fail_with_deadlocks();
+
+    bound_parameter_set params(statement, make_retry_config(42, 1));
+
+    statement.failures = {{4, 5}};
+    EXPECT_THROW(params.execute_batch(10), cpp_odbc::error);
+
+    EXPECT_EQ(statement.executions, 2);
+    // sets 0 to 3 succeeded before the transaction was rolled back
+    EXPECT_EQ(params.transferred_sets(), 0);
+    auto const & failed = params.failed_sets();
+    ASSERT_EQ(failed.size(), 10);
+    EXPECT_FALSE(failed[0].processed);
+    EXPECT_TRUE(failed[4].processed);
+    EXPECT_EQ(failed[4].diagnostic.native_error_code, 1205);
+    EXPECT_EQ(failed[4].diagnostic.message, "error in set 4 of execution 2");
+}
+
+
+TEST(BoundParameterSetTest, RetriesSkipErrorsWhichCannotSucceed)
+{
+    testing::NiceMock<row_failing_statement> statement;
+    configure_single_param(statement);
+    statement.fail_as_a_whole = true;
+
+    bound_parameter_set params(statement, make_retry_config(42, 3));
+
+    statement.failures = {{4, 1}};
+    EXPECT_THROW(params.execute_batch(10), cpp_odbc::error);
+    EXPECT_EQ(statement.executions, 1);
+    EXPECT_EQ(params.failed_sets().size(), 10);
+
+    // rejected sets of a batch which succeeded otherwise are not resubmitted either
+    statement.fail_with_deadlocks();
+    statement.fail_as_a_whole = false;
+    statement.stop_at_first_error = false;
+    statement.failures = {{4, 1}};
+    params.execute_batch(10);
+    EXPECT_EQ(statement.executions, 2);
+    EXPECT_EQ(params.transferred_sets(), 9);
+}
+
+
+TEST(BoundParameterSetTest, RetriesRequireAutocommit)
+{
+    testing::NiceMock<row_failing_statement> statement;
+    configure_single_param(statement);
+    statement.fail_with_deadlocks();
+
+    // earlier batches of the transaction were rolled back as well
+    auto configuration = make_retry_config(42, 3);
+    configuration.options.autocommit = false;
+    bound_parameter_set params(statement, configuration);
+
+    statement.failures = {{4, 1}};
+    EXPECT_THROW(params.execute_batch(10), cpp_odbc::error);
+    EXPECT_EQ(statement.executions, 1);
+}
+
+
+TEST(BoundParameterSetTest, TableValuedParameterDescriptionFallsBackToDefault)
+{
+    cpp_odbc::column_description const table_description = {"dummy", turbodbc::sql_ss_table, 0, 0, true};
+    mock_statement statement;
+    ON_CALL(statement, do_number_of_parameters()).WillByDefault(testing::Return(1));
+    ON_CALL(statement, do_describe_parameter(1))
+        .WillByDefault(testing::Return(table_description));
+
+    bound_parameter_set params(statement, make_config(42, prefer_string, query_db_for_types));
+
+    std::vector<type_code> const expected = {type_code::string};
+    EXPECT_EQ(params.get_initial_parameter_types(), expected);
+}
+
+
+TEST(BoundParameterSetTest, TableValuedParameterRequiresSingleParameter)
+{
+    mock_statement statement;
+    ON_CALL(statement, do_number_of_parameters()).WillByDefault(testing::Return(2));
+
+    EXPECT_THROW(bound_parameter_set(statement, make_config(42, prefer_string, query_db_for_types), u"dbo.row_type", 2),
+                 turbodbc::interface_error);
+}
+
+
+TEST(BoundParameterSetTest, TableValuedParameterBindsColumnsOnExecute)
+{
+    mock_statement statement;
+    configure_single_param(statement);
+
+    EXPECT_CALL(statement, do_bind_input_parameter(testing::_, testing::_, testing::_, testing::_, testing::_)).Times(0);
+    EXPECT_CALL(statement, do_describe_parameter(testing::_)).Times(0);
+    bound_parameter_set params(statement, make_config(42, prefer_unicode, query_db_for_types), u"dbo.row_type", 2);
+    ASSERT_EQ(params.number_of_parameters(), 2);
+    std::vector<type_code> const expected = {type_code::unicode, type_code::unicode};
+    EXPECT_EQ(params.get_initial_parameter_types(), expected);
+    params.rebind(1, make_description(type_code::timestamp, 0));
+    testing::Mock::VerifyAndClearExpectations(&statement);
+
+    SQLLEN * row_count = nullptr;
+    testing::InSequence ordered;
+    EXPECT_CALL(statement, do_bind_table_input_parameter(1, std::u16string(u"dbo.row_type"), 42, testing::_))
+        .WillOnce(testing::SaveArg<3>(&row_count));
+    EXPECT_CALL(statement, do_set_attribute(turbodbc::sql_sopt_ss_param_focus, 1));
+    EXPECT_CALL(statement, do_bind_input_parameter(1, SQL_C_WCHAR, SQL_WVARCHAR, 0, testing::Ref(params.get_parameters()[0]->get_buffer())));
+    EXPECT_CALL(statement, do_bind_input_parameter(2, SQL_C_TYPE_TIMESTAMP, SQL_TYPE_TIMESTAMP, 6, testing::Ref(params.get_parameters()[1]->get_buffer())));
+    EXPECT_CALL(statement, do_set_attribute(turbodbc::sql_sopt_ss_param_focus, testing::TypedEq<intptr_t>(0)));
+    EXPECT_CALL(statement, do_set_attribute(SQL_ATTR_PARAMS_PROCESSED_PTR, testing::An<SQLULEN *>()));
+    EXPECT_CALL(statement, do_set_attribute(SQL_ATTR_PARAM_STATUS_PTR, testing::TypedEq<SQLUSMALLINT *>(nullptr)));
+    EXPECT_CALL(statement, do_set_attribute(SQL_ATTR_PARAMSET_SIZE, 1));
+    EXPECT_CALL(statement, do_execute_prepared());
+
+    params.execute_batch(23);
+    ASSERT_NE(row_count, nullptr);
+    EXPECT_EQ(*row_count, 23);
+}
+
+
+TEST(BoundParameterSetTest, TableValuedParameterTransferredSetsCountsRows)
+{
+    testing::NiceMock<fake_statement> statement;
+    configure_single_param(statement);
+
+    bound_parameter_set params(statement, make_config(42, prefer_string, query_db_for_types), u"dbo.row_type", 1);
+
+    params.execute_batch(17);
+    EXPECT_EQ(params.transferred_sets(), 17);
+    params.execute_batch(29);
+    EXPECT_EQ(params.transferred_sets(), 46);
+
+    statement.process_parameters = false;
+    params.execute_batch(23);
+    EXPECT_EQ(params.transferred_sets(), 46);
+}
+
+
+namespace {
+
+    turbodbc::configuration make_adaptive_config(std::size_t buffered_sets,
+                                                 std::size_t megabytes,
+                                                 std::size_t milliseconds)
+    {
+        auto configuration = make_config(buffered_sets, prefer_string, query_db_for_types);
+        configuration.options.adaptive_parameter_sets = true;
+        configuration.options.parameter_buffer_megabytes = megabytes;
+        configuration.options.parameter_batch_milliseconds = milliseconds;
+        return configuration;
+    }
+
+    struct slow_statement : public turbodbc_test::default_mock_statement {
+        void do_execute_prepared() const final
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+    };
+
+}
+
+
+TEST(BoundParameterSetTest, AdaptiveModeGrowsBuffersAfterFastBatch)
+{
+    mock_statement statement;
+    configure_single_param(statement);
+
+    bound_parameter_set params(statement, make_adaptive_config(10, 64, 1000));
+    auto & buffer = params.get_parameters()[0]->get_buffer();
+    buffer[9].indicator = 42;
+
+    EXPECT_CALL(statement, do_bind_input_parameter(1, SQL_C_SBIGINT, SQL_BIGINT, 0, testing::Ref(buffer)));
+    params.execute_batch(10);
+
+    EXPECT_EQ(params.buffered_sets(), 20);
+    EXPECT_EQ(buffer.number_of_elements(), 20);
+    EXPECT_EQ(buffer[9].indicator, 42);
+}
+
+
+TEST(BoundParameterSetTest, AdaptiveModeIgnoresPartialBatches)
+{
+    mock_statement statement;
+    configure_single_param(statement);
+
+    bound_parameter_set params(statement, make_adaptive_config(10, 64, 1000));
+    params.execute_batch(9);
+
+    EXPECT_EQ(params.buffered_sets(), 10);
+}
+
+
+TEST(BoundParameterSetTest, AdaptiveModeShrinksBatchesExceedingLatencyTarget)
+{
+    testing::NiceMock<slow_statement> statement;
+    configure_single_param(statement);
+
+    bound_parameter_set params(statement, make_adaptive_config(10, 64, 1));
+    params.execute_batch(10);
+
+    EXPECT_EQ(params.buffered_sets(), 5);
+    // buffers keep their size
+    EXPECT_EQ(params.get_parameters()[0]->get_buffer().number_of_elements(), 10);
+}
+
+
+TEST(BoundParameterSetTest, AdaptiveModeRespectsMemoryBudget)
+{
+    mock_statement statement;
+    configure_single_param(statement);
+
+    // 64 bit integers and indicators take 16 bytes per set
+    bound_parameter_set params(statement, make_adaptive_config(100000, 1, 1000));
+    params.execute_batch(100000);
+
+    EXPECT_EQ(params.buffered_sets(), 1024 * 1024 / 16);
+}
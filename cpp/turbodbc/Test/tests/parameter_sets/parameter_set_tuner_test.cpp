@@ -0,0 +1,158 @@
+#include "turbodbc/parameter_sets/parameter_set_tuner.h"
+
+#include <gtest/gtest.h>
+
+#include <functional>
+
+
+using turbodbc::parameter_set_tuner;
+
+namespace {
+
+    std::size_t const unlimited = 1000000000;
+
+    // Simulated batch latency: a fixed round trip plus costs per set. The
+    // quadratic term models server-side contention of long batches.
+    std::chrono::nanoseconds simulated_latency(std::size_t sets)
+    {
+        double const round_trip_ms = 5.0;
+        double const per_set_ms = 0.01;
+        double const contention_ms = 0.000001;
+        double const milliseconds = round_trip_ms + per_set_ms * sets + contention_ms * sets * sets;
+        return std::chrono::nanoseconds(static_cast<std::int64_t>(milliseconds * 1000000));
+    }
+
+    double throughput(std::size_t sets)
+    {
+        return sets / std::chrono::duration<double>(simulated_latency(sets)).count();
+    }
+
+    void run_batches(parameter_set_tuner & tuner, std::size_t batches, std::size_t maximum_sets,
+                     std::function<std::chrono::nanoseconds(std::size_t)> const & latency)
+    {
+        for (std::size_t i = 0; i != batches; ++i) {
+            auto const sets = tuner.recommended_sets();
+            tuner.record(sets, latency(sets), maximum_sets);
+        }
+    }
+
+}
+
+
+TEST(ParameterSetTunerTest, StartsWithInitialSets)
+{
+    parameter_set_tuner tuner(100, std::chrono::milliseconds(1000));
+    EXPECT_EQ(tuner.recommended_sets(), 100);
+    EXPECT_FALSE(tuner.is_settled());
+}
+
+
+TEST(ParameterSetTunerTest, InitialSetsAreAtLeastOne)
+{
+    parameter_set_tuner tuner(0, std::chrono::milliseconds(1000));
+    EXPECT_EQ(tuner.recommended_sets(), 1);
+}
+
+
+TEST(ParameterSetTunerTest, ConvergesNearOptimumOfSimulatedLatency)
+{
+    // throughput peaks at sqrt(round_trip / contention), about 2236 sets
+    parameter_set_tuner tuner(100, std::chrono::milliseconds(1000));
+    run_batches(tuner, 20, unlimited, simulated_latency);
+
+    EXPECT_TRUE(tuner.is_settled());
+    EXPECT_EQ(tuner.recommended_sets(), 1600);
+    EXPECT_GT(throughput(tuner.recommended_sets()), 0.95 * throughput(2236));
+    EXPECT_DOUBLE_EQ(tuner.best_throughput(), throughput(1600));
+}
+
+
+TEST(ParameterSetTunerTest, GrowthRespectsMaximumSets)
+{
+    parameter_set_tuner tuner(100, std::chrono::milliseconds(1000));
+    run_batches(tuner, 20, 500, simulated_latency);
+
+    EXPECT_TRUE(tuner.is_settled());
+    EXPECT_EQ(tuner.recommended_sets(), 400);
+}
+
+
+TEST(ParameterSetTunerTest, ShrinksToMaximumSets)
+{
+    parameter_set_tuner tuner(1000, std::chrono::milliseconds(1000));
+    tuner.record(1000, std::chrono::milliseconds(1), 300);
+    EXPECT_EQ(tuner.recommended_sets(), 300);
+}
+
+
+TEST(ParameterSetTunerTest, GrowthStopsBeforeLatencyTarget)
+{
+    // 800 sets take about 14 ms, twice as many would exceed the target
+    parameter_set_tuner tuner(100, std::chrono::milliseconds(25));
+    run_batches(tuner, 20, unlimited, simulated_latency);
+
+    EXPECT_TRUE(tuner.is_settled());
+    EXPECT_EQ(tuner.recommended_sets(), 800);
+    EXPECT_LE(simulated_latency(tuner.recommended_sets()), std::chrono::milliseconds(25));
+}
+
+
+TEST(ParameterSetTunerTest, ShrinksWhenLatencyExceedsTarget)
+{
+    parameter_set_tuner tuner(1000, std::chrono::milliseconds(10));
+    auto const slow = [](std::size_t sets) { return std::chrono::nanoseconds(sets * 100000); };
+
+    tuner.record(1000, slow(1000), unlimited);
+    EXPECT_EQ(tuner.recommended_sets(), 500);
+    EXPECT_TRUE(tuner.is_settled());
+
+    run_batches(tuner, 5, unlimited, slow);
+    EXPECT_EQ(tuner.recommended_sets(), 62);
+    EXPECT_LE(slow(tuner.recommended_sets()), std::chrono::milliseconds(10));
+}
+
+
+TEST(ParameterSetTunerTest, IgnoresPartialBatches)
+{
+    parameter_set_tuner tuner(100, std::chrono::milliseconds(1000));
+    tuner.record(10, std::chrono::seconds(5), unlimited);
+    EXPECT_EQ(tuner.recommended_sets(), 100);
+    EXPECT_FALSE(tuner.is_settled());
+}
+
+
+TEST(ParameterSetTunerTest, GrowsAgainAfterSlowBatch)
+{
+    parameter_set_tuner tuner(100, std::chrono::milliseconds(1000));
+    run_batches(tuner, 20, unlimited, simulated_latency);
+    ASSERT_EQ(tuner.recommended_sets(), 1600);
+
+    // a single hiccup of the database halves the batches
+    tuner.record(1600, std::chrono::seconds(2), unlimited);
+    EXPECT_EQ(tuner.recommended_sets(), 800);
+
+    run_batches(tuner, 15, unlimited, simulated_latency);
+    EXPECT_EQ(tuner.recommended_sets(), 800);
+    EXPECT_TRUE(tuner.is_settled());
+
+    run_batches(tuner, 1, unlimited, simulated_latency);
+    EXPECT_EQ(tuner.recommended_sets(), 1600);
+    EXPECT_FALSE(tuner.is_settled());
+
+    run_batches(tuner, 3, unlimited, simulated_latency);
+    EXPECT_EQ(tuner.recommended_sets(), 1600);
+    EXPECT_TRUE(tuner.is_settled());
+}
+
+
+TEST(ParameterSetTunerTest, StaysSettledWithoutHeadroom)
+{
+    // 800 sets take about 14 ms, twice as many would exceed the target
+    parameter_set_tuner tuner(100, std::chrono::milliseconds(25));
+    run_batches(tuner, 100, unlimited, simulated_latency);
+    EXPECT_EQ(tuner.recommended_sets(), 800);
+
+    parameter_set_tuner limited_tuner(100, std::chrono::milliseconds(1000));
+    run_batches(limited_tuner, 100, 500, simulated_latency);
+    EXPECT_EQ(limited_tuner.recommended_sets(), 400);
+}
@@ -3,10 +3,12 @@
 #include <gtest/gtest.h>
 #include "mock_classes.h"
 
+#include <turbodbc/descriptions/decimal_description.h>
 #include <turbodbc/descriptions/integer_description.h>
 #include <turbodbc/descriptions/string_description.h>
 #include <turbodbc/descriptions/unicode_description.h>
 #include <boost/variant/get.hpp>
+#include <sqlext.h>
 
 namespace {
 
@@ -27,6 +29,30 @@ TEST(ParameterTest, GetTypeCode)
 }
 
 
+TEST(ParameterTest, DecimalUsesNumericBinding)
+{
+	std::unique_ptr<turbodbc::decimal_description> description(new turbodbc::decimal_description(20, 4));
+
+	turbodbc_test::mock_statement statement;
+	EXPECT_CALL(statement, do_bind_numeric_input_parameter(parameter_index, SQL_DECIMAL, 20, 4, testing::_)).Times(1);
+	EXPECT_CALL(statement, do_bind_input_parameter(testing::_, testing::_, testing::_, testing::_, testing::_)).Times(0);
+
+	turbodbc::parameter parameter(statement, parameter_index, 100, std::move(description));
+}
+
+TEST(ParameterTest, BindLater)
+{
+	std::unique_ptr<turbodbc::string_description> description(new turbodbc::string_description(10));
+
+	turbodbc_test::mock_statement statement;
+	EXPECT_CALL(statement, do_bind_input_parameter(testing::_, testing::_, testing::_, testing::_, testing::_)).Times(0);
+	turbodbc::parameter parameter(100, std::move(description));
+	testing::Mock::VerifyAndClearExpectations(&statement);
+
+	EXPECT_CALL(statement, do_bind_input_parameter(parameter_index, SQL_C_CHAR, SQL_VARCHAR, 0, testing::Ref(parameter.get_buffer()))).Times(1);
+	parameter.bind(statement, parameter_index);
+}
+
 TEST(ParameterTest, GetBuffer)
 {
 	std::unique_ptr<turbodbc::string_description> description(new turbodbc::string_description(10));
@@ -161,6 +161,25 @@ TEST(BoundResultSetTest, GetBuffers)
 }
 
 
+TEST(BoundResultSetTest, BindExternalData)
+{
+    std::vector<SQLSMALLINT> const sql_column_types = {SQL_INTEGER, SQL_VARCHAR};
+    std::size_t const buffered_rows = 1234;
+
+    auto statement = prepare_mock_with_columns(sql_column_types, prefer_string);
+    bound_result_set rs(statement, make_options(turbodbc::rows(buffered_rows), prefer_string));
+    std::vector<int64_t> external(buffered_rows);
+
+    EXPECT_CALL(*statement, do_bind_column(1, SQL_C_SBIGINT, testing::_));
+    EXPECT_TRUE(rs.bind_external_data(0, reinterpret_cast<char *>(external.data())));
+    EXPECT_EQ(reinterpret_cast<char *>(external.data()), rs.get_buffers()[0].get().data_pointer());
+
+    EXPECT_CALL(*statement, do_bind_column(1, SQL_C_SBIGINT, testing::_));
+    EXPECT_TRUE(rs.bind_external_data(0, nullptr));
+    EXPECT_NE(reinterpret_cast<char *>(external.data()), rs.get_buffers()[0].get().data_pointer());
+}
+
+
 TEST(BoundResultSetTest, Rebind)
 {
     std::vector<SQLSMALLINT> const sql_column_types = {SQL_INTEGER, SQL_VARCHAR};
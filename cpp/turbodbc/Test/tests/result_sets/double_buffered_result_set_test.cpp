@@ -1,13 +1,16 @@
 #include <turbodbc/result_sets/double_buffered_result_set.h>
 
 #include <tests/mock_classes.h>
+#include <turbodbc/errors.h>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
 #include <type_traits>
 #include <algorithm>
+#include <atomic>
 #include <memory>
+#include <thread>
 
 #include <sqlext.h>
 
@@ -18,10 +21,11 @@ using turbodbc_test::mock_statement;
 
 namespace {
 
-    turbodbc::options make_options(turbodbc::buffer_size const & size, bool prefer_unicode) {
+    turbodbc::options make_options(turbodbc::buffer_size const & size, bool prefer_unicode, std::size_t slots = 2) {
         turbodbc::options options;
         options.read_buffer_size = size;
         options.prefer_unicode = prefer_unicode;
+        options.prefetch_slots = slots;
         return options;
     }
 
@@ -84,6 +88,27 @@ TEST(DoubleBufferedResultSetTest, BindsArraySizeFixedMegabytesInContructor)
 }
 
 
+TEST(DoubleBufferedResultSetTest, BindsArraySizeSplitAcrossSlots)
+{
+    auto statement = prepare_mock_with_columns({SQL_INTEGER});
+    EXPECT_CALL(*statement, do_set_attribute(SQL_ATTR_ROW_ARRAY_SIZE, 250))
+        .Times(testing::AtLeast(4));
+
+    double_buffered_result_set rs(statement, make_options(turbodbc::rows(1000), prefer_string, 4));
+    EXPECT_EQ(4, rs.get_prefetch_statistics().slots);
+}
+
+
+TEST(DoubleBufferedResultSetTest, UsesAtLeastTwoSlots)
+{
+    auto statement = prepare_mock_with_columns({SQL_INTEGER});
+    EXPECT_CALL(*statement, do_set_attribute(SQL_ATTR_ROW_ARRAY_SIZE, 500))
+        .Times(testing::AtLeast(2));
+
+    double_buffered_result_set rs(statement, make_options(turbodbc::rows(1000), prefer_string, 1));
+    EXPECT_EQ(2, rs.get_prefetch_statistics().slots);
+}
+
 
 TEST(DoubleBufferedResultSetTest, GetColumnInfo)
 {
@@ -109,7 +134,8 @@ namespace {
             rows_fetched_pointer_(nullptr),
             buffer_(nullptr),
             batch_sizes_(std::move(batch_sizes)),
-            batch_index_(0)
+            batch_index_(0),
+            fetches_(0)
         {}
 
         short int do_number_of_columns() const final
@@ -136,6 +162,7 @@ namespace {
 
         bool do_fetch_next() const final
         {
+            ++fetches_;
             if (batch_index_ < batch_sizes_.size()) {
                 *rows_fetched_pointer_ = batch_sizes_[batch_index_];
                 for (std::size_t i = 0; i != batch_sizes_[batch_index_]; ++i) {
@@ -150,13 +177,33 @@ namespace {
             return (*rows_fetched_pointer_ != 0);
         };
 
+        std::size_t fetches() const
+        {
+            return fetches_;
+        }
+
     private:
         mutable SQLULEN * rows_fetched_pointer_;
         mutable cpp_odbc::multi_value_buffer * buffer_;
         std::vector<size_t> batch_sizes_;
         mutable std::size_t batch_index_;
+        mutable std::atomic<std::size_t> fetches_;
     };
 
+    int64_t first_value(double_buffered_result_set const & rs)
+    {
+        return *reinterpret_cast<int64_t const *>(rs.get_buffers()[0].get()[0].data_pointer);
+    }
+
+    void wait_for_fetches(statement_with_fake_int_result_set const & statement, std::size_t fetches)
+    {
+        while (statement.fetches() < fetches) {
+            std::this_thread::yield();
+        }
+        // give the reader time to hand over the last fetched batch
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+
 }
 
 
@@ -197,6 +244,66 @@ TEST(DoubleBufferedResultSetTest, GetBuffers)
 }
 
 
+TEST(DoubleBufferedResultSetTest, FetchesAheadUntilRingIsFull)
+{
+    std::vector<size_t> batch_sizes = {4, 4, 4, 4, 2};
+    auto statement = std::make_shared<testing::NiceMock<statement_with_fake_int_result_set>>(batch_sizes);
+
+    double_buffered_result_set rs(statement, make_options(turbodbc::rows(16), prefer_string, 4));
+    wait_for_fetches(*statement, 3);
+    EXPECT_EQ(3, statement->fetches());
+
+    ASSERT_EQ(4, rs.fetch_next_batch());
+    EXPECT_EQ(1, first_value(rs));
+    for (int64_t batch = 2; batch != 5; ++batch) {
+        ASSERT_EQ(4, rs.fetch_next_batch());
+        EXPECT_EQ(batch, first_value(rs));
+    }
+    ASSERT_EQ(2, rs.fetch_next_batch());
+    EXPECT_EQ(5, first_value(rs));
+    ASSERT_EQ(0, rs.fetch_next_batch());
+
+    auto const statistics = rs.get_prefetch_statistics();
+    EXPECT_EQ(6, statistics.requested_batches);
+    EXPECT_LE(1, statistics.requests_finding_ring_full);
+    EXPECT_LE(3, statistics.fetched_ahead);
+    EXPECT_LE(statistics.requests_finding_ring_full + statistics.requests_finding_ring_empty,
+              statistics.requested_batches);
+}
+
+
+TEST(DoubleBufferedResultSetTest, StopsFetchingWhenResultSetIsExhausted)
+{
+    std::vector<size_t> batch_sizes = {4};
+    auto statement = std::make_shared<testing::NiceMock<statement_with_fake_int_result_set>>(batch_sizes);
+
+    double_buffered_result_set rs(statement, make_options(turbodbc::rows(16), prefer_string, 4));
+    wait_for_fetches(*statement, 2);
+
+    ASSERT_EQ(4, rs.fetch_next_batch());
+    ASSERT_EQ(0, rs.fetch_next_batch());
+    ASSERT_EQ(0, rs.fetch_next_batch());
+    ASSERT_EQ(0, rs.fetch_next_batch());
+    EXPECT_EQ(2, statement->fetches());
+}
+
+
+TEST(DoubleBufferedResultSetTest, CloseStopsFetchingAhead)
+{
+    std::vector<size_t> batch_sizes = {4, 4, 4, 4};
+    auto statement = std::make_shared<testing::NiceMock<statement_with_fake_int_result_set>>(batch_sizes);
+
+    double_buffered_result_set rs(statement, make_options(turbodbc::rows(16), prefer_string, 4));
+    wait_for_fetches(*statement, 3);
+
+    ASSERT_EQ(4, rs.fetch_next_batch());
+    rs.close();
+    auto const fetches = statement->fetches();
+    EXPECT_THROW(rs.fetch_next_batch(), turbodbc::interface_error);
+    EXPECT_EQ(fetches, statement->fetches());
+}
+
+
 namespace {
     /**
      * This class is a fake statement which implements functions relevant for
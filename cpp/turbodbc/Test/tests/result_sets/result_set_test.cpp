@@ -1,4 +1,5 @@
 #include <turbodbc/result_sets/result_set.h>
+#include <turbodbc/errors.h>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
@@ -40,3 +41,33 @@ TEST(BaseResultSetTest, GetColumnsForwards)
     EXPECT_CALL(rs, do_get_buffers()).WillOnce(testing::Return(expected));
     EXPECT_EQ(expected[0].get().data_pointer(), rs.get_buffers()[0].get().data_pointer());
 }
+
+// other tests define mock_result_set as well, so the additional mocks need a distinct name
+struct closable_mock_result_set : public mock_result_set
+{
+    MOCK_METHOD2(do_bind_external_data, bool(std::size_t, char *));
+    MOCK_METHOD0(do_close, void());
+};
+
+TEST(BaseResultSetTest, CloseForwardsOnce)
+{
+    closable_mock_result_set rs;
+    EXPECT_CALL(rs, do_close()).Times(1);
+    rs.close();
+    rs.close();
+}
+
+TEST(BaseResultSetTest, ClosedResultSetDoesNotUseStatement)
+{
+    closable_mock_result_set rs;
+    cpp_odbc::multi_value_buffer buffer(10, 10);
+    std::vector<std::reference_wrapper<cpp_odbc::multi_value_buffer const>> expected = {buffer};
+    EXPECT_CALL(rs, do_fetch_next_batch()).Times(0);
+    EXPECT_CALL(rs, do_bind_external_data(testing::_, testing::_)).Times(0);
+    EXPECT_CALL(rs, do_get_buffers()).WillOnce(testing::Return(expected));
+
+    rs.close();
+    EXPECT_THROW(rs.fetch_next_batch(), turbodbc::interface_error);
+    EXPECT_THROW(rs.bind_external_data(0, nullptr), turbodbc::interface_error);
+    EXPECT_EQ(expected[0].get().data_pointer(), rs.get_buffers()[0].get().data_pointer());
+}
@@ -9,6 +9,27 @@
 
 
 using turbodbc::buffered_string_size;
+using turbodbc::utf16_to_utf8;
+using turbodbc::utf8_to_utf16;
+using turbodbc::utf8_to_utf16_length;
+
+namespace {
+
+    std::string transcode(std::u16string const & input)
+    {
+        std::string output(3 * input.size(), '\0');
+        output.resize(utf16_to_utf8(input.data(), input.size(), &output[0]));
+        return output;
+    }
+
+    std::u16string transcode(std::string const & input)
+    {
+        std::u16string output(utf8_to_utf16_length(input.data(), input.size()), u'\0');
+        EXPECT_EQ(output.size(), utf8_to_utf16(input.data(), input.size(), &output[0]));
+        return output;
+    }
+
+}
 
 TEST(StringHelpersTest, BufferedStringSizeForSmallerString)
 {
@@ -39,4 +60,77 @@ TEST(StringHelpersTest, BufferedStringSizeForSQLNoTotal)
     std::intptr_t const reported_string_size = SQL_NO_TOTAL;
     std::size_t const maximum_string_size = 42;
     EXPECT_EQ(42, buffered_string_size(reported_string_size, maximum_string_size));
-}
\ No newline at end of file
+}
+
+TEST(StringHelpersTest, Utf16ToUtf8ForAscii)
+{
+    EXPECT_EQ("", transcode(u""));
+    EXPECT_EQ("hi", transcode(u"hi"));
+    // long enough for several blocks of the fast path plus a tail
+    EXPECT_EQ("The quick brown fox jumps over the lazy dog", transcode(u"The quick brown fox jumps over the lazy dog"));
+}
+
+
+TEST(StringHelpersTest, Utf16ToUtf8ForMultiByteCharacters)
+{
+    EXPECT_EQ("\xC3\xA4\xC3\xB6\xC3\xBC \xC3\x9F", transcode(u"\u00e4\u00f6\u00fc \u00df"));
+    EXPECT_EQ("\xE2\x82\xAC and \xE4\xB8\xAD\xE6\x96\x87", transcode(u"\u20ac and \u4e2d\u6587"));
+    EXPECT_EQ("ascii block, then \xC3\xA4 and more ascii afterwards", transcode(u"ascii block, then \u00e4 and more ascii afterwards"));
+}
+
+
+TEST(StringHelpersTest, Utf16ToUtf8ForSurrogatePairs)
+{
+    EXPECT_EQ("\xF0\x9F\x98\x80", transcode(u"\U0001F600"));
+    EXPECT_EQ("1234567\xF0\x9F\x98\x80", transcode(u"1234567\U0001F600"));
+}
+
+
+TEST(StringHelpersTest, Utf16ToUtf8ReplacesUnpairedSurrogates)
+{
+    std::u16string const lone_high = {u'a', static_cast<char16_t>(0xD83D), u'b'};
+    EXPECT_EQ("a\xEF\xBF\xBD" "b", transcode(lone_high));
+
+    std::u16string const lone_low = {static_cast<char16_t>(0xDE00)};
+    EXPECT_EQ("\xEF\xBF\xBD", transcode(lone_low));
+
+    std::u16string const trailing_high = {u'a', static_cast<char16_t>(0xD83D)};
+    EXPECT_EQ("a\xEF\xBF\xBD", transcode(trailing_high));
+}
+
+
+TEST(StringHelpersTest, Utf8ToUtf16ForAscii)
+{
+    EXPECT_EQ(u"", transcode(std::string("")));
+    EXPECT_EQ(u"hi", transcode(std::string("hi")));
+    // long enough for several blocks of the fast path plus a tail
+    EXPECT_EQ(u"The quick brown fox jumps over the lazy dog", transcode(std::string("The quick brown fox jumps over the lazy dog")));
+}
+
+
+TEST(StringHelpersTest, Utf8ToUtf16ForMultiByteCharacters)
+{
+    EXPECT_EQ(u"\u00e4\u00f6\u00fc \u00df", transcode(std::string("\xC3\xA4\xC3\xB6\xC3\xBC \xC3\x9F")));
+    EXPECT_EQ(u"\u20ac and \u4e2d\u6587", transcode(std::string("\xE2\x82\xAC and \xE4\xB8\xAD\xE6\x96\x87")));
+    EXPECT_EQ(u"ascii block, then \u00e4 and more ascii afterwards", transcode(std::string("ascii block, then \xC3\xA4 and more ascii afterwards")));
+}
+
+
+TEST(StringHelpersTest, Utf8ToUtf16ForSupplementaryCharacters)
+{
+    EXPECT_EQ(u"\U0001F600", transcode(std::string("\xF0\x9F\x98\x80")));
+    EXPECT_EQ(u"123456789012345\U0001F600", transcode(std::string("123456789012345\xF0\x9F\x98\x80")));
+}
+
+
+TEST(StringHelpersTest, Utf8ToUtf16ReplacesInvalidSequences)
+{
+    // lone continuation byte
+    EXPECT_EQ(u"a\ufffdb", transcode(std::string("a\x80" "b")));
+    // truncated sequence at the end of the input
+    EXPECT_EQ(u"a\ufffd\ufffd", transcode(std::string("a\xE2\x82")));
+    // overlong encoding of '/'
+    EXPECT_EQ(u"\ufffd\ufffd", transcode(std::string("\xC0\xAF")));
+    // encoded UTF-16 surrogate
+    EXPECT_EQ(u"\ufffd\ufffd\ufffd", transcode(std::string("\xED\xA0\x80")));
+}
@@ -0,0 +1,153 @@
+#include <turbodbc/thread_pool.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+
+using turbodbc::thread_pool;
+
+
+TEST(ThreadPoolTest, Size)
+{
+    thread_pool pool(3);
+    EXPECT_EQ(3, pool.size());
+}
+
+
+TEST(ThreadPoolTest, ParallelForRunsEachTaskOnce)
+{
+    thread_pool pool(4);
+    std::vector<std::atomic<int>> calls(100);
+    for (auto & call : calls) {
+        call = 0;
+    }
+
+    pool.parallel_for(calls.size(), 4, [&](std::size_t i){ ++calls[i]; });
+
+    for (auto const & call : calls) {
+        EXPECT_EQ(1, call);
+    }
+}
+
+
+TEST(ThreadPoolTest, ParallelForWithoutTasks)
+{
+    thread_pool pool(2);
+    bool called = false;
+    pool.parallel_for(0, 2, [&](std::size_t){ called = true; });
+    EXPECT_FALSE(called);
+}
+
+
+TEST(ThreadPoolTest, SingleWorkerUsesCallingThread)
+{
+    thread_pool pool(2);
+    std::set<std::thread::id> threads;
+
+    pool.parallel_for(10, 1, [&](std::size_t){ threads.insert(std::this_thread::get_id()); });
+
+    ASSERT_EQ(1, threads.size());
+    EXPECT_EQ(std::this_thread::get_id(), *threads.begin());
+}
+
+
+TEST(ThreadPoolTest, ParallelForLimitsWorkers)
+{
+    thread_pool pool(4);
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+
+    pool.parallel_for(50, 2, [&](std::size_t){
+        std::lock_guard<std::mutex> lock(mutex);
+        threads.insert(std::this_thread::get_id());
+    });
+
+    EXPECT_LE(threads.size(), 2);
+}
+
+
+TEST(ThreadPoolTest, ParallelForWithoutWorkerThreads)
+{
+    thread_pool pool(0);
+    int calls = 0;
+    pool.parallel_for(5, 8, [&](std::size_t){ ++calls; });
+    EXPECT_EQ(5, calls);
+}
+
+
+TEST(ThreadPoolTest, ParallelForRethrowsFirstException)
+{
+    thread_pool pool(2);
+    EXPECT_THROW(pool.parallel_for(10, 3, [](std::size_t i){
+                     if (i == 5) {
+                         throw std::runtime_error("task failed");
+                     }
+                 }),
+                 std::runtime_error);
+
+    // the pool remains usable
+    std::atomic<int> calls(0);
+    pool.parallel_for(10, 3, [&](std::size_t){ ++calls; });
+    EXPECT_EQ(10, calls);
+}
+
+
+TEST(ThreadPoolTest, ConcurrentCallersDoNotWaitForEachOther)
+{
+    thread_pool pool(1);
+    std::atomic<int> started(0);
+    std::atomic<bool> released(false);
+
+    // occupy the only pool thread with a task of another caller
+    std::thread other_caller([&](){
+        pool.parallel_for(2, 2, [&](std::size_t){
+            ++started;
+            while (not released) {
+                std::this_thread::yield();
+            }
+        });
+    });
+    while (started != 2) {
+        std::this_thread::yield();
+    }
+
+    // the helper of this call stays queued, so the calling thread runs all tasks
+    std::atomic<int> calls(0);
+    pool.parallel_for(5, 2, [&](std::size_t){ ++calls; });
+    EXPECT_EQ(5, calls);
+
+    released = true;
+    other_caller.join();
+}
+
+
+TEST(ThreadPoolTest, NestedParallelFor)
+{
+    thread_pool pool(1);
+    std::atomic<int> started(0);
+    std::atomic<int> calls(0);
+
+    pool.parallel_for(2, 2, [&](std::size_t){
+        // make sure both the calling thread and the pool thread run an outer task
+        ++started;
+        while (started != 2) {
+            std::this_thread::yield();
+        }
+        pool.parallel_for(10, 2, [&](std::size_t){ ++calls; });
+    });
+
+    EXPECT_EQ(20, calls);
+}
+
+
+TEST(ThreadPoolTest, SharedPoolIsSingleton)
+{
+    EXPECT_EQ(&thread_pool::shared(), &thread_pool::shared());
+    EXPECT_GE(thread_pool::shared().size(), 1);
+}
@@ -1,4 +1,6 @@
 #include "turbodbc/time_helpers.h"
+#include "turbodbc/errors.h"
+#include "turbodbc/sql_server_types.h"
 
 #include <gtest/gtest.h>
 
@@ -7,11 +9,31 @@
 #endif
 #include <sql.h>
 
+#include <cstring>
+#include <vector>
+
 using turbodbc::timestamp_to_microseconds;
 using turbodbc::microseconds_to_timestamp;
 using turbodbc::nanoseconds_to_timestamp;
 using turbodbc::date_to_days;
 using turbodbc::days_to_date;
+using turbodbc::timestamps_to_microseconds;
+using turbodbc::dates_to_days;
+using turbodbc::microseconds_to_timestamps;
+using turbodbc::nanoseconds_to_timestamps;
+using turbodbc::days_to_dates;
+using turbodbc::timestamps_to_nanoseconds;
+using turbodbc::timestamp_offsets_to_microseconds;
+using turbodbc::timestamp_offsets_to_nanoseconds;
+using turbodbc::timestamp_offset_to_utc_timestamp;
+using turbodbc::times_to_nanoseconds;
+using turbodbc::seconds_to_timestamps;
+using turbodbc::milliseconds_to_timestamps;
+using turbodbc::milliseconds_to_dates;
+using turbodbc::seconds_to_times;
+using turbodbc::milliseconds_to_times;
+using turbodbc::microseconds_to_times;
+using turbodbc::nanoseconds_to_times;
 
 TEST(TimeHelpersTest, TimestampToMicrosecondsForEpoch)
 {
@@ -126,4 +148,327 @@ TEST(TimeHelpersTest, DaysToDateForYear4000)
     EXPECT_EQ(4000, ts.year);
     EXPECT_EQ(1, ts.month);
     EXPECT_EQ(2, ts.day);
-}
\ No newline at end of file
+}
+
+
+TEST(TimeHelpersTest, DateToDaysBeforeEpochAndOnLeapDays)
+{
+    SQL_DATE_STRUCT before_epoch = {1969, 12, 31};
+    EXPECT_EQ(-1, date_to_days(reinterpret_cast<char const *>(&before_epoch)));
+    SQL_DATE_STRUCT leap_day = {2000, 2, 29};
+    EXPECT_EQ(11016, date_to_days(reinterpret_cast<char const *>(&leap_day)));
+    SQL_DATE_STRUCT first_day = {1, 1, 1};
+    EXPECT_EQ(-719162, date_to_days(reinterpret_cast<char const *>(&first_day)));
+}
+
+
+TEST(TimeHelpersTest, DaysToDateRoundtrip)
+{
+    for (std::int64_t days = -719162; days < 2932897; days += 17) {
+        SQL_DATE_STRUCT date;
+        days_to_date(days, reinterpret_cast<char *>(&date));
+        ASSERT_EQ(days, date_to_days(reinterpret_cast<char const *>(&date)));
+    }
+}
+
+
+TEST(TimeHelpersTest, MicrosecondsToTimestampBeforeEpoch)
+{
+    std::int64_t const microseconds = -1;
+    SQL_TIMESTAMP_STRUCT ts;
+    microseconds_to_timestamp(microseconds, reinterpret_cast<char *>(&ts));
+    EXPECT_EQ(1969, ts.year);
+    EXPECT_EQ(12, ts.month);
+    EXPECT_EQ(31, ts.day);
+    EXPECT_EQ(23, ts.hour);
+    EXPECT_EQ(59, ts.minute);
+    EXPECT_EQ(59, ts.second);
+    EXPECT_EQ(999999000, ts.fraction);
+    EXPECT_EQ(microseconds, timestamp_to_microseconds(reinterpret_cast<char const *>(&ts)));
+}
+
+
+TEST(TimeHelpersTest, NanosecondsToTimestampBeforeEpoch)
+{
+    std::int64_t const nanoseconds = -1;
+    SQL_TIMESTAMP_STRUCT ts;
+    nanoseconds_to_timestamp(nanoseconds, reinterpret_cast<char *>(&ts));
+    EXPECT_EQ(1969, ts.year);
+    EXPECT_EQ(12, ts.month);
+    EXPECT_EQ(31, ts.day);
+    EXPECT_EQ(23, ts.hour);
+    EXPECT_EQ(59, ts.minute);
+    EXPECT_EQ(59, ts.second);
+    EXPECT_EQ(999999999, ts.fraction);
+}
+
+
+TEST(TimeHelpersTest, TimestampsToMicrosecondsBatch)
+{
+    std::vector<SQL_TIMESTAMP_STRUCT> data = {{1970, 1, 1, 0, 0, 0, 0},
+                                              {4000, 1, 2, 3, 4, 5, 123456000},
+                                              {2017, 3, 4, 5, 6, 7, 0}};
+    std::vector<intptr_t> indicators = {sizeof(SQL_TIMESTAMP_STRUCT), sizeof(SQL_TIMESTAMP_STRUCT), SQL_NULL_DATA};
+    std::vector<std::int64_t> microseconds(3, 42);
+
+    timestamps_to_microseconds(reinterpret_cast<char const *>(data.data()), indicators.data(), data.size(), microseconds.data());
+
+    EXPECT_EQ(0, microseconds[0]);
+    EXPECT_EQ(64060686245 * 1000000 + 123456, microseconds[1]);
+    EXPECT_EQ(0, microseconds[2]);
+}
+
+
+TEST(TimeHelpersTest, DatesToDaysBatch)
+{
+    std::vector<SQL_DATE_STRUCT> data = {{1970, 1, 1}, {4000, 1, 2}, {2017, 3, 4}};
+    std::vector<intptr_t> indicators = {sizeof(SQL_DATE_STRUCT), sizeof(SQL_DATE_STRUCT), SQL_NULL_DATA};
+
+    std::vector<std::int64_t> days(3, 42);
+    dates_to_days(reinterpret_cast<char const *>(data.data()), indicators.data(), data.size(), days.data());
+    EXPECT_EQ((std::vector<std::int64_t>{0, 741443, 0}), days);
+
+    std::vector<std::int32_t> days_32(3, 42);
+    dates_to_days(reinterpret_cast<char const *>(data.data()), indicators.data(), data.size(), days_32.data());
+    EXPECT_EQ((std::vector<std::int32_t>{0, 741443, 0}), days_32);
+}
+
+
+TEST(TimeHelpersTest, TimestampBatchesMatchSingleValues)
+{
+    std::vector<std::int64_t> const ticks = {0, -1, 64060686245 * 1000000 + 123456, 7258215845 * 1000000000 + 123456789, -86400000000};
+    std::vector<SQL_TIMESTAMP_STRUCT> batch(ticks.size());
+    SQL_TIMESTAMP_STRUCT single;
+
+    microseconds_to_timestamps(ticks.data(), ticks.size(), reinterpret_cast<char *>(batch.data()));
+    for (std::size_t i = 0; i != ticks.size(); ++i) {
+        microseconds_to_timestamp(ticks[i], reinterpret_cast<char *>(&single));
+        EXPECT_EQ(0, std::memcmp(&single, &batch[i], sizeof(single)));
+    }
+
+    nanoseconds_to_timestamps(ticks.data(), ticks.size(), reinterpret_cast<char *>(batch.data()));
+    for (std::size_t i = 0; i != ticks.size(); ++i) {
+        nanoseconds_to_timestamp(ticks[i], reinterpret_cast<char *>(&single));
+        EXPECT_EQ(0, std::memcmp(&single, &batch[i], sizeof(single)));
+    }
+}
+
+
+TEST(TimeHelpersTest, DaysToDatesBatch)
+{
+    std::vector<std::int64_t> const days = {0, 741443, -1};
+    std::vector<SQL_DATE_STRUCT> dates(days.size());
+    days_to_dates(days.data(), days.size(), reinterpret_cast<char *>(dates.data()));
+    EXPECT_EQ(4000, dates[1].year);
+    EXPECT_EQ(1, dates[1].month);
+    EXPECT_EQ(2, dates[1].day);
+    EXPECT_EQ(1969, dates[2].year);
+    EXPECT_EQ(12, dates[2].month);
+    EXPECT_EQ(31, dates[2].day);
+
+    std::vector<std::int32_t> const days_32 = {0, 741443, -1};
+    std::vector<SQL_DATE_STRUCT> dates_32(days_32.size());
+    days_to_dates(days_32.data(), days_32.size(), reinterpret_cast<char *>(dates_32.data()));
+    EXPECT_EQ(0, std::memcmp(dates.data(), dates_32.data(), sizeof(SQL_DATE_STRUCT) * dates.size()));
+}
+
+
+TEST(TimeHelpersTest, TimestampsToNanosecondsKeepsFullFraction)
+{
+    std::vector<SQL_TIMESTAMP_STRUCT> const timestamps = {{1970, 1, 1, 0, 0, 1, 123456700},
+                                                          {1969, 12, 31, 23, 59, 59, 100},
+                                                          {2000, 1, 1, 0, 0, 0, 0}};
+    std::vector<intptr_t> const indicators = {sizeof(SQL_TIMESTAMP_STRUCT), sizeof(SQL_TIMESTAMP_STRUCT), SQL_NULL_DATA};
+    std::vector<std::int64_t> nanoseconds(timestamps.size(), 42);
+    timestamps_to_nanoseconds(reinterpret_cast<char const *>(timestamps.data()), indicators.data(),
+                              timestamps.size(), nanoseconds.data());
+    EXPECT_EQ(1123456700, nanoseconds[0]);
+    EXPECT_EQ(-999999900, nanoseconds[1]);
+    EXPECT_EQ(0, nanoseconds[2]);
+}
+
+
+TEST(TimeHelpersTest, TimestampOffsetsToNanosecondsNormalizesToUtc)
+{
+    std::vector<turbodbc::ss_timestampoffset_struct> const offsets = {{2017, 3, 16, 10, 35, 18, 500000000, -6, 0},
+                                                                      {1970, 1, 1, 5, 30, 0, 0, 5, 30},
+                                                                      {1970, 1, 1, 0, 0, 0, 0, -1, -30}};
+    std::vector<intptr_t> const indicators(offsets.size(), sizeof(turbodbc::ss_timestampoffset_struct));
+    std::vector<std::int64_t> nanoseconds(offsets.size());
+    timestamp_offsets_to_nanoseconds(reinterpret_cast<char const *>(offsets.data()), indicators.data(),
+                                     offsets.size(), nanoseconds.data());
+    // 2017-03-16T16:35:18.5Z
+    EXPECT_EQ(1489682118500000000, nanoseconds[0]);
+    EXPECT_EQ(0, nanoseconds[1]);
+    EXPECT_EQ(5400000000000, nanoseconds[2]);
+}
+
+
+TEST(TimeHelpersTest, TimestampsToMicrosecondsCoverSqlServerRange)
+{
+    std::vector<SQL_TIMESTAMP_STRUCT> const timestamps = {{1, 1, 1, 0, 0, 0, 0},
+                                                          {9999, 12, 31, 23, 59, 59, 999999900}};
+    std::vector<intptr_t> const indicators(timestamps.size(), sizeof(SQL_TIMESTAMP_STRUCT));
+    std::vector<std::int64_t> microseconds(timestamps.size());
+    timestamps_to_microseconds(reinterpret_cast<char const *>(timestamps.data()), indicators.data(),
+                               timestamps.size(), microseconds.data());
+    EXPECT_EQ(-62135596800000000, microseconds[0]);
+    EXPECT_EQ(253402300799999999, microseconds[1]);
+}
+
+
+TEST(TimeHelpersTest, TimestampOffsetsToMicrosecondsCoverSqlServerRange)
+{
+    std::vector<turbodbc::ss_timestampoffset_struct> const offsets = {{1, 1, 1, 0, 0, 0, 0, -1, 0},
+                                                                      {9999, 12, 31, 23, 59, 59, 999999900, 0, 0},
+                                                                      {2017, 3, 16, 10, 35, 18, 500000000, -6, 0}};
+    std::vector<intptr_t> const indicators(offsets.size(), sizeof(turbodbc::ss_timestampoffset_struct));
+    std::vector<std::int64_t> microseconds(offsets.size());
+    timestamp_offsets_to_microseconds(reinterpret_cast<char const *>(offsets.data()), indicators.data(),
+                                      offsets.size(), microseconds.data());
+    // 0001-01-01T01:00Z
+    EXPECT_EQ(-62135596800000000 + 3600000000, microseconds[0]);
+    EXPECT_EQ(253402300799999999, microseconds[1]);
+    EXPECT_EQ(1489682118500000, microseconds[2]);
+}
+
+
+TEST(TimeHelpersTest, NanosecondsRejectTimestampsOutsideTheirRange)
+{
+    std::vector<SQL_TIMESTAMP_STRUCT> const timestamps = {{1677, 9, 21, 0, 12, 44, 0},
+                                                          {2262, 4, 11, 23, 47, 15, 999999999},
+                                                          {1, 1, 1, 0, 0, 0, 0},
+                                                          {9999, 12, 31, 23, 59, 59, 0}};
+    std::vector<intptr_t> indicators(timestamps.size(), sizeof(SQL_TIMESTAMP_STRUCT));
+    std::vector<std::int64_t> nanoseconds(timestamps.size());
+    auto const data = reinterpret_cast<char const *>(timestamps.data());
+
+    timestamps_to_nanoseconds(data, indicators.data(), 2, nanoseconds.data());
+    EXPECT_EQ(-9223372036000000000, nanoseconds[0]);
+    EXPECT_EQ(9223372035999999999, nanoseconds[1]);
+
+    EXPECT_THROW(timestamps_to_nanoseconds(data + 2 * sizeof(SQL_TIMESTAMP_STRUCT), indicators.data(), 1, nanoseconds.data()),
+                 turbodbc::interface_error);
+    EXPECT_THROW(timestamps_to_nanoseconds(data, indicators.data(), timestamps.size(), nanoseconds.data()),
+                 turbodbc::interface_error);
+
+    // NULL values may hold anything
+    indicators[2] = SQL_NULL_DATA;
+    indicators[3] = SQL_NULL_DATA;
+    EXPECT_NO_THROW(timestamps_to_nanoseconds(data, indicators.data(), timestamps.size(), nanoseconds.data()));
+    EXPECT_EQ(0, nanoseconds[3]);
+}
+
+
+TEST(TimeHelpersTest, NanosecondsRejectTimestampOffsetsOutsideTheirRange)
+{
+    for (auto const & offset : {turbodbc::ss_timestampoffset_struct{1, 1, 1, 0, 0, 0, 0, 0, 0},
+                                turbodbc::ss_timestampoffset_struct{9999, 12, 31, 23, 59, 59, 0, 14, 0}}) {
+        intptr_t const indicator = sizeof(turbodbc::ss_timestampoffset_struct);
+        std::int64_t nanoseconds = 0;
+        EXPECT_THROW(timestamp_offsets_to_nanoseconds(reinterpret_cast<char const *>(&offset), &indicator, 1, &nanoseconds),
+                     turbodbc::interface_error);
+    }
+}
+
+
+TEST(TimeHelpersTest, TimestampOffsetToUtcTimestamp)
+{
+    std::vector<std::pair<turbodbc::ss_timestampoffset_struct, SQL_TIMESTAMP_STRUCT>> const cases = {
+        {{2017, 3, 16, 10, 35, 18, 500000100, -6, 0}, {2017, 3, 16, 16, 35, 18, 500000100}},
+        {{1, 1, 1, 0, 0, 0, 0, -1, -30}, {1, 1, 1, 1, 30, 0, 0}},
+        {{9999, 12, 31, 23, 59, 59, 999999900, 0, 0}, {9999, 12, 31, 23, 59, 59, 999999900}},
+        {{2000, 3, 1, 0, 30, 0, 0, 1, 0}, {2000, 2, 29, 23, 30, 0, 0}}
+    };
+    for (auto const & value : cases) {
+        SQL_TIMESTAMP_STRUCT actual;
+        timestamp_offset_to_utc_timestamp(reinterpret_cast<char const *>(&value.first), reinterpret_cast<char *>(&actual));
+        EXPECT_EQ(0, std::memcmp(&value.second, &actual, sizeof(actual))) << value.first.year;
+    }
+}
+
+
+TEST(TimeHelpersTest, TimesToNanoseconds)
+{
+    std::vector<turbodbc::ss_time2_struct> const times = {{0, 0, 0, 0},
+                                                          {23, 59, 59, 999999900},
+                                                          {12, 0, 0, 0}};
+    std::vector<intptr_t> const indicators = {sizeof(turbodbc::ss_time2_struct), sizeof(turbodbc::ss_time2_struct), SQL_NULL_DATA};
+    std::vector<std::int64_t> nanoseconds(times.size(), 42);
+    times_to_nanoseconds(reinterpret_cast<char const *>(times.data()), indicators.data(),
+                         times.size(), nanoseconds.data());
+    EXPECT_EQ(0, nanoseconds[0]);
+    EXPECT_EQ(86399999999900, nanoseconds[1]);
+    EXPECT_EQ(0, nanoseconds[2]);
+}
+
+
+TEST(TimeHelpersTest, CoarseTicksToTimestamps)
+{
+    std::vector<std::int64_t> const seconds = {1, -1};
+    std::vector<SQL_TIMESTAMP_STRUCT> from_seconds(seconds.size());
+    seconds_to_timestamps(seconds.data(), seconds.size(), reinterpret_cast<char *>(from_seconds.data()));
+    EXPECT_EQ(1970, from_seconds[0].year);
+    EXPECT_EQ(1, from_seconds[0].second);
+    EXPECT_EQ(0, from_seconds[0].fraction);
+    EXPECT_EQ(1969, from_seconds[1].year);
+    EXPECT_EQ(59, from_seconds[1].second);
+
+    std::vector<std::int64_t> const milliseconds = {1500, -1};
+    std::vector<SQL_TIMESTAMP_STRUCT> from_milliseconds(milliseconds.size());
+    milliseconds_to_timestamps(milliseconds.data(), milliseconds.size(), reinterpret_cast<char *>(from_milliseconds.data()));
+    EXPECT_EQ(1, from_milliseconds[0].second);
+    EXPECT_EQ(500000000, from_milliseconds[0].fraction);
+    EXPECT_EQ(59, from_milliseconds[1].second);
+    EXPECT_EQ(999000000, from_milliseconds[1].fraction);
+}
+
+
+TEST(TimeHelpersTest, MillisecondsToDates)
+{
+    // 4000-01-02, one millisecond before the epoch, and noon of the epoch
+    std::vector<std::int64_t> const milliseconds = {741443LL * 86400000, -1, 43200000};
+    std::vector<SQL_DATE_STRUCT> dates(milliseconds.size());
+    milliseconds_to_dates(milliseconds.data(), milliseconds.size(), reinterpret_cast<char *>(dates.data()));
+    EXPECT_EQ(4000, dates[0].year);
+    EXPECT_EQ(1, dates[0].month);
+    EXPECT_EQ(2, dates[0].day);
+    EXPECT_EQ(1969, dates[1].year);
+    EXPECT_EQ(12, dates[1].month);
+    EXPECT_EQ(31, dates[1].day);
+    EXPECT_EQ(1970, dates[2].year);
+    EXPECT_EQ(1, dates[2].day);
+}
+
+
+TEST(TimeHelpersTest, TicksToTimes)
+{
+    // 23:59:59 plus the finest fraction of each resolution
+    std::vector<std::int32_t> const seconds = {86399};
+    std::vector<std::int32_t> const milliseconds = {86399999};
+    std::vector<std::int64_t> const microseconds = {86399999999};
+    std::vector<std::int64_t> const nanoseconds = {86399999999999};
+    std::vector<turbodbc::ss_time2_struct> times(4);
+    seconds_to_times(seconds.data(), 1, reinterpret_cast<char *>(&times[0]));
+    milliseconds_to_times(milliseconds.data(), 1, reinterpret_cast<char *>(&times[1]));
+    microseconds_to_times(microseconds.data(), 1, reinterpret_cast<char *>(&times[2]));
+    nanoseconds_to_times(nanoseconds.data(), 1, reinterpret_cast<char *>(&times[3]));
+
+    for (auto const & time : times) {
+        EXPECT_EQ(23, time.hour);
+        EXPECT_EQ(59, time.minute);
+        EXPECT_EQ(59, time.second);
+    }
+    EXPECT_EQ(0, times[0].fraction);
+    EXPECT_EQ(999000000, times[1].fraction);
+    EXPECT_EQ(999999000, times[2].fraction);
+    EXPECT_EQ(999999999, times[3].fraction);
+
+    std::vector<std::int64_t> const roundtrip_input = {0, 45015250000000};
+    std::vector<turbodbc::ss_time2_struct> roundtrip(2);
+    nanoseconds_to_times(roundtrip_input.data(), 2, reinterpret_cast<char *>(roundtrip.data()));
+    std::vector<intptr_t> const indicators(2, sizeof(turbodbc::ss_time2_struct));
+    std::vector<std::int64_t> back(2);
+    times_to_nanoseconds(reinterpret_cast<char const *>(roundtrip.data()), indicators.data(), 2, back.data());
+    EXPECT_EQ(roundtrip_input, back);
+}
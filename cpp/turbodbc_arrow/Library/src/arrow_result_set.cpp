@@ -4,31 +4,49 @@
 #undef BOOL
 #undef timezone
 #include <arrow/api.h>
+#include <arrow/c/abi.h>
+#include <arrow/c/bridge.h>
 #include <arrow/python/pyarrow.h>
 
 #include <sql.h>
 
+#include <turbodbc/binary_helpers.h>
+#include <turbodbc/bounded_queue.h>
+#include <turbodbc/decimal_helpers.h>
 #include <turbodbc/errors.h>
+#include <turbodbc/indicator_helpers.h>
+#include <turbodbc/string_helpers.h>
+#include <turbodbc/thread_pool.h>
 #include <turbodbc/time_helpers.h>
 
+#include <algorithm>
 #include <ciso646>
+#include <cstring>
+#include <optional>
+#include <thread>
 #include <vector>
 
-#include <boost/locale.hpp>
-
 using arrow::default_memory_pool;
 using arrow::AdaptiveIntBuilder;
 using arrow::ArrayBuilder;
+using arrow::BinaryBuilder;
 using arrow::BooleanBuilder;
 using arrow::Date32Builder;
+using arrow::Decimal128Builder;
 using arrow::DoubleBuilder;
+using arrow::FixedSizeBinaryBuilder;
+using arrow::FloatBuilder;
+using arrow::Int8Builder;
+using arrow::Int16Builder;
 using arrow::Int32Builder;
 using arrow::Int64Builder;
 using arrow::Status;
+using arrow::Time64Builder;
 using arrow::StringBuilder;
 using arrow::StringDictionaryBuilder;
 using arrow::TimeUnit;
 using arrow::TimestampBuilder;
+using arrow::UInt64Builder;
 using arrow::Type;
 
 namespace turbodbc_arrow {
@@ -76,23 +94,50 @@ class StringDictionaryBuilderProxy: public StringDictionaryBuilder {
     size_t null_count_ = 0;
 };
 
-std::unique_ptr<ArrayBuilder> make_array_builder(turbodbc::type_code type, bool strings_as_dictionary, bool adaptive_integers)
+// Unique identifiers are exported as 16 bytes in RFC 4122 order
+std::size_t const guid_size = 16;
+
+std::unique_ptr<ArrayBuilder> make_array_builder(turbodbc::column_info const& info, bool strings_as_dictionary, bool adaptive_integers)
 {
-    switch (type) {
+    switch (info.type) {
         case turbodbc::type_code::floating_point:
             return std::unique_ptr<ArrayBuilder>(new DoubleBuilder());
+        case turbodbc::type_code::floating_point_32:
+            return std::unique_ptr<ArrayBuilder>(new FloatBuilder());
         case turbodbc::type_code::integer:
             if (adaptive_integers) {
                 return std::unique_ptr<ArrayBuilder>(new AdaptiveIntBuilder());
             } else {
                 return std::unique_ptr<ArrayBuilder>(new Int64Builder());
             }
+        case turbodbc::type_code::integer_8:
+            return std::unique_ptr<ArrayBuilder>(new Int8Builder());
+        case turbodbc::type_code::integer_16:
+            return std::unique_ptr<ArrayBuilder>(new Int16Builder());
+        case turbodbc::type_code::integer_32:
+            return std::unique_ptr<ArrayBuilder>(new Int32Builder());
         case turbodbc::type_code::boolean:
             return std::unique_ptr<ArrayBuilder>(new BooleanBuilder());
         case turbodbc::type_code::timestamp:
             return std::unique_ptr<TimestampBuilder>(new TimestampBuilder(arrow::timestamp(TimeUnit::MICRO), ::arrow::default_memory_pool()));
+        case turbodbc::type_code::timestamp_nanoseconds:
+            return std::unique_ptr<TimestampBuilder>(new TimestampBuilder(arrow::timestamp(TimeUnit::NANO), ::arrow::default_memory_pool()));
+        case turbodbc::type_code::timestamp_offset:
+            return std::unique_ptr<TimestampBuilder>(new TimestampBuilder(arrow::timestamp(TimeUnit::MICRO, "UTC"), ::arrow::default_memory_pool()));
+        case turbodbc::type_code::timestamp_offset_nanoseconds:
+            return std::unique_ptr<TimestampBuilder>(new TimestampBuilder(arrow::timestamp(TimeUnit::NANO, "UTC"), ::arrow::default_memory_pool()));
+        case turbodbc::type_code::time:
+            return std::unique_ptr<Time64Builder>(new Time64Builder(arrow::time64(TimeUnit::NANO), ::arrow::default_memory_pool()));
         case turbodbc::type_code::date:
             return std::unique_ptr<Date32Builder>(new Date32Builder());
+        case turbodbc::type_code::guid:
+            return std::unique_ptr<FixedSizeBinaryBuilder>(new FixedSizeBinaryBuilder(arrow::fixed_size_binary(guid_size)));
+        case turbodbc::type_code::rowversion:
+            return std::unique_ptr<ArrayBuilder>(new UInt64Builder());
+        case turbodbc::type_code::binary:
+            return std::unique_ptr<ArrayBuilder>(new BinaryBuilder());
+        case turbodbc::type_code::decimal:
+            return std::unique_ptr<Decimal128Builder>(new Decimal128Builder(arrow::decimal128(info.precision, info.scale)));
         case turbodbc::type_code::unicode:
             if (strings_as_dictionary) {
                 return std::unique_ptr<StringDictionaryBuilderProxy>(new StringDictionaryBuilderProxy(::arrow::utf8(), ::arrow::default_memory_pool()));
@@ -123,14 +168,32 @@ Status AppendStringsToBuilder(size_t rows_in_batch, BuilderType& builder, cpp_od
 
 template <typename BuilderType>
 Status AppendUnicodeStringsToBuilder(size_t rows_in_batch, BuilderType& builder, cpp_odbc::multi_value_buffer const& input_buffer) {
+    // One UTF-16 code unit never needs more than three bytes of UTF-8
+    std::size_t const maximum_text_size = input_buffer.capacity_per_element() - sizeof(char16_t);
+    std::vector<char> utf8(3 * maximum_text_size / sizeof(char16_t));
     for (std::size_t j = 0; j != rows_in_batch; ++j) {
         auto const element = input_buffer[j];
         if (element.indicator == SQL_NULL_DATA) {
             ARROW_RETURN_NOT_OK(builder.AppendNullProxy());
         } else {
-            std::u16string str_u16(reinterpret_cast<const char16_t*>(element.data_pointer), element.indicator / 2);
-            std::string u8string = boost::locale::conv::utf_to_utf<char>(str_u16);;
-            ARROW_RETURN_NOT_OK(builder.AppendProxy(u8string.data(), u8string.size()));
+            auto const size = turbodbc::buffered_string_size(element.indicator, maximum_text_size);
+            auto const utf8_size = turbodbc::utf16_to_utf8(reinterpret_cast<const char16_t*>(element.data_pointer),
+                                                           size / sizeof(char16_t), utf8.data());
+            ARROW_RETURN_NOT_OK(builder.AppendProxy(utf8.data(), utf8_size));
+        }
+    }
+    return Status::OK();
+}
+
+Status AppendBinariesToBuilder(size_t rows_in_batch, BinaryBuilder& builder, cpp_odbc::multi_value_buffer const& input_buffer) {
+    std::size_t const maximum_size = input_buffer.capacity_per_element();
+    for (std::size_t j = 0; j != rows_in_batch; ++j) {
+        auto const element = input_buffer[j];
+        if (element.indicator == SQL_NULL_DATA) {
+            ARROW_RETURN_NOT_OK(builder.AppendNull());
+        } else {
+            auto const size = turbodbc::buffered_string_size(element.indicator, maximum_size);
+            ARROW_RETURN_NOT_OK(builder.Append(reinterpret_cast<uint8_t const*>(element.data_pointer), size));
         }
     }
     return Status::OK();
@@ -143,25 +206,423 @@ Status AppendIntsToBuilder(size_t rows_in_batch, std::unique_ptr<ArrayBuilder> c
     return typed_builder->AppendValues(data_ptr, rows_in_batch, valid_bytes);
 }
 
+template <typename BuilderType, typename ValueType>
+Status AppendValuesToBuilder(size_t rows_in_batch, std::unique_ptr<ArrayBuilder> const& builder, cpp_odbc::multi_value_buffer const& input_buffer, uint8_t* valid_bytes) {
+    auto typed_builder = static_cast<BuilderType*>(builder.get());
+    auto data_ptr = reinterpret_cast<const ValueType*>(input_buffer.data_pointer());
+    return typed_builder->AppendValues(data_ptr, rows_in_batch, valid_bytes);
+}
+
+// Columns whose ODBC buffer layout is identical to the Arrow value buffer
+bool is_zero_copy_column(turbodbc::column_info const& info) {
+    switch (info.type) {
+        case turbodbc::type_code::integer:
+        case turbodbc::type_code::floating_point:
+            return info.element_size == sizeof(int64_t);
+        case turbodbc::type_code::integer_8:
+        case turbodbc::type_code::integer_16:
+        case turbodbc::type_code::integer_32:
+        case turbodbc::type_code::floating_point_32:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Binds Arrow-owned memory to zero-copy columns of a result set. The columns
+// are returned to their internal buffers on destruction so that the result set
+// never writes to memory it does not own once the binding is gone.
+class zero_copy_binding {
+  public:
+    explicit zero_copy_binding(turbodbc::result_sets::result_set& base) :
+        base_(base)
+    {}
+
+    ~zero_copy_binding() {
+        for (auto const column : bound_columns_) {
+            try {
+                base_.bind_external_data(column, nullptr);
+            } catch (...) {
+                // nothing sensible left to do in a destructor
+            }
+        }
+    }
+
+    Status bind(std::size_t column, std::size_t rows, std::size_t element_size, std::shared_ptr<arrow::Buffer>* out) {
+        ARROW_ASSIGN_OR_RAISE(*out, arrow::AllocateBuffer(rows * element_size, default_memory_pool()));
+        if (base_.bind_external_data(column, reinterpret_cast<char*>((*out)->mutable_data()))) {
+            bound_columns_.push_back(column);
+        }
+        return Status::OK();
+    }
+
+    bool is_bound(std::size_t column) const {
+        return std::find(bound_columns_.begin(), bound_columns_.end(), column) != bound_columns_.end();
+    }
+
+  private:
+    turbodbc::result_sets::result_set& base_;
+    std::vector<std::size_t> bound_columns_;
+};
+
+Status make_validity_bitmap(intptr_t const* indicator, std::size_t rows_in_batch, std::shared_ptr<arrow::Buffer>* out, int64_t* null_count) {
+    ARROW_ASSIGN_OR_RAISE(*out, arrow::AllocateBuffer((rows_in_batch + 7) / 8, default_memory_pool()));
+    *null_count = turbodbc::indicators_to_validity_bitmap(indicator, rows_in_batch, (*out)->mutable_data());
+    if (*null_count == 0) {
+        out->reset();
+    }
+    return Status::OK();
+}
+
+// Returns nullptr if all values are valid, which Arrow's builders treat as "no nulls".
+// String and binary builders do not consume valid bytes but check indicators themselves.
+uint8_t* make_valid_bytes(turbodbc::type_code type, cpp_odbc::multi_value_buffer const& input_buffer, std::size_t rows_in_batch, std::vector<uint8_t>& valid_bytes) {
+    if ((type == turbodbc::type_code::string) or (type == turbodbc::type_code::unicode) or (type == turbodbc::type_code::binary)) {
+        return nullptr;
+    }
+    if (valid_bytes.size() < rows_in_batch) {
+        valid_bytes.resize(rows_in_batch);
+    }
+    auto const null_count = turbodbc::indicators_to_valid_mask(input_buffer.indicator_pointer(), rows_in_batch, valid_bytes.data());
+    return (null_count == 0) ? nullptr : valid_bytes.data();
+}
+
+/**
+ * @brief Estimate how expensive it is to convert a column relative to others.
+ *        Expensive columns are scheduled first when converting in parallel.
+ */
+int conversion_cost(turbodbc::type_code type) {
+    switch (type) {
+        case turbodbc::type_code::unicode:
+            return 3;
+        case turbodbc::type_code::timestamp:
+        case turbodbc::type_code::timestamp_nanoseconds:
+        case turbodbc::type_code::timestamp_offset:
+        case turbodbc::type_code::timestamp_offset_nanoseconds:
+        case turbodbc::type_code::time:
+        case turbodbc::type_code::date:
+            return 2;
+        case turbodbc::type_code::string:
+        case turbodbc::type_code::binary:
+        case turbodbc::type_code::decimal:
+        case turbodbc::type_code::guid:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+// Columns which are converted straight into an Arrow value buffer without a builder
+bool is_direct_column(turbodbc::column_info const& info) {
+    switch (info.type) {
+        case turbodbc::type_code::boolean:
+        case turbodbc::type_code::timestamp:
+        case turbodbc::type_code::timestamp_nanoseconds:
+        case turbodbc::type_code::timestamp_offset:
+        case turbodbc::type_code::timestamp_offset_nanoseconds:
+        case turbodbc::type_code::time:
+        case turbodbc::type_code::date:
+        case turbodbc::type_code::decimal:
+        case turbodbc::type_code::rowversion:
+        case turbodbc::type_code::guid:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Converts n_values buffer elements to 64 bit values with the given kernel
+template <typename Kernel>
+Status make_int64_values(Kernel kernel, cpp_odbc::multi_value_buffer const& input_buffer, std::size_t rows_in_batch, std::shared_ptr<arrow::Buffer>* out) {
+    ARROW_ASSIGN_OR_RAISE(*out, arrow::AllocateBuffer(rows_in_batch * sizeof(int64_t), default_memory_pool()));
+    kernel(input_buffer.data_pointer(), input_buffer.indicator_pointer(), rows_in_batch,
+           reinterpret_cast<int64_t*>((*out)->mutable_data()));
+    return Status::OK();
+}
+
+Status make_boolean_values(cpp_odbc::multi_value_buffer const& input_buffer, std::size_t rows_in_batch, std::shared_ptr<arrow::Buffer>* out) {
+    std::size_t const bitmap_size = (rows_in_batch + 7) / 8;
+    ARROW_ASSIGN_OR_RAISE(*out, arrow::AllocateBuffer(bitmap_size, default_memory_pool()));
+    uint8_t* bitmap = (*out)->mutable_data();
+    std::memset(bitmap, 0, bitmap_size);
+    auto const values = reinterpret_cast<uint8_t const*>(input_buffer.data_pointer());
+    for (std::size_t i = 0; i != rows_in_batch; ++i) {
+        if (values[i] != 0) {
+            bitmap[i / 8] |= static_cast<uint8_t>(1 << (i % 8));
+        }
+    }
+    return Status::OK();
+}
+
+// Arrow stores Decimal128 values as 16 byte two's complement integers
+std::size_t const decimal_size = 16;
+
+Status make_direct_values(turbodbc::type_code type, cpp_odbc::multi_value_buffer const& input_buffer, std::size_t rows_in_batch, std::shared_ptr<arrow::Buffer>* out) {
+    switch (type) {
+        case turbodbc::type_code::timestamp: {
+            ARROW_ASSIGN_OR_RAISE(*out, arrow::AllocateBuffer(rows_in_batch * sizeof(int64_t), default_memory_pool()));
+            turbodbc::timestamps_to_microseconds(input_buffer.data_pointer(), input_buffer.indicator_pointer(), rows_in_batch,
+                                                 reinterpret_cast<int64_t*>((*out)->mutable_data()));
+            return Status::OK();
+        }
+        case turbodbc::type_code::date: {
+            ARROW_ASSIGN_OR_RAISE(*out, arrow::AllocateBuffer(rows_in_batch * sizeof(int32_t), default_memory_pool()));
+            turbodbc::dates_to_days(input_buffer.data_pointer(), input_buffer.indicator_pointer(), rows_in_batch,
+                                    reinterpret_cast<int32_t*>((*out)->mutable_data()));
+            return Status::OK();
+        }
+        case turbodbc::type_code::timestamp_nanoseconds:
+            return make_int64_values(turbodbc::timestamps_to_nanoseconds, input_buffer, rows_in_batch, out);
+        case turbodbc::type_code::timestamp_offset:
+            return make_int64_values(turbodbc::timestamp_offsets_to_microseconds, input_buffer, rows_in_batch, out);
+        case turbodbc::type_code::timestamp_offset_nanoseconds:
+            return make_int64_values(turbodbc::timestamp_offsets_to_nanoseconds, input_buffer, rows_in_batch, out);
+        case turbodbc::type_code::time:
+            return make_int64_values(turbodbc::times_to_nanoseconds, input_buffer, rows_in_batch, out);
+        case turbodbc::type_code::guid: {
+            ARROW_ASSIGN_OR_RAISE(*out, arrow::AllocateBuffer(rows_in_batch * guid_size, default_memory_pool()));
+            turbodbc::guids_to_bytes(input_buffer.data_pointer(), input_buffer.indicator_pointer(), rows_in_batch,
+                                     (*out)->mutable_data());
+            return Status::OK();
+        }
+        case turbodbc::type_code::rowversion: {
+            ARROW_ASSIGN_OR_RAISE(*out, arrow::AllocateBuffer(rows_in_batch * sizeof(uint64_t), default_memory_pool()));
+            turbodbc::rowversions_to_integers(input_buffer.data_pointer(), input_buffer.indicator_pointer(), rows_in_batch,
+                                              reinterpret_cast<uint64_t*>((*out)->mutable_data()));
+            return Status::OK();
+        }
+        case turbodbc::type_code::decimal: {
+            ARROW_ASSIGN_OR_RAISE(*out, arrow::AllocateBuffer(rows_in_batch * decimal_size, default_memory_pool()));
+            turbodbc::numerics_to_decimal128(input_buffer.data_pointer(), input_buffer.indicator_pointer(), rows_in_batch,
+                                             (*out)->mutable_data());
+            return Status::OK();
+        }
+        default:
+            return make_boolean_values(input_buffer, rows_in_batch, out);
+    }
+}
+
+char const * const stream_capsule_name = "arrow_array_stream";
+
+void release_stream_capsule(PyObject * capsule) {
+    auto stream = static_cast<ArrowArrayStream *>(PyCapsule_GetPointer(capsule, stream_capsule_name));
+    if (stream->release != nullptr) {
+        stream->release(stream);
+    }
+    delete stream;
+}
+
+// Consumers of the C stream may call into the reader with or without the GIL
+class result_set_reader : public arrow::RecordBatchReader {
+  public:
+    result_set_reader(arrow_result_set const & result_set, std::shared_ptr<arrow::RecordBatch> first_batch) :
+        result_set_(result_set),
+        schema_(first_batch->schema()),
+        pending_(std::move(first_batch)),
+        exhausted_(pending_->num_rows() == 0)
+    {}
+
+    std::shared_ptr<arrow::Schema> schema() const override {
+        return schema_;
+    }
+
+    Status ReadNext(std::shared_ptr<arrow::RecordBatch>* batch) override {
+        if (pending_) {
+            *batch = exhausted_ ? nullptr : std::move(pending_);
+            pending_.reset();
+            return Status::OK();
+        }
+        if (exhausted_) {
+            batch->reset();
+            return Status::OK();
+        }
+
+        std::optional<pybind11::gil_scoped_release> release;
+        if (Py_IsInitialized() and PyGILState_Check()) {
+            release.emplace();
+        }
+        try {
+            ARROW_RETURN_NOT_OK(result_set_.fetch_next_batch_native(batch));
+        } catch (std::exception const & error) {
+            return Status::IOError(error.what());
+        }
+        if ((*batch)->num_rows() == 0) {
+            exhausted_ = true;
+            batch->reset();
+        }
+        return Status::OK();
+    }
+
+  private:
+    arrow_result_set result_set_;
+    std::shared_ptr<arrow::Schema> schema_;
+    std::shared_ptr<arrow::RecordBatch> pending_;
+    bool exhausted_;
+};
+
+using batch_result = arrow::Result<std::shared_ptr<arrow::RecordBatch>>;
+
+// A converter thread fetches and converts batches into a bounded queue while
+// the consumer reads previously converted batches. The first batch is awaited
+// on construction because it determines the schema.
+class pipelined_reader : public arrow::RecordBatchReader {
+  public:
+    pipelined_reader(arrow_result_set const & result_set, std::size_t depth) :
+        queue_(depth),
+        first_(std::shared_ptr<arrow::RecordBatch>()),
+        has_first_(true),
+        exhausted_(false),
+        converter_([this, result_set]() { convert(result_set); })
+    {
+        if (not queue_.pull(first_)) {
+            first_ = Status::Invalid("Pipeline stopped before the first batch");
+        }
+        if (first_.ok()) {
+            schema_ = (*first_)->schema();
+        }
+    }
+
+    ~pipelined_reader() {
+        queue_.close();
+        converter_.join();
+    }
+
+    Status first_status() const {
+        return first_.status();
+    }
+
+    std::shared_ptr<arrow::Schema> schema() const override {
+        return schema_;
+    }
+
+    Status ReadNext(std::shared_ptr<arrow::RecordBatch>* batch) override {
+        batch->reset();
+        if (exhausted_) {
+            return Status::OK();
+        }
+
+        batch_result next = std::shared_ptr<arrow::RecordBatch>();
+        if (has_first_) {
+            next = std::move(first_);
+            has_first_ = false;
+        } else {
+            std::optional<pybind11::gil_scoped_release> release;
+            if (Py_IsInitialized() and PyGILState_Check()) {
+                release.emplace();
+            }
+            if (not queue_.pull(next)) {
+                next = Status::Invalid("Pipeline stopped unexpectedly");
+            }
+        }
+
+        if (not next.ok()) {
+            exhausted_ = true;
+            return next.status();
+        }
+        if ((*next)->num_rows() == 0) {
+            exhausted_ = true;
+            return Status::OK();
+        }
+        *batch = std::move(*next);
+        return Status::OK();
+    }
+
+  private:
+    void convert(arrow_result_set result_set) {
+        bool last = false;
+        while (not last) {
+            std::shared_ptr<arrow::RecordBatch> batch;
+            Status status;
+            try {
+                status = result_set.fetch_next_batch_native(&batch);
+            } catch (std::exception const & error) {
+                status = Status::IOError(error.what());
+            }
+            last = (not status.ok()) or (batch->num_rows() == 0);
+            batch_result item = status.ok() ? batch_result(std::move(batch)) : batch_result(status);
+            if (not queue_.push(std::move(item))) {
+                return;
+            }
+        }
+    }
+
+    turbodbc::bounded_queue<batch_result> queue_;
+    batch_result first_;
+    bool has_first_;
+    std::shared_ptr<arrow::Schema> schema_;
+    bool exhausted_;
+    std::thread converter_;
+};
+
 }
 
 arrow_result_set::arrow_result_set(turbodbc::result_sets::result_set & base, bool strings_as_dictionary, bool adaptive_integers) :
-    base_result_(base), strings_as_dictionary_(strings_as_dictionary), adaptive_integers_(adaptive_integers)
+    arrow_result_set(base, strings_as_dictionary, adaptive_integers, false)
 {
 }
 
-std::shared_ptr<arrow::DataType> turbodbc_type_to_arrow(turbodbc::type_code type) {
-    switch (type) {
+arrow_result_set::arrow_result_set(turbodbc::result_sets::result_set & base, bool strings_as_dictionary, bool adaptive_integers, bool zero_copy) :
+    arrow_result_set(base, strings_as_dictionary, adaptive_integers, zero_copy, 1)
+{
+}
+
+arrow_result_set::arrow_result_set(turbodbc::result_sets::result_set & base, bool strings_as_dictionary, bool adaptive_integers, bool zero_copy,
+                                   std::size_t conversion_threads) :
+    arrow_result_set(base, strings_as_dictionary, adaptive_integers, zero_copy, conversion_threads, 0)
+{
+}
+
+arrow_result_set::arrow_result_set(turbodbc::result_sets::result_set & base, bool strings_as_dictionary, bool adaptive_integers, bool zero_copy,
+                                   std::size_t conversion_threads, std::size_t pipeline_depth) :
+    base_result_(base), strings_as_dictionary_(strings_as_dictionary), adaptive_integers_(adaptive_integers),
+    zero_copy_(zero_copy), conversion_threads_(conversion_threads), pipeline_depth_(pipeline_depth), rows_per_batch_(0)
+{
+}
+
+arrow_result_set::arrow_result_set(std::shared_ptr<turbodbc::result_sets::result_set> base, bool strings_as_dictionary,
+                                   bool adaptive_integers, bool zero_copy, std::size_t conversion_threads,
+                                   std::size_t pipeline_depth) :
+    arrow_result_set(*base, strings_as_dictionary, adaptive_integers, zero_copy, conversion_threads, pipeline_depth)
+{
+    owned_base_ = std::move(base);
+}
+
+std::shared_ptr<arrow::DataType> turbodbc_type_to_arrow(turbodbc::column_info const& info) {
+    switch (info.type) {
         case turbodbc::type_code::floating_point:
             return arrow::float64();
+        case turbodbc::type_code::floating_point_32:
+            return arrow::float32();
         case turbodbc::type_code::integer:
             return arrow::int64();
+        case turbodbc::type_code::integer_8:
+            return arrow::int8();
+        case turbodbc::type_code::integer_16:
+            return arrow::int16();
+        case turbodbc::type_code::integer_32:
+            return arrow::int32();
         case turbodbc::type_code::boolean:
             return arrow::boolean();
         case turbodbc::type_code::timestamp:
             return arrow::timestamp(TimeUnit::MICRO);
+        case turbodbc::type_code::timestamp_nanoseconds:
+            return arrow::timestamp(TimeUnit::NANO);
+        case turbodbc::type_code::timestamp_offset:
+            return arrow::timestamp(TimeUnit::MICRO, "UTC");
+        case turbodbc::type_code::timestamp_offset_nanoseconds:
+            return arrow::timestamp(TimeUnit::NANO, "UTC");
+        case turbodbc::type_code::time:
+            return arrow::time64(TimeUnit::NANO);
         case turbodbc::type_code::date:
             return arrow::date32();
+        case turbodbc::type_code::guid:
+            return arrow::fixed_size_binary(guid_size);
+        case turbodbc::type_code::rowversion:
+            return arrow::uint64();
+        case turbodbc::type_code::binary:
+            return arrow::binary();
+        case turbodbc::type_code::decimal:
+            return arrow::decimal128(info.precision, info.scale);
         default:
             return std::make_shared<arrow::StringType>();
     }
@@ -173,7 +634,7 @@ std::shared_ptr<arrow::Schema> arrow_result_set::schema()
     auto const n_columns = column_info.size();
     std::vector<std::shared_ptr<arrow::Field>> fields;
     for (std::size_t i = 0; i != n_columns; ++i) {
-        std::shared_ptr<arrow::DataType> type = turbodbc_type_to_arrow(column_info[i].type);
+        std::shared_ptr<arrow::DataType> type = turbodbc_type_to_arrow(column_info[i]);
         fields.emplace_back(std::make_shared<arrow::Field>(column_info[i].name, type, column_info[i].supports_null_values));
     }
     return std::make_shared<arrow::Schema>(fields);
@@ -199,30 +660,47 @@ Status append_to_bool_builder(size_t rows_in_batch, std::unique_ptr<ArrayBuilder
     return typed_builder->AppendValues(data_ptr, rows_in_batch, valid_bytes);
 }
 
-Status append_to_timestamp_builder(size_t rows_in_batch, std::unique_ptr<ArrayBuilder> const& builder, cpp_odbc::multi_value_buffer const& input_buffer, uint8_t*) {
+Status append_to_timestamp_builder(size_t rows_in_batch, std::unique_ptr<ArrayBuilder> const& builder, cpp_odbc::multi_value_buffer const& input_buffer, uint8_t* valid_bytes) {
     auto typed_builder = static_cast<TimestampBuilder*>(builder.get());
-    for (std::size_t j = 0; j < rows_in_batch; ++j) {
-        auto element = input_buffer[j];
-        if (element.indicator == SQL_NULL_DATA) {
-            ARROW_RETURN_NOT_OK(typed_builder->AppendNull());
-        } else {
-            ARROW_RETURN_NOT_OK(typed_builder->Append(turbodbc::timestamp_to_microseconds(element.data_pointer)));
-        }
-    }
-    return Status::OK();
+    std::vector<int64_t> microseconds(rows_in_batch);
+    turbodbc::timestamps_to_microseconds(input_buffer.data_pointer(), input_buffer.indicator_pointer(), rows_in_batch, microseconds.data());
+    return typed_builder->AppendValues(microseconds.data(), rows_in_batch, valid_bytes);
 }
 
-Status append_to_date_builder(size_t rows_in_batch, std::unique_ptr<ArrayBuilder> const& builder, cpp_odbc::multi_value_buffer const& input_buffer, uint8_t*) {
+Status append_to_date_builder(size_t rows_in_batch, std::unique_ptr<ArrayBuilder> const& builder, cpp_odbc::multi_value_buffer const& input_buffer, uint8_t* valid_bytes) {
     auto typed_builder = static_cast<Date32Builder*>(builder.get());
-    for (std::size_t j = 0; j < rows_in_batch; ++j) {
-        auto element = input_buffer[j];
-        if (element.indicator == SQL_NULL_DATA) {
-            ARROW_RETURN_NOT_OK(typed_builder->AppendNull());
-        } else {
-            ARROW_RETURN_NOT_OK(typed_builder->Append(turbodbc::date_to_days(element.data_pointer)));
-        }
-    }
-    return Status::OK();
+    std::vector<int32_t> days(rows_in_batch);
+    turbodbc::dates_to_days(input_buffer.data_pointer(), input_buffer.indicator_pointer(), rows_in_batch, days.data());
+    return typed_builder->AppendValues(days.data(), rows_in_batch, valid_bytes);
+}
+
+template <typename BuilderType, typename Kernel>
+Status append_int64_values(Kernel kernel, size_t rows_in_batch, std::unique_ptr<ArrayBuilder> const& builder, cpp_odbc::multi_value_buffer const& input_buffer, uint8_t* valid_bytes) {
+    auto typed_builder = static_cast<BuilderType*>(builder.get());
+    std::vector<int64_t> values(rows_in_batch);
+    kernel(input_buffer.data_pointer(), input_buffer.indicator_pointer(), rows_in_batch, values.data());
+    return typed_builder->AppendValues(values.data(), rows_in_batch, valid_bytes);
+}
+
+Status append_to_guid_builder(size_t rows_in_batch, std::unique_ptr<ArrayBuilder> const& builder, cpp_odbc::multi_value_buffer const& input_buffer, uint8_t* valid_bytes) {
+    auto typed_builder = static_cast<FixedSizeBinaryBuilder*>(builder.get());
+    std::vector<uint8_t> bytes(rows_in_batch * guid_size);
+    turbodbc::guids_to_bytes(input_buffer.data_pointer(), input_buffer.indicator_pointer(), rows_in_batch, bytes.data());
+    return typed_builder->AppendValues(bytes.data(), rows_in_batch, valid_bytes);
+}
+
+Status append_to_rowversion_builder(size_t rows_in_batch, std::unique_ptr<ArrayBuilder> const& builder, cpp_odbc::multi_value_buffer const& input_buffer, uint8_t* valid_bytes) {
+    auto typed_builder = static_cast<UInt64Builder*>(builder.get());
+    std::vector<uint64_t> values(rows_in_batch);
+    turbodbc::rowversions_to_integers(input_buffer.data_pointer(), input_buffer.indicator_pointer(), rows_in_batch, values.data());
+    return typed_builder->AppendValues(values.data(), rows_in_batch, valid_bytes);
+}
+
+Status append_to_decimal_builder(size_t rows_in_batch, std::unique_ptr<ArrayBuilder> const& builder, cpp_odbc::multi_value_buffer const& input_buffer, uint8_t* valid_bytes) {
+    auto typed_builder = static_cast<Decimal128Builder*>(builder.get());
+    std::vector<uint8_t> decimals(rows_in_batch * decimal_size);
+    turbodbc::numerics_to_decimal128(input_buffer.data_pointer(), input_buffer.indicator_pointer(), rows_in_batch, decimals.data());
+    return typed_builder->AppendValues(decimals.data(), rows_in_batch, valid_bytes);
 }
 
 Status append_to_string_builder(size_t rows_in_batch, std::unique_ptr<ArrayBuilder> const& builder, cpp_odbc::multi_value_buffer const& input_buffer, uint8_t*, bool strings_as_dictionary) {
@@ -247,53 +725,196 @@ Status append_to_unicode_builder(size_t rows_in_batch, std::unique_ptr<ArrayBuil
 }
 
 
+Status append_to_builder(turbodbc::type_code type, size_t rows_in_batch, std::unique_ptr<ArrayBuilder> const& builder, cpp_odbc::multi_value_buffer const& input_buffer, uint8_t* valid_bytes, bool strings_as_dictionary, bool adaptive_integers) {
+    switch (type) {
+        case turbodbc::type_code::floating_point:
+            return append_to_double_builder(rows_in_batch, builder, input_buffer, valid_bytes);
+        case turbodbc::type_code::floating_point_32:
+            return AppendValuesToBuilder<FloatBuilder, float>(rows_in_batch, builder, input_buffer, valid_bytes);
+        case turbodbc::type_code::integer:
+            return append_to_int_builder(rows_in_batch, builder, input_buffer, valid_bytes, adaptive_integers);
+        case turbodbc::type_code::integer_8:
+            return AppendValuesToBuilder<Int8Builder, int8_t>(rows_in_batch, builder, input_buffer, valid_bytes);
+        case turbodbc::type_code::integer_16:
+            return AppendValuesToBuilder<Int16Builder, int16_t>(rows_in_batch, builder, input_buffer, valid_bytes);
+        case turbodbc::type_code::integer_32:
+            return AppendValuesToBuilder<Int32Builder, int32_t>(rows_in_batch, builder, input_buffer, valid_bytes);
+        case turbodbc::type_code::boolean:
+            return append_to_bool_builder(rows_in_batch, builder, input_buffer, valid_bytes);
+        case turbodbc::type_code::timestamp:
+            return append_to_timestamp_builder(rows_in_batch, builder, input_buffer, valid_bytes);
+        case turbodbc::type_code::timestamp_nanoseconds:
+            return append_int64_values<TimestampBuilder>(turbodbc::timestamps_to_nanoseconds, rows_in_batch, builder, input_buffer, valid_bytes);
+        case turbodbc::type_code::timestamp_offset:
+            return append_int64_values<TimestampBuilder>(turbodbc::timestamp_offsets_to_microseconds, rows_in_batch, builder, input_buffer, valid_bytes);
+        case turbodbc::type_code::timestamp_offset_nanoseconds:
+            return append_int64_values<TimestampBuilder>(turbodbc::timestamp_offsets_to_nanoseconds, rows_in_batch, builder, input_buffer, valid_bytes);
+        case turbodbc::type_code::time:
+            return append_int64_values<Time64Builder>(turbodbc::times_to_nanoseconds, rows_in_batch, builder, input_buffer, valid_bytes);
+        case turbodbc::type_code::date:
+            return append_to_date_builder(rows_in_batch, builder, input_buffer, valid_bytes);
+        case turbodbc::type_code::guid:
+            return append_to_guid_builder(rows_in_batch, builder, input_buffer, valid_bytes);
+        case turbodbc::type_code::decimal:
+            return append_to_decimal_builder(rows_in_batch, builder, input_buffer, valid_bytes);
+        case turbodbc::type_code::rowversion:
+            return append_to_rowversion_builder(rows_in_batch, builder, input_buffer, valid_bytes);
+        case turbodbc::type_code::binary:
+            return AppendBinariesToBuilder(rows_in_batch, static_cast<BinaryBuilder&>(*builder), input_buffer);
+        case turbodbc::type_code::unicode:
+            return append_to_unicode_builder(rows_in_batch, builder, input_buffer, valid_bytes, strings_as_dictionary);
+        default:
+            // Strings are the only remaining type
+            return append_to_string_builder(rows_in_batch, builder, input_buffer, valid_bytes, strings_as_dictionary);
+    }
+}
+
+
 Status arrow_result_set::process_batch(size_t rows_in_batch, std::vector<std::unique_ptr<ArrayBuilder>> const& columns) {
-    // TODO: Use a PoolBuffer for this and only allocate it once
     auto const column_info = base_result_.get_column_info();
     auto const n_columns = column_info.size();
     std::vector<std::reference_wrapper<cpp_odbc::multi_value_buffer const>> const buffers = base_result_.get_buffers();
 
-    std::vector<uint8_t> valid_bytes(rows_in_batch);
-    for (size_t i = 0; i != n_columns; ++i) {
-        auto const indicator_pointer = buffers[i].get().indicator_pointer();
-        for (size_t element = 0; element != rows_in_batch; ++element) {
-            if (indicator_pointer[element] == SQL_NULL_DATA) {
-                valid_bytes[element] = 0;
-            } else {
-                valid_bytes[element] = 1;
+    return for_each_column(column_info, [&](std::size_t i) {
+        auto const valid_bytes = make_valid_bytes(column_info[i].type, buffers[i].get(), rows_in_batch, valid_bytes_[i]);
+        return append_to_builder(column_info[i].type, rows_in_batch, columns[i], buffers[i].get(), valid_bytes, strings_as_dictionary_, adaptive_integers_);
+    });
+}
+
+
+Status arrow_result_set::for_each_column(std::vector<turbodbc::column_info> const & column_info,
+                                         std::function<Status(std::size_t)> const & convert) {
+    auto const n_columns = column_info.size();
+    valid_bytes_.resize(n_columns);
+
+    if (conversion_threads_ < 2 or n_columns < 2) {
+        for (std::size_t i = 0; i != n_columns; ++i) {
+            ARROW_RETURN_NOT_OK(convert(i));
+        }
+        return Status::OK();
+    }
+
+    std::vector<std::size_t> order(n_columns);
+    for (std::size_t i = 0; i != n_columns; ++i) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](std::size_t lhs, std::size_t rhs) {
+        return conversion_cost(column_info[lhs].type) > conversion_cost(column_info[rhs].type);
+    });
+
+    std::vector<Status> results(n_columns);
+    turbodbc::thread_pool::shared().parallel_for(n_columns, conversion_threads_, [&](std::size_t k) {
+        results[order[k]] = convert(order[k]);
+    });
+    for (auto const & result : results) {
+        ARROW_RETURN_NOT_OK(result);
+    }
+    return Status::OK();
+}
+
+
+Status arrow_result_set::fetch_next_batch_native(std::shared_ptr<arrow::RecordBatch>* out)
+{
+    auto const column_info = base_result_.get_column_info();
+    auto const n_columns = column_info.size();
+
+    // Values of these columns are used as they are; adaptive integers need a builder
+    std::vector<bool> native_values(n_columns);
+    for (std::size_t i = 0; i != n_columns; ++i) {
+        native_values[i] = is_zero_copy_column(column_info[i])
+                           and not (adaptive_integers_ and (column_info[i].type == turbodbc::type_code::integer));
+    }
+
+    // The batch size is only known after the first fetch; until then values are copied
+    std::vector<std::shared_ptr<arrow::Buffer>> values(n_columns);
+    std::vector<std::reference_wrapper<cpp_odbc::multi_value_buffer const>> buffers;
+    std::size_t rows_in_batch = 0;
+    {
+        zero_copy_binding binding(base_result_);
+        if (zero_copy_ and (rows_per_batch_ != 0)) {
+            for (std::size_t i = 0; i != n_columns; ++i) {
+                if (native_values[i]) {
+                    ARROW_RETURN_NOT_OK(binding.bind(i, rows_per_batch_, column_info[i].element_size, &values[i]));
+                }
+            }
+        }
+
+        rows_in_batch = base_result_.fetch_next_batch();
+        if (rows_in_batch != 0) {
+            buffers = base_result_.get_buffers();
+            rows_per_batch_ = buffers.front().get().number_of_elements();
+            for (std::size_t i = 0; i != n_columns; ++i) {
+                if (native_values[i] and not binding.is_bound(i)) {
+                    auto const size = rows_in_batch * column_info[i].element_size;
+                    ARROW_ASSIGN_OR_RAISE(values[i], arrow::AllocateBuffer(size, default_memory_pool()));
+                    std::memcpy(values[i]->mutable_data(), buffers[i].get().data_pointer(), size);
+                }
+            }
+        }
+    }
+
+    std::vector<std::shared_ptr<arrow::Array>> arrays(n_columns);
+    ARROW_RETURN_NOT_OK(for_each_column(column_info, [&](std::size_t i) {
+        auto & array = arrays[i];
+        if ((rows_in_batch != 0) and (native_values[i] or is_direct_column(column_info[i]))) {
+            auto const& buffer = buffers[i].get();
+            std::shared_ptr<arrow::Buffer> validity;
+            int64_t null_count = 0;
+            ARROW_RETURN_NOT_OK(make_validity_bitmap(buffer.indicator_pointer(), rows_in_batch, &validity, &null_count));
+            if (not native_values[i]) {
+                ARROW_RETURN_NOT_OK(make_direct_values(column_info[i].type, buffer, rows_in_batch, &values[i]));
+            }
+            auto data = arrow::ArrayData::Make(turbodbc_type_to_arrow(column_info[i]), rows_in_batch,
+                                               {validity, values[i]}, null_count);
+            array = arrow::MakeArray(data);
+        } else {
+            auto builder = make_array_builder(column_info[i], strings_as_dictionary_, adaptive_integers_);
+            if (rows_in_batch != 0) {
+                auto const valid_bytes = make_valid_bytes(column_info[i].type, buffers[i].get(), rows_in_batch, valid_bytes_[i]);
+                ARROW_RETURN_NOT_OK(append_to_builder(column_info[i].type, rows_in_batch, builder, buffers[i].get(), valid_bytes, strings_as_dictionary_, adaptive_integers_));
             }
+            ARROW_RETURN_NOT_OK(builder->Finish(&array));
         }
-        switch (column_info[i].type) {
-            case turbodbc::type_code::floating_point:
-                ARROW_RETURN_NOT_OK(append_to_double_builder(rows_in_batch, columns[i], buffers[i].get(), valid_bytes.data()));
-                break;
-            case turbodbc::type_code::integer:
-                ARROW_RETURN_NOT_OK(append_to_int_builder(rows_in_batch, columns[i], buffers[i].get(), valid_bytes.data(), adaptive_integers_));
-                break;
-            case turbodbc::type_code::boolean:
-                ARROW_RETURN_NOT_OK(append_to_bool_builder(rows_in_batch, columns[i], buffers[i].get(), valid_bytes.data()));
-                break;
-            case turbodbc::type_code::timestamp:
-                ARROW_RETURN_NOT_OK(append_to_timestamp_builder(rows_in_batch, columns[i], buffers[i].get(), valid_bytes.data()));
-                break;
-            case turbodbc::type_code::date:
-                ARROW_RETURN_NOT_OK(append_to_date_builder(rows_in_batch, columns[i], buffers[i].get(), valid_bytes.data()));
-                break;
-            case turbodbc::type_code::unicode:
-                ARROW_RETURN_NOT_OK(append_to_unicode_builder(rows_in_batch, columns[i], buffers[i].get(), valid_bytes.data(), strings_as_dictionary_));
-                break;
-            default:
-                // Strings are the only remaining type
-                ARROW_RETURN_NOT_OK(append_to_string_builder(rows_in_batch, columns[i], buffers[i].get(), valid_bytes.data(), strings_as_dictionary_));
-                break;
+        return Status::OK();
+    }));
+
+    std::vector<std::shared_ptr<arrow::Field>> fields;
+    for (std::size_t i = 0; i != n_columns; ++i) {
+        fields.emplace_back(std::make_shared<arrow::Field>(column_info[i].name, arrays[i]->type(), column_info[i].supports_null_values));
+    }
+
+    *out = arrow::RecordBatch::Make(std::make_shared<arrow::Schema>(fields), rows_in_batch, arrays);
+    return Status::OK();
+}
+
+
+Status arrow_result_set::fetch_all_zero_copy(std::shared_ptr<arrow::Table>* out, bool single_batch)
+{
+    std::vector<std::shared_ptr<arrow::RecordBatch>> batches;
+    std::shared_ptr<arrow::RecordBatch> batch;
+    ARROW_RETURN_NOT_OK(fetch_next_batch_native(&batch));
+    batches.push_back(batch);
+
+    if (not single_batch) {
+        while (batch->num_rows() != 0) {
+            ARROW_RETURN_NOT_OK(fetch_next_batch_native(&batch));
+            if (batch->num_rows() != 0) {
+                batches.push_back(batch);
+            }
         }
     }
+
+    ARROW_ASSIGN_OR_RAISE(*out, arrow::Table::FromRecordBatches(batches.front()->schema(), batches));
     return Status::OK();
 }
 
 
 Status arrow_result_set::fetch_all_native(std::shared_ptr<arrow::Table>* out, bool single_batch)
 {
+    if (zero_copy_ and not adaptive_integers_) {
+        return fetch_all_zero_copy(out, single_batch);
+    }
+
     std::size_t rows_in_batch = base_result_.fetch_next_batch();
     auto const column_info = base_result_.get_column_info();
     auto const n_columns = column_info.size();
@@ -307,7 +928,7 @@ Status arrow_result_set::fetch_all_native(std::shared_ptr<arrow::Table>* out, bo
     // Create Builders for all columns
     std::vector<std::unique_ptr<ArrayBuilder>> columns;
     for (std::size_t i = 0; i != n_columns; ++i) {
-        columns.push_back(make_array_builder(column_info[i].type, strings_as_dictionary_, adaptive_integers_));
+        columns.push_back(make_array_builder(column_info[i], strings_as_dictionary_, adaptive_integers_));
     }
 
     if (single_batch) {
@@ -335,13 +956,82 @@ Status arrow_result_set::fetch_all_native(std::shared_ptr<arrow::Table>* out, bo
 }
 
 
+std::shared_ptr<arrow::RecordBatchReader> arrow_result_set::make_pipelined_record_batch_reader()
+{
+    // All consumers share a single pipeline since it drains the base result set
+    if (not pipeline_) {
+        auto reader = std::make_shared<pipelined_reader>(*this, pipeline_depth_);
+        auto st = reader->first_status();
+        if (not st.ok()) {
+            throw turbodbc::interface_error("Fetching Arrow result set failed.\n" + st.ToString());
+        }
+        pipeline_ = reader;
+    }
+    return pipeline_;
+}
+
+
+Status arrow_result_set::read_pipelined_table(std::shared_ptr<arrow::Table>* out, bool single_batch)
+{
+    auto reader = make_pipelined_record_batch_reader();
+    std::vector<std::shared_ptr<arrow::RecordBatch>> batches;
+    std::shared_ptr<arrow::RecordBatch> batch;
+    do {
+        ARROW_RETURN_NOT_OK(reader->ReadNext(&batch));
+        if (batch) {
+            batches.push_back(batch);
+        }
+    } while (batch and not single_batch);
+
+    auto const schema = batches.empty() ? reader->schema() : batches.front()->schema();
+    ARROW_ASSIGN_OR_RAISE(*out, arrow::Table::FromRecordBatches(schema, batches));
+    return Status::OK();
+}
+
+
+std::shared_ptr<arrow::RecordBatchReader> arrow_result_set::make_record_batch_reader()
+{
+    if (pipeline_depth_ != 0) {
+        return make_pipelined_record_batch_reader();
+    }
+
+    // The first batch determines the schema, e.g. for dictionary-encoded strings
+    std::shared_ptr<arrow::RecordBatch> first_batch;
+    auto st = fetch_next_batch_native(&first_batch);
+    if (not st.ok()) {
+        throw turbodbc::interface_error("Fetching Arrow result set failed.\n" + st.ToString());
+    }
+    return std::make_shared<result_set_reader>(*this, std::move(first_batch));
+}
+
+
+pybind11::object arrow_result_set::export_stream(pybind11::object)
+{
+    // requested_schema is a hint only; the native schema is always exported
+    std::shared_ptr<arrow::RecordBatchReader> reader;
+    {
+        pybind11::gil_scoped_release release;
+        reader = make_record_batch_reader();
+    }
+
+    auto stream = new ArrowArrayStream();
+    auto st = arrow::ExportRecordBatchReader(reader, stream);
+    if (not st.ok()) {
+        delete stream;
+        throw turbodbc::interface_error("Exporting Arrow stream failed.\n" + st.ToString());
+    }
+    return pybind11::capsule(stream, stream_capsule_name, &release_stream_capsule);
+}
+
+
 pybind11::object arrow_result_set::fetch_next_batch()
 {
     std::shared_ptr<arrow::Table> table;
     {
         pybind11::gil_scoped_release release;
-        if (not fetch_all_native(&table, true).ok()) {
-            throw turbodbc::interface_error("Fetching Arrow result set failed.");
+        auto const st = (pipeline_depth_ != 0) ? read_pipelined_table(&table, true) : fetch_all_native(&table, true);
+        if (not st.ok()) {
+            throw turbodbc::interface_error("Fetching Arrow result set failed.\n" + st.ToString());
         }
     }
 
@@ -355,7 +1045,7 @@ pybind11::object arrow_result_set::fetch_all()
     std::shared_ptr<arrow::Table> table;
     {
         pybind11::gil_scoped_release release;
-        auto st = fetch_all_native(&table, false);
+        auto st = (pipeline_depth_ != 0) ? read_pipelined_table(&table, false) : fetch_all_native(&table, false);
         if (not st.ok()) {
             throw turbodbc::interface_error("Fetching Arrow result set failed.\n" + st.ToString());
         }
@@ -0,0 +1,340 @@
+#include <turbodbc_arrow/bulk_copy.h>
+#include <turbodbc_arrow/set_arrow_parameters.h>
+
+#include <cpp_odbc/level3/raii_connection.h>
+
+#include <turbodbc/decimal_helpers.h>
+#include <turbodbc/errors.h>
+#include <turbodbc/sql_server_types.h>
+#include <turbodbc/string_helpers.h>
+#include <turbodbc/time_helpers.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+#include <sqlext.h>
+
+#include <ciso646>
+#include <functional>
+#include <vector>
+
+
+using arrow::BinaryArray;
+using arrow::BooleanArray;
+using arrow::Date32Array;
+using arrow::Date64Array;
+using arrow::Decimal128Array;
+using arrow::Decimal256Array;
+using arrow::DecimalType;
+using arrow::LargeBinaryArray;
+using arrow::NumericArray;
+using arrow::TimestampArray;
+using arrow::TimestampType;
+using arrow::TimeUnit;
+
+namespace turbodbc_arrow {
+
+namespace {
+
+    // bcp_colptr() must never receive a null pointer, not even for NULL values
+    unsigned char const null_placeholder = 0;
+
+    /**
+     * @brief Pointers to and lengths of all values of a column in the current
+     *        record batch. Values which the driver cannot read from the Arrow
+     *        buffers directly are converted into the staging area.
+     */
+    struct column_values {
+        std::vector<unsigned char const *> data;
+        std::vector<SQLINTEGER> lengths;
+        std::vector<unsigned char> staging;
+
+        void resize(int64_t n_values, std::size_t staging_size)
+        {
+            data.resize(n_values);
+            lengths.resize(n_values);
+            staging.resize(staging_size);
+        }
+
+        void set(int64_t i, arrow::Array const & array, unsigned char const * value, SQLINTEGER length)
+        {
+            if (array.IsValid(i)) {
+                data[i] = (value != nullptr) ? value : &null_placeholder;
+                lengths[i] = length;
+            } else {
+                data[i] = &null_placeholder;
+                lengths[i] = SQL_NULL_DATA;
+            }
+        }
+    };
+
+    struct column_binding {
+        int data_type;
+        std::function<void(arrow::Array const &, column_values &)> fill;
+    };
+
+    template <typename ArrayType>
+    void fill_fixed_width(arrow::Array const & array, column_values & values)
+    {
+        auto const & typed_array = static_cast<ArrayType const &>(array);
+        SQLINTEGER const size = sizeof(typename ArrayType::value_type);
+        auto const raw_values = reinterpret_cast<unsigned char const *>(typed_array.raw_values());
+        values.resize(array.length(), 0);
+        for (int64_t i = 0; i != array.length(); ++i) {
+            values.set(i, array, raw_values + i * size, size);
+        }
+    }
+
+    template <typename ArrayType, typename Target>
+    void fill_widened(arrow::Array const & array, column_values & values)
+    {
+        auto const & typed_array = static_cast<ArrayType const &>(array);
+        SQLINTEGER const size = sizeof(Target);
+        values.resize(array.length(), array.length() * size);
+        auto const widened = reinterpret_cast<Target *>(values.staging.data());
+        for (int64_t i = 0; i != array.length(); ++i) {
+            widened[i] = typed_array.Value(i);
+            values.set(i, array, values.staging.data() + i * size, size);
+        }
+    }
+
+    void fill_booleans(arrow::Array const & array, column_values & values)
+    {
+        auto const & typed_array = static_cast<BooleanArray const &>(array);
+        values.resize(array.length(), array.length());
+        for (int64_t i = 0; i != array.length(); ++i) {
+            values.staging[i] = typed_array.Value(i) ? 1 : 0;
+            values.set(i, array, values.staging.data() + i, 1);
+        }
+    }
+
+    template <typename ArrayType>
+    void fill_utf8_strings(arrow::Array const & array, column_values & values)
+    {
+        auto const & typed_array = static_cast<ArrayType const &>(array);
+        // a UTF-8 sequence never yields more UTF-16 code units than it has bytes
+        auto const total_bytes = typed_array.value_offset(array.length()) - typed_array.value_offset(0);
+        values.resize(array.length(), total_bytes * sizeof(char16_t));
+        auto const staging = reinterpret_cast<char16_t *>(values.staging.data());
+        std::size_t written = 0;
+        for (int64_t i = 0; i != array.length(); ++i) {
+            auto const value = typed_array.GetView(i);
+            auto const units = array.IsValid(i) ? turbodbc::utf8_to_utf16(value.data(), value.size(), staging + written) : 0;
+            values.set(i, array, reinterpret_cast<unsigned char const *>(staging + written), units * sizeof(char16_t));
+            written += units;
+        }
+    }
+
+    template <typename ArrayType>
+    void fill_binaries(arrow::Array const & array, column_values & values)
+    {
+        auto const & typed_array = static_cast<ArrayType const &>(array);
+        values.resize(array.length(), 0);
+        for (int64_t i = 0; i != array.length(); ++i) {
+            auto const value = typed_array.GetView(i);
+            values.set(i, array, reinterpret_cast<unsigned char const *>(value.data()), value.size());
+        }
+    }
+
+    template <typename ArrayType, typename Source, typename Target>
+    void fill_structs(arrow::Array const & array, column_values & values,
+                      void (*convert)(Source const *, std::size_t, char *))
+    {
+        auto const & typed_array = static_cast<ArrayType const &>(array);
+        SQLINTEGER const size = sizeof(Target);
+        values.resize(array.length(), array.length() * size);
+        convert(typed_array.raw_values(), array.length(), reinterpret_cast<char *>(values.staging.data()));
+        for (int64_t i = 0; i != array.length(); ++i) {
+            values.set(i, array, values.staging.data() + i * size, size);
+        }
+    }
+
+    column_binding make_timestamp_binding(TimestampType const & type)
+    {
+        using convert_function = void (*)(int64_t const *, std::size_t, char *);
+        convert_function convert = turbodbc::microseconds_to_timestamps;
+        switch (type.unit()) {
+            case TimeUnit::SECOND: convert = turbodbc::seconds_to_timestamps; break;
+            case TimeUnit::MILLI: convert = turbodbc::milliseconds_to_timestamps; break;
+            case TimeUnit::MICRO: convert = turbodbc::microseconds_to_timestamps; break;
+            case TimeUnit::NANO: convert = turbodbc::nanoseconds_to_timestamps; break;
+        }
+        return {turbodbc::bcp_types::datetime2, [convert](arrow::Array const & array, column_values & values) {
+            fill_structs<TimestampArray, int64_t, SQL_TIMESTAMP_STRUCT>(array, values, convert);
+        }};
+    }
+
+    template <typename ArrayType>
+    column_binding make_decimal_binding(DecimalType const & type,
+                                        void (*convert)(uint8_t const *, std::size_t, int, int, char *))
+    {
+        if (type.precision() > 38) {
+            throw turbodbc::interface_error("Decimal precision " + std::to_string(type.precision()) +
+                                            " exceeds the maximum precision 38 of SQL Server");
+        }
+        auto const precision = type.precision();
+        auto const scale = type.scale();
+        return {turbodbc::bcp_types::numeric, [precision, scale, convert](arrow::Array const & array, column_values & values) {
+            auto const & typed_array = static_cast<ArrayType const &>(array);
+            SQLINTEGER const size = sizeof(SQL_NUMERIC_STRUCT);
+            values.resize(array.length(), array.length() * size);
+            convert(typed_array.raw_values(), array.length(), precision, scale,
+                    reinterpret_cast<char *>(values.staging.data()));
+            for (int64_t i = 0; i != array.length(); ++i) {
+                values.set(i, array, values.staging.data() + i * size, size);
+            }
+        }};
+    }
+
+    column_binding make_binding(arrow::DataType const & type)
+    {
+        switch (type.id()) {
+            case arrow::Type::BOOL:
+                return {turbodbc::bcp_types::bit, fill_booleans};
+            case arrow::Type::INT8:
+                // SQL Server's tinyint is unsigned
+                return {turbodbc::bcp_types::smallint, fill_widened<NumericArray<arrow::Int8Type>, int16_t>};
+            case arrow::Type::UINT8:
+                return {turbodbc::bcp_types::tinyint, fill_fixed_width<NumericArray<arrow::UInt8Type>>};
+            case arrow::Type::INT16:
+                return {turbodbc::bcp_types::smallint, fill_fixed_width<NumericArray<arrow::Int16Type>>};
+            case arrow::Type::UINT16:
+                return {turbodbc::bcp_types::integer, fill_widened<NumericArray<arrow::UInt16Type>, int32_t>};
+            case arrow::Type::INT32:
+                return {turbodbc::bcp_types::integer, fill_fixed_width<NumericArray<arrow::Int32Type>>};
+            case arrow::Type::UINT32:
+                return {turbodbc::bcp_types::bigint, fill_widened<NumericArray<arrow::UInt32Type>, int64_t>};
+            case arrow::Type::INT64:
+                return {turbodbc::bcp_types::bigint, fill_fixed_width<NumericArray<arrow::Int64Type>>};
+            case arrow::Type::UINT64:
+                return {turbodbc::bcp_types::numeric, [](arrow::Array const & array, column_values & values) {
+                    fill_structs<NumericArray<arrow::UInt64Type>, uint64_t, SQL_NUMERIC_STRUCT>(array, values, turbodbc::uint64_to_numerics);
+                }};
+            case arrow::Type::FLOAT:
+                return {turbodbc::bcp_types::real, fill_fixed_width<NumericArray<arrow::FloatType>>};
+            case arrow::Type::DOUBLE:
+                return {turbodbc::bcp_types::float_, fill_fixed_width<NumericArray<arrow::DoubleType>>};
+            case arrow::Type::STRING:
+                return {turbodbc::bcp_types::nvarchar, fill_utf8_strings<BinaryArray>};
+            case arrow::Type::LARGE_STRING:
+                return {turbodbc::bcp_types::nvarchar, fill_utf8_strings<LargeBinaryArray>};
+            case arrow::Type::BINARY:
+                return {turbodbc::bcp_types::varbinary, fill_binaries<BinaryArray>};
+            case arrow::Type::LARGE_BINARY:
+                return {turbodbc::bcp_types::varbinary, fill_binaries<LargeBinaryArray>};
+            case arrow::Type::DATE32:
+                return {turbodbc::bcp_types::date, [](arrow::Array const & array, column_values & values) {
+                    fill_structs<Date32Array, int32_t, SQL_DATE_STRUCT>(array, values, turbodbc::days_to_dates);
+                }};
+            case arrow::Type::DATE64:
+                return {turbodbc::bcp_types::date, [](arrow::Array const & array, column_values & values) {
+                    fill_structs<Date64Array, int64_t, SQL_DATE_STRUCT>(array, values, turbodbc::milliseconds_to_dates);
+                }};
+            case arrow::Type::TIMESTAMP:
+                return make_timestamp_binding(static_cast<TimestampType const &>(type));
+            case arrow::Type::DECIMAL128:
+                return make_decimal_binding<Decimal128Array>(static_cast<DecimalType const &>(type), turbodbc::decimal128_to_numerics);
+            case arrow::Type::DECIMAL256:
+                return make_decimal_binding<Decimal256Array>(static_cast<DecimalType const &>(type), turbodbc::decimal256_to_numerics);
+            default:
+                throw turbodbc::interface_error("Unsupported type for bulk copy: " + type.ToString());
+        }
+    }
+
+    std::size_t copy_batches(cpp_odbc::level2::api const & api,
+                             cpp_odbc::level2::bulk_copy_handle const & handle,
+                             std::vector<column_binding> const & bindings,
+                             arrow::RecordBatchReader & reader,
+                             std::size_t batch_size)
+    {
+        std::vector<column_values> columns(bindings.size());
+        std::size_t copied_rows = 0;
+        std::size_t uncommitted_rows = 0;
+
+        std::shared_ptr<arrow::RecordBatch> batch;
+        while (true) {
+            auto const status = reader.ReadNext(&batch);
+            if (not status.ok()) {
+                throw turbodbc::interface_error("Reading Arrow record batch failed.\n" + status.ToString());
+            }
+            if (batch == nullptr) {
+                break;
+            }
+
+            for (std::size_t c = 0; c != bindings.size(); ++c) {
+                bindings[c].fill(*batch->column(c), columns[c]);
+            }
+
+            for (int64_t row = 0; row != batch->num_rows(); ++row) {
+                for (std::size_t c = 0; c != columns.size(); ++c) {
+                    api.set_bulk_copy_column_data(handle, c + 1, columns[c].data[row], columns[c].lengths[row]);
+                }
+                api.send_bulk_copy_row(handle);
+                ++uncommitted_rows;
+                if (uncommitted_rows == batch_size) {
+                    copied_rows += api.commit_bulk_copy_batch(handle);
+                    uncommitted_rows = 0;
+                }
+            }
+        }
+
+        return copied_rows + api.finish_bulk_copy(handle);
+    }
+
+}
+
+std::size_t bulk_copy_record_batches(cpp_odbc::level2::api const & api,
+                                     cpp_odbc::level2::connection_handle const & connection,
+                                     std::u16string const & table,
+                                     arrow::RecordBatchReader & reader,
+                                     std::size_t batch_size,
+                                     bool table_lock)
+{
+    auto const schema = reader.schema();
+    std::vector<column_binding> bindings;
+    for (auto const & field : schema->fields()) {
+        bindings.push_back(make_binding(*field->type()));
+    }
+
+    auto const handle = api.initialize_bulk_copy(connection, table);
+    try {
+        if (table_lock) {
+            api.set_bulk_copy_hints(handle, u"TABLOCK");
+        }
+        for (std::size_t c = 0; c != bindings.size(); ++c) {
+            api.bind_bulk_copy_column(handle, c + 1, bindings[c].data_type);
+        }
+        return copy_batches(api, handle, bindings, reader, batch_size);
+    } catch (...) {
+        // bcp_done() alone would commit the rows sent since the last batch, so abort
+        // first; batches committed before the failure remain in the table
+        try {
+            api.set_bulk_copy_option(handle, turbodbc::bcp_abort, 1);
+        } catch (std::exception const &) {
+        }
+        // end the operation so that the connection remains usable
+        try {
+            api.finish_bulk_copy(handle);
+        } catch (std::exception const &) {
+        }
+        throw;
+    }
+}
+
+std::size_t bulk_copy_arrow_stream(turbodbc::cursor & cursor, std::string const & table,
+                                   pybind11::object const & source, std::size_t batch_size,
+                                   bool table_lock)
+{
+    auto const connection = std::dynamic_pointer_cast<cpp_odbc::level3::raii_connection const>(cursor.get_connection());
+    if (connection == nullptr) {
+        throw turbodbc::interface_error("Bulk copy requires a connection to an ODBC data source");
+    }
+    std::u16string wide_table(table.size(), u'\0');
+    wide_table.resize(turbodbc::utf8_to_utf16(table.data(), table.size(), &wide_table[0]));
+
+    auto reader = import_arrow_stream(source);
+    pybind11::gil_scoped_release release;
+    return bulk_copy_record_batches(*connection->get_api(), connection->get_handle(), wide_table, *reader, batch_size, table_lock);
+}
+
+}
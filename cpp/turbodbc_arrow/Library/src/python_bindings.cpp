@@ -1,8 +1,11 @@
 #include <turbodbc_arrow/arrow_result_set.h>
+#include <turbodbc_arrow/bulk_copy.h>
 #include <turbodbc_arrow/set_arrow_parameters.h>
+#include <turbodbc_arrow/sharded_insert.h>
 #include <turbodbc/cursor.h>
 
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 
 using turbodbc_arrow::arrow_result_set;
 
@@ -11,7 +14,26 @@ namespace {
 arrow_result_set make_arrow_result_set(std::shared_ptr<turbodbc::result_sets::result_set> result_set_pointer,
     bool strings_as_dictionary, bool adaptive_integers)
 {
-	return arrow_result_set(*result_set_pointer, strings_as_dictionary, adaptive_integers);
+	return arrow_result_set(result_set_pointer, strings_as_dictionary, adaptive_integers, false, 1, 0);
+}
+
+arrow_result_set make_zero_copy_arrow_result_set(std::shared_ptr<turbodbc::result_sets::result_set> result_set_pointer,
+    bool strings_as_dictionary, bool adaptive_integers, bool zero_copy)
+{
+	return arrow_result_set(result_set_pointer, strings_as_dictionary, adaptive_integers, zero_copy, 1, 0);
+}
+
+arrow_result_set make_parallel_arrow_result_set(std::shared_ptr<turbodbc::result_sets::result_set> result_set_pointer,
+    bool strings_as_dictionary, bool adaptive_integers, bool zero_copy, std::size_t conversion_threads)
+{
+	return arrow_result_set(result_set_pointer, strings_as_dictionary, adaptive_integers, zero_copy, conversion_threads, 0);
+}
+
+arrow_result_set make_pipelined_arrow_result_set(std::shared_ptr<turbodbc::result_sets::result_set> result_set_pointer,
+    bool strings_as_dictionary, bool adaptive_integers, bool zero_copy, std::size_t conversion_threads,
+    std::size_t pipeline_depth)
+{
+	return arrow_result_set(result_set_pointer, strings_as_dictionary, adaptive_integers, zero_copy, conversion_threads, pipeline_depth);
 }
 
 void set_arrow_parameters(turbodbc::cursor & cursor, pybind11::object const & pyarrow_table)
@@ -27,8 +49,27 @@ PYBIND11_MODULE(turbodbc_arrow_support, module)
 
     pybind11::class_<arrow_result_set>(module, "ArrowResultSet")
         .def("fetch_all", &arrow_result_set::fetch_all)
-        .def("fetch_next_batch", &arrow_result_set::fetch_next_batch);
+        .def("fetch_next_batch", &arrow_result_set::fetch_next_batch)
+        .def("__arrow_c_stream__", &arrow_result_set::export_stream, pybind11::arg("requested_schema") = pybind11::none());
 
     module.def("make_arrow_result_set", make_arrow_result_set);
+    module.def("make_arrow_result_set", make_zero_copy_arrow_result_set);
+    module.def("make_arrow_result_set", make_parallel_arrow_result_set);
+    module.def("make_arrow_result_set", make_pipelined_arrow_result_set);
     module.def("set_arrow_parameters", set_arrow_parameters);
+    module.def("insert_arrow_stream", turbodbc_arrow::insert_arrow_stream,
+               pybind11::arg("cursor"), pybind11::arg("source"), pybind11::arg("commit_every") = 0);
+    module.def("insert_arrow_table_parameter", turbodbc_arrow::insert_arrow_table_parameter,
+               pybind11::arg("cursor"), pybind11::arg("table_type_name"), pybind11::arg("source"));
+    pybind11::class_<turbodbc_arrow::shard_result>(module, "ShardResult")
+        .def_readonly("transferred_sets", &turbodbc_arrow::shard_result::transferred_sets)
+        .def_readonly("error", &turbodbc_arrow::shard_result::error);
+
+    module.def("insert_arrow_sharded", turbodbc_arrow::insert_arrow_sharded,
+               pybind11::arg("connection_string"), pybind11::arg("options"), pybind11::arg("sql"),
+               pybind11::arg("source"), pybind11::arg("workers"),
+               pybind11::arg("key_columns") = std::vector<std::string>(), pybind11::arg("commit_every") = 0);
+    module.def("bulk_copy_arrow_stream", turbodbc_arrow::bulk_copy_arrow_stream,
+               pybind11::arg("cursor"), pybind11::arg("table"), pybind11::arg("source"),
+               pybind11::arg("batch_size") = 0, pybind11::arg("table_lock") = true);
 }
@@ -1,9 +1,17 @@
 #include <turbodbc_arrow/set_arrow_parameters.h>
 
+#include <arrow/c/abi.h>
+#include <arrow/c/bridge.h>
 #include <arrow/python/pyarrow.h>
 
+#include <turbodbc/bounded_queue.h>
+#include <turbodbc/decimal_helpers.h>
+#include <turbodbc/descriptions/decimal_description.h>
 #include <turbodbc/errors.h>
+#include <turbodbc/indicator_helpers.h>
 #include <turbodbc/make_description.h>
+#include <turbodbc/sql_server_types.h>
+#include <turbodbc/string_helpers.h>
 #include <turbodbc/time_helpers.h>
 
 #ifdef _WIN32
@@ -11,15 +19,29 @@
 #endif
 #include <sql.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <ciso646>
+#include <deque>
+#include <exception>
+#include <thread>
 
-#include <boost/locale.hpp>
 
 using arrow::BooleanArray;
 using arrow::BinaryArray;
 using arrow::ChunkedArray;
 using arrow::Date32Array;
+using arrow::Date64Array;
+using arrow::Decimal128Array;
+using arrow::Decimal256Array;
+using arrow::DecimalType;
+using arrow::DictionaryArray;
+using arrow::DictionaryType;
 using arrow::DoubleType;
+using arrow::FixedSizeBinaryArray;
+using arrow::FloatType;
+using arrow::HalfFloatArray;
 using arrow::Int8Type;
 using arrow::Int16Type;
 using arrow::Int32Type;
@@ -28,9 +50,14 @@ using arrow::UInt8Type;
 using arrow::UInt16Type;
 using arrow::UInt32Type;
 using arrow::UInt64Type;
+using arrow::LargeBinaryArray;
 using arrow::NumericArray;
 using arrow::StringArray;
 using arrow::Table;
+using arrow::Time32Array;
+using arrow::Time32Type;
+using arrow::Time64Array;
+using arrow::Time64Type;
 using arrow::TimestampArray;
 using arrow::TimestampType;
 using arrow::TimeUnit;
@@ -46,27 +73,94 @@ namespace {
                             std::size_t parameter_index) :
             data(data),
             parameters(parameters),
-            parameter_index(parameter_index)
+            parameter_index(parameter_index),
+            chunk_index(0),
+            chunk_begin(0)
         {}
 
+        /**
+         * @brief Convert values of another column with the same type
+         */
+        void set_data(std::shared_ptr<ChunkedArray> const & new_data) {
+            data = new_data;
+            chunk_index = 0;
+            chunk_begin = 0;
+        }
+
         cpp_odbc::multi_value_buffer & get_buffer() {
             return parameters.get_parameters()[parameter_index]->get_buffer();
         }
 
-        template <size_t element_size>
-        void set_indicator(cpp_odbc::multi_value_buffer & buffer, int64_t start, int64_t elements) {
-            // Currently only non-chunked columns are supported
-            arrow::Array const& chunk = *data->chunk(0);
-            if (chunk.null_count() == 0) {
-              std::fill_n(buffer.indicator_pointer(), elements, element_size);
-            } else if (chunk.null_count() == chunk.length()) {
-              std::fill_n(buffer.indicator_pointer(), elements, SQL_NULL_DATA);
-            } else {
-              auto const indicator = buffer.indicator_pointer();
-              for (int64_t i = 0; i != elements; ++i) {
-                indicator[i] = chunk.IsNull(start + i) ? SQL_NULL_DATA : element_size;
-              }
+        /**
+         * @brief Call function(chunk, chunk_start, offset, count) for all chunks
+         *        which overlap the rows [start, start + elements) of the column.
+         *        chunk_start is the first row within the chunk, offset is the
+         *        first row within the parameter batch. Batches may span chunk
+         *        boundaries, so no chunks need to be concatenated.
+         */
+        template <typename Function>
+        void for_each_chunk(int64_t start, int64_t elements, Function && function) {
+            // Batches are usually requested in ascending order, so the search
+            // for the first chunk resumes where the previous batch started
+            if (start < chunk_begin) {
+                chunk_index = 0;
+                chunk_begin = 0;
             }
+            // chunks ending before start are skipped; empty batches may start
+            // past the last chunk
+            while ((chunk_index < data->num_chunks()) and (start >= chunk_begin + data->chunk(chunk_index)->length())) {
+                chunk_begin += data->chunk(chunk_index)->length();
+                ++chunk_index;
+            }
+
+            auto index = chunk_index;
+            auto begin = chunk_begin;
+            int64_t offset = 0;
+            while (offset != elements) {
+                arrow::Array const & chunk = *data->chunk(index);
+                auto const chunk_start = start + offset - begin;
+                auto const count = std::min(elements - offset, chunk.length() - chunk_start);
+                function(chunk, chunk_start, offset, count);
+                offset += count;
+                begin += chunk.length();
+                ++index;
+            }
+        }
+
+        /**
+         * @brief Set the indicators of rows [start, start + elements) to
+         *        valid_indicator or SQL_NULL_DATA according to the validity
+         *        bitmaps of the overlapping chunks
+         */
+        void set_indicator(cpp_odbc::multi_value_buffer & buffer, int64_t start, int64_t elements, intptr_t valid_indicator) {
+            for_each_chunk(start, elements, [&](arrow::Array const & chunk, int64_t chunk_start, int64_t offset, int64_t count) {
+              auto const indicator = buffer.indicator_pointer() + offset;
+              if (chunk.null_count() == 0) {
+                std::fill_n(indicator, count, valid_indicator);
+              } else if (chunk.null_count() == chunk.length()) {
+                std::fill_n(indicator, count, SQL_NULL_DATA);
+              } else {
+                turbodbc::validity_bitmap_to_indicators(chunk.null_bitmap_data(), chunk.offset() + chunk_start, count,
+                                                        valid_indicator, indicator);
+              }
+            });
+        }
+
+        /**
+         * @brief Largest value length within rows [start, start + elements) of a
+         *        string or binary column. Null slots are not skipped; they
+         *        usually have zero length and at worst overestimate the maximum.
+         */
+        template <typename ArrayType>
+        std::size_t maximum_value_length(int64_t start, int64_t elements) {
+            std::size_t maximum_length = 0;
+            for_each_chunk(start, elements, [&](arrow::Array const & chunk, int64_t chunk_start, int64_t, int64_t count) {
+              auto const & array = static_cast<const ArrayType&>(chunk);
+              for (int64_t i = 0; i != count; ++i) {
+                maximum_length = std::max(maximum_length, array.GetView(chunk_start + i).size());
+              }
+            });
+            return maximum_length;
         }
 
         virtual void set_batch(int64_t start, int64_t elements) = 0;
@@ -76,6 +170,8 @@ namespace {
         std::shared_ptr<ChunkedArray> data;
         turbodbc::bound_parameter_set & parameters;
         std::size_t const parameter_index;
+        int chunk_index;
+        int64_t chunk_begin;
     };
 
     struct null_converter : public parameter_converter {
@@ -87,6 +183,8 @@ namespace {
       }
     };
 
+    // ArrayType is BinaryArray for utf8 and LargeBinaryArray for large_utf8 columns
+    template <typename ArrayType>
     struct string_converter : public parameter_converter {
       string_converter(std::shared_ptr<ChunkedArray> const & data,
           turbodbc::bound_parameter_set & parameters,
@@ -95,74 +193,60 @@ namespace {
         type(parameters.get_initial_parameter_types()[parameter_index])
       {}
 
-      void rebind_to_maximum_length(BinaryArray const & array, std::size_t start, std::size_t elements)
+      void set_batch_utf8(std::size_t start, std::size_t elements)
       {
-          int32_t maximum_length = 0;
-          for (int64_t i = 0; i != elements; ++i) {
-            if (!array.IsNull(start + i)) {
-              maximum_length = std::max(maximum_length, array.value_length(start + i));
-            }
-          }
-
-          // Propagate the maximum string length to the parameters.
-          // These then adjust the size of the underlying buffer.
-          parameters.rebind(parameter_index, turbodbc::make_description(type, maximum_length));
-      }
+        // Propagate the maximum string length to the parameters.
+        // These only grow the underlying buffer if it is too small.
+        parameters.ensure_capacity(parameter_index, type, maximum_value_length<ArrayType>(start, elements));
+        auto & buffer = get_buffer();
 
-      template <typename String>
-        void set_batch_of_type(std::size_t start, std::size_t elements)
-        {
-          // Currently only non-chunked columns are supported
-          auto const& typed_array = static_cast<const BinaryArray&>(*data->chunk(0));
-          rebind_to_maximum_length(typed_array, start, elements);
-          auto & buffer = get_buffer();
-          auto const character_size = sizeof(typename String::value_type);
-
-          for (int64_t i = 0; i != elements; ++i) {
-            auto element = buffer[i];
-            if (typed_array.IsNull(start + i)) {
-              element.indicator = SQL_NULL_DATA;
-            } else {
-              int32_t out_length;
-              uint8_t const *value = typed_array.GetValue(start + i, &out_length);
-              std::memcpy(element.data_pointer, value, out_length);
-              element.indicator = character_size * out_length;
+        set_indicator(buffer, start, elements, 0);
+        for_each_chunk(start, elements, [&](arrow::Array const & chunk, int64_t chunk_start, int64_t offset, int64_t count) {
+          auto const& typed_array = static_cast<const ArrayType&>(chunk);
+          for (int64_t i = 0; i != count; ++i) {
+            auto element = buffer[offset + i];
+            if (element.indicator != SQL_NULL_DATA) {
+              auto const value = typed_array.GetView(chunk_start + i);
+              std::memcpy(element.data_pointer, value.data(), value.size());
+              element.indicator = value.size();
             }
           }
-        }
+        });
+      }
 
-      // Parse UTF-16 data and convert it on-the-fly to UTF-8
+      // Transcode UTF-8 data straight into the UTF-16 parameter buffer:
+      // the first pass sizes the buffer, the second fills it
       void set_batch_utf16(std::size_t start, std::size_t elements)
       {
-        auto const& typed_array = static_cast<const BinaryArray&>(*data->chunk(0));
-        std::vector<std::pair<bool, std::u16string>> batch;
-        size_t maximum_length = 0;
-        for (int64_t i = 0; i != elements; ++i) {
-          if (!typed_array.IsNull(start + i)) {
-            std::u16string str = boost::locale::conv::utf_to_utf<char16_t>(typed_array.GetString(start + i));
-            maximum_length = std::max(maximum_length, str.length());
-            batch.push_back({false, str});
-          } else {
-            batch.push_back({true, std::u16string()});
+        std::size_t maximum_length = 0;
+        for_each_chunk(start, elements, [&](arrow::Array const & chunk, int64_t chunk_start, int64_t, int64_t count) {
+          auto const& typed_array = static_cast<const ArrayType&>(chunk);
+          for (int64_t i = 0; i != count; ++i) {
+            auto const value = typed_array.GetView(chunk_start + i);
+            maximum_length = std::max(maximum_length, turbodbc::utf8_to_utf16_length(value.data(), value.size()));
           }
-        }
+        });
 
         // Propagate the maximum string length to the parameters.
-        // These then adjust the size of the underlying buffer.
-        parameters.rebind(parameter_index, turbodbc::make_description(type, maximum_length));
+        // These only grow the underlying buffer if it is too small.
+        parameters.ensure_capacity(parameter_index, type, maximum_length);
         auto & buffer = get_buffer();
-        auto const character_size = sizeof(typename std::u16string::value_type);
+        auto const character_size = sizeof(char16_t);
 
-        for (std::size_t i = 0; i != batch.size(); ++i) {
-            auto element = buffer[i];
-            if (batch[i].first) {
-                element.indicator = SQL_NULL_DATA;
-            } else {
-                auto const & s = batch[i].second;
-                std::memcpy(element.data_pointer, s.c_str(), character_size * (s.size() + 1));
-                element.indicator = character_size * s.size();
+        set_indicator(buffer, start, elements, 0);
+        for_each_chunk(start, elements, [&](arrow::Array const & chunk, int64_t chunk_start, int64_t offset, int64_t count) {
+          auto const& typed_array = static_cast<const ArrayType&>(chunk);
+          for (int64_t i = 0; i != count; ++i) {
+            auto element = buffer[offset + i];
+            if (element.indicator != SQL_NULL_DATA) {
+              auto const value = typed_array.GetView(chunk_start + i);
+              auto const destination = reinterpret_cast<char16_t *>(element.data_pointer);
+              auto const units = turbodbc::utf8_to_utf16(value.data(), value.size(), destination);
+              destination[units] = 0;
+              element.indicator = character_size * units;
             }
-        }
+          }
+        });
       }
 
       void set_batch(int64_t start, int64_t elements) final
@@ -170,7 +254,7 @@ namespace {
         if (type == turbodbc::type_code::unicode) {
           set_batch_utf16(start, elements);
         } else {
-          set_batch_of_type<std::string>(start, elements);
+          set_batch_utf8(start, elements);
         }
       }
 
@@ -178,6 +262,141 @@ namespace {
       turbodbc::type_code type;
     };
 
+    // Dictionary-encoded strings: every dictionary entry is encoded once for
+    // the target type and then copied to the rows by index. ValueArrayType is
+    // BinaryArray for utf8 and LargeBinaryArray for large_utf8 dictionaries.
+    template <typename ValueArrayType>
+    struct dictionary_string_converter : public parameter_converter {
+      dictionary_string_converter(std::shared_ptr<ChunkedArray> const & data,
+          turbodbc::bound_parameter_set & parameters,
+          std::size_t parameter_index) :
+        parameter_converter(data, parameters, parameter_index),
+        type(parameters.get_initial_parameter_types()[parameter_index]),
+        character_size(type == turbodbc::type_code::unicode ? sizeof(char16_t) : sizeof(char))
+      {}
+
+      void set_batch(int64_t start, int64_t elements) final
+      {
+        std::size_t maximum_length = 0;
+        for_each_chunk(start, elements, [&](arrow::Array const & chunk, int64_t chunk_start, int64_t, int64_t count) {
+          auto const & entries = encode_dictionary(chunk);
+          auto const & typed_array = static_cast<const DictionaryArray&>(chunk);
+          auto const n_entries = static_cast<int64_t>(entries.is_null.size());
+          for (int64_t i = 0; i != count; ++i) {
+            // indices behind null slots are arbitrary and may be out of range
+            auto const index = typed_array.GetValueIndex(chunk_start + i);
+            if ((index >= 0) and (index < n_entries)) {
+              maximum_length = std::max(maximum_length, entries.offsets[index + 1] - entries.offsets[index]);
+            }
+          }
+        });
+
+        // Propagate the maximum string length to the parameters.
+        // These only grow the underlying buffer if it is too small.
+        parameters.ensure_capacity(parameter_index, type, maximum_length / character_size);
+        auto & buffer = get_buffer();
+
+        set_indicator(buffer, start, elements, 0);
+        for_each_chunk(start, elements, [&](arrow::Array const & chunk, int64_t chunk_start, int64_t offset, int64_t count) {
+          auto const & entries = encode_dictionary(chunk);
+          auto const & typed_array = static_cast<const DictionaryArray&>(chunk);
+          auto const n_entries = static_cast<int64_t>(entries.is_null.size());
+          for (int64_t i = 0; i != count; ++i) {
+            auto element = buffer[offset + i];
+            if (element.indicator != SQL_NULL_DATA) {
+              auto const index = typed_array.GetValueIndex(chunk_start + i);
+              if ((index < 0) or (index >= n_entries)) {
+                std::ostringstream message;
+                message << "Dictionary index " << index << " of column " << (parameter_index + 1);
+                message << " is out of range for a dictionary with " << n_entries << " entries";
+                throw turbodbc::interface_error(message.str());
+              }
+              if (entries.is_null[index]) {
+                element.indicator = SQL_NULL_DATA;
+              } else {
+                auto const size = entries.offsets[index + 1] - entries.offsets[index];
+                std::memcpy(element.data_pointer, entries.bytes.data() + entries.offsets[index], size);
+                std::memset(element.data_pointer + size, 0, character_size);
+                element.indicator = size;
+              }
+            }
+          }
+        });
+      }
+
+      private:
+      struct encoded_entries {
+        std::vector<char> bytes;
+        std::vector<std::size_t> offsets;
+        std::vector<uint8_t> is_null;
+      };
+
+      /**
+       * @brief Return the entries of the chunk's dictionary encoded for the
+       *        target type. Chunks usually share their dictionary, so only the
+       *        most recently used one is kept.
+       */
+      encoded_entries const & encode_dictionary(arrow::Array const & chunk)
+      {
+        auto const & dictionary = static_cast<const DictionaryArray&>(chunk).dictionary();
+        if (dictionary == encoded_dictionary) {
+          return entries;
+        }
+
+        auto const & values = static_cast<const ValueArrayType&>(*dictionary);
+        entries.bytes.clear();
+        entries.offsets.assign(1, 0);
+        entries.is_null.assign(values.length(), 0);
+        for (int64_t k = 0; k != values.length(); ++k) {
+          if (values.IsNull(k)) {
+            entries.is_null[k] = 1;
+          } else {
+            auto const value = values.GetView(k);
+            auto const position = entries.bytes.size();
+            if (type == turbodbc::type_code::unicode) {
+              entries.bytes.resize(position + character_size * turbodbc::utf8_to_utf16_length(value.data(), value.size()));
+              turbodbc::utf8_to_utf16(value.data(), value.size(), reinterpret_cast<char16_t *>(entries.bytes.data() + position));
+            } else {
+              entries.bytes.insert(entries.bytes.end(), value.begin(), value.end());
+            }
+          }
+          entries.offsets.push_back(entries.bytes.size());
+        }
+        encoded_dictionary = dictionary;
+        return entries;
+      }
+
+      turbodbc::type_code type;
+      std::size_t const character_size;
+      std::shared_ptr<arrow::Array> encoded_dictionary;
+      encoded_entries entries;
+    };
+
+    // ArrayType is BinaryArray, LargeBinaryArray, or FixedSizeBinaryArray
+    template <typename ArrayType>
+    struct binary_converter : public parameter_converter {
+      using parameter_converter::parameter_converter;
+
+      void set_batch(int64_t start, int64_t elements) final
+      {
+        parameters.ensure_capacity(parameter_index, turbodbc::type_code::binary, maximum_value_length<ArrayType>(start, elements));
+
+        auto & buffer = get_buffer();
+        set_indicator(buffer, start, elements, 0);
+        for_each_chunk(start, elements, [&](arrow::Array const & chunk, int64_t chunk_start, int64_t offset, int64_t count) {
+          auto const& typed_array = static_cast<const ArrayType&>(chunk);
+          for (int64_t i = 0; i != count; ++i) {
+            auto element = buffer[offset + i];
+            if (element.indicator != SQL_NULL_DATA) {
+              auto const value = typed_array.GetView(chunk_start + i);
+              std::memcpy(element.data_pointer, value.data(), value.size());
+              element.indicator = value.size();
+            }
+          }
+        });
+      }
+    };
+
     template <typename ArrowType>
     struct numeric_converter : public parameter_converter {
         numeric_converter(std::shared_ptr<ChunkedArray> const & data,
@@ -192,12 +411,14 @@ namespace {
       void set_batch(int64_t start, int64_t elements) final {
         auto & buffer = get_buffer();
 
-        // Currently only non-chunked columns are supported
-        auto const& typed_array = static_cast<const typename TypeTraits<ArrowType>::ArrayType&>(*data->chunk(0));
-        typename ArrowType::c_type const* data_ptr = typed_array.raw_values();
-        memcpy(buffer.data_pointer(), data_ptr + start, elements * sizeof(typename ArrowType::c_type));
+        auto target_ptr = reinterpret_cast<typename ArrowType::c_type*>(buffer.data_pointer());
+        for_each_chunk(start, elements, [&](arrow::Array const & chunk, int64_t chunk_start, int64_t offset, int64_t count) {
+          auto const& typed_array = static_cast<const typename TypeTraits<ArrowType>::ArrayType&>(chunk);
+          typename ArrowType::c_type const* data_ptr = typed_array.raw_values();
+          memcpy(target_ptr + offset, data_ptr + chunk_start, count * sizeof(typename ArrowType::c_type));
+        });
 
-        set_indicator<sizeof(typename ArrowType::c_type)>(buffer, start, elements);
+        set_indicator(buffer, start, elements, sizeof(typename ArrowType::c_type));
       }
     };
 
@@ -215,14 +436,15 @@ namespace {
       void set_batch(int64_t start, int64_t elements) final {
         auto & buffer = get_buffer();
 
-        // Currently only non-chunked columns are supported
-        auto const& typed_array = static_cast<const typename TypeTraits<SrcArrowType>::ArrayType&>(*data->chunk(0));
-        typename SrcArrowType::c_type const* data_ptr = typed_array.raw_values();
         typename DestArrowType::c_type* target_ptr =
             reinterpret_cast<typename DestArrowType::c_type*>(buffer.data_pointer());
-        std::copy(data_ptr + start, data_ptr + start + elements, target_ptr);
+        for_each_chunk(start, elements, [&](arrow::Array const & chunk, int64_t chunk_start, int64_t offset, int64_t count) {
+          auto const& typed_array = static_cast<const typename TypeTraits<SrcArrowType>::ArrayType&>(chunk);
+          typename SrcArrowType::c_type const* data_ptr = typed_array.raw_values();
+          std::copy(data_ptr + chunk_start, data_ptr + chunk_start + count, target_ptr + offset);
+        });
 
-        set_indicator<sizeof(typename DestArrowType::c_type)>(buffer, start, elements);
+        set_indicator(buffer, start, elements, sizeof(typename DestArrowType::c_type));
       }
     };
 
@@ -234,6 +456,14 @@ namespace {
         { }
     };
 
+    struct float_converter : public numeric_converter<FloatType> {
+        float_converter(std::shared_ptr<ChunkedArray> const & data,
+                        turbodbc::bound_parameter_set & parameters,
+                        std::size_t parameter_index) :
+            numeric_converter<FloatType>(data, parameters, parameter_index, turbodbc::type_code::floating_point_32)
+        { }
+    };
+
     struct int64_converter : public numeric_converter<Int64Type> {
         int64_converter(std::shared_ptr<ChunkedArray> const & data,
                          turbodbc::bound_parameter_set & parameters,
@@ -251,6 +481,66 @@ namespace {
         { }
     };
 
+    // Unsigned 64 bit values may exceed BIGINT, so they are sent as NUMERIC(20, 0)
+    struct uint64_converter : public parameter_converter {
+        uint64_converter(std::shared_ptr<ChunkedArray> const & data,
+                         turbodbc::bound_parameter_set & parameters,
+                         std::size_t parameter_index) :
+            parameter_converter(data, parameters, parameter_index)
+        {
+          parameters.rebind(parameter_index, std::unique_ptr<turbodbc::description const>(
+              new turbodbc::decimal_description(20, 0)));
+        }
+
+      void set_batch(int64_t start, int64_t elements) final {
+        auto & buffer = get_buffer();
+        for_each_chunk(start, elements, [&](arrow::Array const & chunk, int64_t chunk_start, int64_t offset, int64_t count) {
+          auto const& typed_array = static_cast<const NumericArray<UInt64Type>&>(chunk);
+          turbodbc::uint64_to_numerics(typed_array.raw_values() + chunk_start, count,
+                                       buffer.data_pointer() + offset * sizeof(SQL_NUMERIC_STRUCT));
+        });
+        set_indicator(buffer, start, elements, sizeof(SQL_NUMERIC_STRUCT));
+      }
+    };
+
+    float half_to_float(uint16_t half)
+    {
+      uint32_t const sign = static_cast<uint32_t>(half & 0x8000u) << 16;
+      uint32_t const exponent = (half >> 10) & 0x1Fu;
+      uint32_t const mantissa = half & 0x3FFu;
+      if (exponent == 0) {
+        // zero or subnormal, i.e., mantissa * 2^-24
+        float const magnitude = std::ldexp(static_cast<float>(mantissa), -24);
+        return sign ? -magnitude : magnitude;
+      }
+      // rebias the exponent from 15 to 127; infinities and NaNs keep all exponent bits set
+      uint32_t const bits = sign | ((exponent == 0x1Fu ? 0xFFu : exponent + 112) << 23) | (mantissa << 13);
+      float value;
+      std::memcpy(&value, &bits, sizeof(value));
+      return value;
+    }
+
+    struct half_float_converter : public parameter_converter {
+        half_float_converter(std::shared_ptr<ChunkedArray> const & data,
+                             turbodbc::bound_parameter_set & parameters,
+                             std::size_t parameter_index) :
+            parameter_converter(data, parameters, parameter_index)
+        {
+          parameters.rebind(parameter_index, turbodbc::make_description(turbodbc::type_code::floating_point_32, 0));
+        }
+
+      void set_batch(int64_t start, int64_t elements) final {
+        auto & buffer = get_buffer();
+        auto target_ptr = reinterpret_cast<float *>(buffer.data_pointer());
+        for_each_chunk(start, elements, [&](arrow::Array const & chunk, int64_t chunk_start, int64_t offset, int64_t count) {
+          auto const& typed_array = static_cast<const HalfFloatArray&>(chunk);
+          std::transform(typed_array.raw_values() + chunk_start, typed_array.raw_values() + chunk_start + count,
+                         target_ptr + offset, half_to_float);
+        });
+        set_indicator(buffer, start, elements, sizeof(float));
+      }
+    };
+
     struct bool_converter : public parameter_converter {
         bool_converter(std::shared_ptr<ChunkedArray> const & data,
                          turbodbc::bound_parameter_set & parameters,
@@ -262,17 +552,17 @@ namespace {
 
       void set_batch(int64_t start, int64_t elements) final {
         auto & buffer = get_buffer();
-        // Currently only non-chunked columns are supported
-        auto const& typed_array = static_cast<const BooleanArray&>(*data->chunk(0));
-        if (typed_array.null_count() < typed_array.length()) {
-          for (int64_t i = 0; i != elements; ++i) {
-            if (not typed_array.IsNull(start + i)) {
-              buffer.data_pointer()[i] = static_cast<int8_t>(typed_array.Value(start + i));
+        for_each_chunk(start, elements, [&](arrow::Array const & chunk, int64_t chunk_start, int64_t offset, int64_t count) {
+          auto const& typed_array = static_cast<const BooleanArray&>(chunk);
+          // Values behind null slots are written as well, their indicators mask them
+          if (typed_array.null_count() < typed_array.length()) {
+            for (int64_t i = 0; i != count; ++i) {
+              buffer.data_pointer()[offset + i] = static_cast<int8_t>(typed_array.Value(chunk_start + i));
             }
           }
-        }
+        });
 
-        set_indicator<sizeof(bool)>(buffer, start, elements);
+        set_indicator(buffer, start, elements, sizeof(bool));
       };
     };
 
@@ -287,17 +577,32 @@ namespace {
 
       void set_batch(int64_t start, int64_t elements) final {
         auto & buffer = get_buffer();
-        // Currently only non-chunked columns are supported
-        auto const& typed_array = static_cast<const Date32Array&>(*data->chunk(0));
-        for (int64_t i = 0; i != elements; ++i) {
-          auto element = buffer[i];
-          if (not typed_array.IsNull(start + i)) {
-            turbodbc::days_to_date(typed_array.Value(start + i), element.data_pointer);
-            element.indicator = sizeof(SQL_DATE_STRUCT);
-          } else {
-            element.indicator = SQL_NULL_DATA;
-          }
+        for_each_chunk(start, elements, [&](arrow::Array const & chunk, int64_t chunk_start, int64_t offset, int64_t count) {
+          auto const& typed_array = static_cast<const Date32Array&>(chunk);
+          turbodbc::days_to_dates(typed_array.raw_values() + chunk_start, count,
+                                  buffer.data_pointer() + offset * sizeof(SQL_DATE_STRUCT));
+        });
+        set_indicator(buffer, start, elements, sizeof(SQL_DATE_STRUCT));
+      };
+    };
+
+    struct date64_converter : public parameter_converter {
+        date64_converter(std::shared_ptr<ChunkedArray> const & data,
+                         turbodbc::bound_parameter_set & parameters,
+                         std::size_t parameter_index) :
+            parameter_converter(data, parameters, parameter_index)
+        {
+          parameters.rebind(parameter_index, turbodbc::make_description(turbodbc::type_code::date, 0));
         }
+
+      void set_batch(int64_t start, int64_t elements) final {
+        auto & buffer = get_buffer();
+        for_each_chunk(start, elements, [&](arrow::Array const & chunk, int64_t chunk_start, int64_t offset, int64_t count) {
+          auto const& typed_array = static_cast<const Date64Array&>(chunk);
+          turbodbc::milliseconds_to_dates(typed_array.raw_values() + chunk_start, count,
+                                          buffer.data_pointer() + offset * sizeof(SQL_DATE_STRUCT));
+        });
+        set_indicator(buffer, start, elements, sizeof(SQL_DATE_STRUCT));
       };
     };
 
@@ -310,40 +615,117 @@ namespace {
           parameters.rebind(parameter_index, turbodbc::make_description(turbodbc::type_code::timestamp, 0));
         }
 
-        virtual void convert(std::int64_t data, char * destination) = 0;
+        virtual void convert(std::int64_t const * data, std::size_t elements, char * destination) = 0;
 
       void set_batch(int64_t start, int64_t elements) final {
         auto & buffer = get_buffer();
-        // Currently only non-chunked columns are supported
-        auto const& typed_array = static_cast<const TimestampArray&>(*data->chunk(0));
-        for (int64_t i = 0; i != elements; ++i) {
-          auto element = buffer[i];
-          if (not typed_array.IsNull(start + i)) {
-            convert(typed_array.Value(start + i), element.data_pointer);
-            element.indicator = sizeof(SQL_TIMESTAMP_STRUCT);
-          } else {
-            element.indicator = SQL_NULL_DATA;
-          }
-        }
+        for_each_chunk(start, elements, [&](arrow::Array const & chunk, int64_t chunk_start, int64_t offset, int64_t count) {
+          auto const& typed_array = static_cast<const TimestampArray&>(chunk);
+          convert(typed_array.raw_values() + chunk_start, count,
+                  buffer.data_pointer() + offset * sizeof(SQL_TIMESTAMP_STRUCT));
+        });
+        set_indicator(buffer, start, elements, sizeof(SQL_TIMESTAMP_STRUCT));
       }
     };
 
     struct nanosecond_converter : public timestamp_converter {
       using timestamp_converter::timestamp_converter;
 
-        void convert(std::int64_t data, char * destination) final {
-            turbodbc::nanoseconds_to_timestamp(data, destination);
+        void convert(std::int64_t const * data, std::size_t elements, char * destination) final {
+            turbodbc::nanoseconds_to_timestamps(data, elements, destination);
         }
     };
 
     struct microsecond_converter : public timestamp_converter {
       using timestamp_converter::timestamp_converter;
 
-        void convert(std::int64_t data, char * destination) final {
-            turbodbc::microseconds_to_timestamp(data, destination);
+        void convert(std::int64_t const * data, std::size_t elements, char * destination) final {
+            turbodbc::microseconds_to_timestamps(data, elements, destination);
+        }
+    };
+
+    struct millisecond_converter : public timestamp_converter {
+      using timestamp_converter::timestamp_converter;
+
+        void convert(std::int64_t const * data, std::size_t elements, char * destination) final {
+            turbodbc::milliseconds_to_timestamps(data, elements, destination);
         }
     };
 
+    struct second_converter : public timestamp_converter {
+      using timestamp_converter::timestamp_converter;
+
+        void convert(std::int64_t const * data, std::size_t elements, char * destination) final {
+            turbodbc::seconds_to_timestamps(data, elements, destination);
+        }
+    };
+
+    // ArrayType is Time32Array (seconds, milliseconds) or Time64Array (microseconds, nanoseconds)
+    template <typename ArrayType>
+    struct time_converter : public parameter_converter {
+        using convert_function = void (*)(typename ArrayType::value_type const *, std::size_t, char *);
+
+        time_converter(std::shared_ptr<ChunkedArray> const & data,
+                       turbodbc::bound_parameter_set & parameters,
+                       std::size_t parameter_index,
+                       convert_function convert) :
+            parameter_converter(data, parameters, parameter_index),
+            convert(convert)
+        {
+          parameters.rebind(parameter_index, turbodbc::make_description(turbodbc::type_code::time, 0));
+        }
+
+      void set_batch(int64_t start, int64_t elements) final {
+        auto & buffer = get_buffer();
+        for_each_chunk(start, elements, [&](arrow::Array const & chunk, int64_t chunk_start, int64_t offset, int64_t count) {
+          auto const& typed_array = static_cast<const ArrayType&>(chunk);
+          convert(typed_array.raw_values() + chunk_start, count,
+                  buffer.data_pointer() + offset * sizeof(turbodbc::ss_time2_struct));
+        });
+        set_indicator(buffer, start, elements, sizeof(turbodbc::ss_time2_struct));
+      }
+
+      private:
+      convert_function const convert;
+    };
+
+    // ArrayType is Decimal128Array or Decimal256Array
+    template <typename ArrayType>
+    struct decimal_converter : public parameter_converter {
+        using convert_function = void (*)(uint8_t const *, std::size_t, int, int, char *);
+
+        decimal_converter(std::shared_ptr<ChunkedArray> const & data,
+                          turbodbc::bound_parameter_set & parameters,
+                          std::size_t parameter_index,
+                          convert_function convert) :
+            parameter_converter(data, parameters, parameter_index),
+            precision(static_cast<DecimalType const&>(*data->type()).precision()),
+            scale(static_cast<DecimalType const&>(*data->type()).scale()),
+            convert(convert)
+        {
+          if (precision > 38) {
+            throw turbodbc::interface_error("Decimal precisions above 38 exceed SQL_NUMERIC_STRUCT");
+          }
+          parameters.rebind(parameter_index, std::unique_ptr<turbodbc::description const>(
+              new turbodbc::decimal_description(precision, scale)));
+        }
+
+      void set_batch(int64_t start, int64_t elements) final {
+        auto & buffer = get_buffer();
+        for_each_chunk(start, elements, [&](arrow::Array const & chunk, int64_t chunk_start, int64_t offset, int64_t count) {
+          auto const& typed_array = static_cast<const ArrayType&>(chunk);
+          convert(typed_array.GetValue(chunk_start), count, precision, scale,
+                  buffer.data_pointer() + offset * sizeof(SQL_NUMERIC_STRUCT));
+        });
+        set_indicator(buffer, start, elements, sizeof(SQL_NUMERIC_STRUCT));
+      }
+
+      private:
+      int const precision;
+      int const scale;
+      convert_function const convert;
+    };
+
     std::vector<std::unique_ptr<parameter_converter>> make_converters(
         Table const & table,
         turbodbc::bound_parameter_set & parameters)
@@ -357,10 +739,17 @@ namespace {
             std::shared_ptr<ChunkedArray> data = table.column(i)->data();
 #endif
             arrow::Type::type dtype = data->type()->id();
+            auto const unsupported_type = [&]() {
+                std::ostringstream message;
+                message << "Unsupported Arrow type for column " << (i + 1) << " of ";
+                message << table.num_columns() << " (" << data->type()->ToString() << ")";
+                return turbodbc::interface_error(message.str());
+            };
 
             switch (dtype) {
               case arrow::Type::NA:
                 converters.emplace_back(new null_converter(data, parameters, i));
+                break;
               case arrow::Type::INT8:
                 converters.emplace_back(new int_converter<Int8Type>(data, parameters, i));
                 break;
@@ -382,13 +771,30 @@ namespace {
               case arrow::Type::UINT32:
                 converters.emplace_back(new int_converter<UInt32Type>(data, parameters, i));
                 break;
+              case arrow::Type::UINT64:
+                converters.emplace_back(new uint64_converter(data, parameters, i));
+                break;
               case arrow::Type::BINARY:
+                converters.emplace_back(new binary_converter<BinaryArray>(data, parameters, i));
+                break;
+              case arrow::Type::LARGE_BINARY:
+                converters.emplace_back(new binary_converter<LargeBinaryArray>(data, parameters, i));
+                break;
+              case arrow::Type::FIXED_SIZE_BINARY:
+                converters.emplace_back(new binary_converter<FixedSizeBinaryArray>(data, parameters, i));
+                break;
               case arrow::Type::STRING:
-                converters.emplace_back(new string_converter(data, parameters, i));
+                converters.emplace_back(new string_converter<BinaryArray>(data, parameters, i));
+                break;
+              case arrow::Type::LARGE_STRING:
+                converters.emplace_back(new string_converter<LargeBinaryArray>(data, parameters, i));
                 break;
               case arrow::Type::DATE32:
                 converters.emplace_back(new date_converter(data, parameters, i));
                 break;
+              case arrow::Type::DATE64:
+                converters.emplace_back(new date64_converter(data, parameters, i));
+                break;
               case arrow::Type::TIMESTAMP:
                 {
                   auto const& time_dtype = static_cast<TimestampType const&>(*data->type());
@@ -399,27 +805,169 @@ namespace {
                     case TimeUnit::NANO:
                       converters.emplace_back(new nanosecond_converter(data, parameters, i));
                       break;
-                    default:
-                      throw turbodbc::interface_error("Unsupported timestamp resolution");
+                    case TimeUnit::MILLI:
+                      converters.emplace_back(new millisecond_converter(data, parameters, i));
+                      break;
+                    case TimeUnit::SECOND:
+                      converters.emplace_back(new second_converter(data, parameters, i));
+                      break;
                   }
                 }
                 break;
+              case arrow::Type::TIME32:
+                if (static_cast<Time32Type const&>(*data->type()).unit() == TimeUnit::SECOND) {
+                  converters.emplace_back(new time_converter<Time32Array>(data, parameters, i, turbodbc::seconds_to_times));
+                } else {
+                  converters.emplace_back(new time_converter<Time32Array>(data, parameters, i, turbodbc::milliseconds_to_times));
+                }
+                break;
+              case arrow::Type::TIME64:
+                if (static_cast<Time64Type const&>(*data->type()).unit() == TimeUnit::MICRO) {
+                  converters.emplace_back(new time_converter<Time64Array>(data, parameters, i, turbodbc::microseconds_to_times));
+                } else {
+                  converters.emplace_back(new time_converter<Time64Array>(data, parameters, i, turbodbc::nanoseconds_to_times));
+                }
+                break;
               case arrow::Type::BOOL:
                 converters.emplace_back(new bool_converter(data, parameters, i));
                 break;
+              case arrow::Type::HALF_FLOAT:
+                converters.emplace_back(new half_float_converter(data, parameters, i));
+                break;
+              case arrow::Type::FLOAT:
+                converters.emplace_back(new float_converter(data, parameters, i));
+                break;
               case arrow::Type::DOUBLE:
                 converters.emplace_back(new double_converter(data, parameters, i));
                 break;
+              case arrow::Type::DECIMAL128:
+                converters.emplace_back(new decimal_converter<Decimal128Array>(data, parameters, i, turbodbc::decimal128_to_numerics));
+                break;
+              case arrow::Type::DECIMAL256:
+                converters.emplace_back(new decimal_converter<Decimal256Array>(data, parameters, i, turbodbc::decimal256_to_numerics));
+                break;
+              case arrow::Type::DICTIONARY:
+                {
+                  auto const value_type = static_cast<DictionaryType const&>(*data->type()).value_type()->id();
+                  if (value_type == arrow::Type::STRING) {
+                    converters.emplace_back(new dictionary_string_converter<BinaryArray>(data, parameters, i));
+                  } else if (value_type == arrow::Type::LARGE_STRING) {
+                    converters.emplace_back(new dictionary_string_converter<LargeBinaryArray>(data, parameters, i));
+                  } else {
+                    throw unsupported_type();
+                  }
+                }
+                break;
               default:
-                std::ostringstream message;
-                message << "Unsupported Arrow type for column " << (i + 1) << " of ";
-                message << table.num_columns() << " (" << data->type()->ToString() << ")";
-                throw turbodbc::interface_error(message.str());
+                throw unsupported_type();
             }
         }
 
         return converters;
     }
+
+    /**
+     * @brief A parameter set which the filler thread handed to the executing thread
+     */
+    struct filled_parameters {
+        std::size_t generation;
+        // Zero sets mark the end of the stream
+        std::size_t sets;
+        std::exception_ptr error;
+    };
+
+    std::size_t const n_generations = 2;
+
+    /**
+     * @brief Read batches from the reader and convert them to parameter sets
+     *        until the reader is exhausted. Batches are gathered until a full
+     *        parameter buffer can be filled; buffers may span several batches.
+     */
+    void fill_parameters(arrow::RecordBatchReader & reader,
+                         std::array<std::unique_ptr<turbodbc::bound_parameter_set>, n_generations> & generations,
+                         turbodbc::bounded_queue<std::size_t> & free_generations,
+                         turbodbc::bounded_queue<filled_parameters> & filled_generations)
+    {
+        std::array<std::vector<std::unique_ptr<parameter_converter>>, n_generations> converters;
+        std::deque<std::shared_ptr<arrow::RecordBatch>> batches;
+        // first row of batches.front() which has not been converted yet
+        int64_t offset = 0;
+        int64_t available = 0;
+        bool exhausted = false;
+
+        while (true) {
+            std::size_t generation = 0;
+            if (not free_generations.pull(generation)) {
+                return;
+            }
+            // generations which are not executing may be accessed; in adaptive
+            // mode, each of them chooses its own number of buffered sets
+            auto const buffered_sets = static_cast<int64_t>(generations[generation]->buffered_sets());
+
+            while ((not exhausted) and (available < buffered_sets)) {
+                std::shared_ptr<arrow::RecordBatch> batch;
+                auto const status = reader.ReadNext(&batch);
+                if (not status.ok()) {
+                    throw turbodbc::interface_error("Reading Arrow stream failed.\n" + status.ToString());
+                }
+                if (not batch) {
+                    exhausted = true;
+                } else if (batch->num_rows() != 0) {
+                    available += batch->num_rows();
+                    batches.push_back(std::move(batch));
+                }
+            }
+            if (available == 0) {
+                filled_generations.push({0, 0, nullptr});
+                return;
+            }
+
+            auto const table = Table::FromRecordBatches(reader.schema(), {batches.begin(), batches.end()});
+            if (not table.ok()) {
+                throw turbodbc::interface_error("Reading Arrow stream failed.\n" + table.status().ToString());
+            }
+            auto & generation_converters = converters[generation];
+            if (generation_converters.empty()) {
+                generation_converters = make_converters(**table, *generations[generation]);
+            } else {
+                for (int i = 0; i != (*table)->num_columns(); ++i) {
+                    generation_converters[i]->set_data((*table)->column(i));
+                }
+            }
+
+            auto const sets = std::min(buffered_sets, available);
+            for (auto & converter : generation_converters) {
+                converter->set_batch(offset, sets);
+            }
+            if (not filled_generations.push({generation, static_cast<std::size_t>(sets), nullptr})) {
+                return;
+            }
+
+            offset += sets;
+            available -= sets;
+            while ((not batches.empty()) and (offset >= batches.front()->num_rows())) {
+                offset -= batches.front()->num_rows();
+                batches.pop_front();
+            }
+        }
+    }
+
+}
+
+std::shared_ptr<arrow::RecordBatchReader> import_arrow_stream(pybind11::object const & source) {
+    pybind11::object capsule = source;
+    if (pybind11::hasattr(source, "__arrow_c_stream__")) {
+        capsule = source.attr("__arrow_c_stream__")();
+    }
+    if (not PyCapsule_IsValid(capsule.ptr(), "arrow_array_stream")) {
+        throw turbodbc::interface_error("Expected an object implementing __arrow_c_stream__ or an arrow_array_stream capsule");
+    }
+    auto stream = static_cast<ArrowArrayStream *>(PyCapsule_GetPointer(capsule.ptr(), "arrow_array_stream"));
+    auto reader = arrow::ImportRecordBatchReader(stream);
+    if (not reader.ok()) {
+        throw turbodbc::interface_error("Importing Arrow stream failed.\n" + reader.status().ToString());
+    }
+    return *reader;
 }
 
 std::shared_ptr<Table> unwrap_pyarrow_table(pybind11::object const & pyarrow_table) {
@@ -450,16 +998,150 @@ void set_arrow_parameters(turbodbc::bound_parameter_set & parameters, pybind11::
         return;
     }
 
+    // The unwrapped table keeps its buffers alive, so conversion and execution
+    // do not need the GIL. Other threads may meanwhile insert using their own
+    // connections.
+    pybind11::gil_scoped_release release;
     auto converters = make_converters(*table, parameters);
     std::size_t const total_sets = static_cast<std::size_t>(table->num_rows());
 
-    for (std::size_t start = 0; start < total_sets; start += parameters.buffered_sets()) {
+    // the number of buffered sets may change after each batch in adaptive mode
+    for (std::size_t start = 0; start < total_sets; ) {
         auto const in_this_batch = std::min(parameters.buffered_sets(), total_sets - start);
         for (int64_t i = 0; i < table->num_columns(); ++i) {
             converters[i]->set_batch(start, in_this_batch);
         }
         parameters.execute_batch(in_this_batch);
+        start += in_this_batch;
+    }
+}
+
+std::size_t insert_record_batches(turbodbc::command & command, cpp_odbc::connection const & connection,
+                                  arrow::RecordBatchReader & reader, std::size_t commit_every) {
+    std::array<std::unique_ptr<turbodbc::bound_parameter_set>, n_generations> generations = {{
+        command.make_parameters_bound_on_execute(), command.make_parameters_bound_on_execute()}};
+
+    auto const n_columns = reader.schema()->num_fields();
+    if (static_cast<int>(generations.front()->number_of_parameters()) != n_columns) {
+        std::stringstream ss;
+        ss << "Number of passed columns (" << n_columns;
+        ss << ") is not equal to the number of parameters (";
+        ss << generations.front()->number_of_parameters() << ")";
+        throw turbodbc::interface_error(ss.str());
     }
+    if (n_columns == 0) {
+        return 0;
+    }
+
+    turbodbc::bounded_queue<std::size_t> free_generations(n_generations);
+    turbodbc::bounded_queue<filled_parameters> filled_generations(n_generations);
+    for (std::size_t generation = 0; generation != n_generations; ++generation) {
+        free_generations.push(generation);
+    }
+
+    std::thread filler([&]() {
+        // catch exceptions since uncaught exceptions in threads are deadly
+        try {
+            fill_parameters(reader, generations, free_generations, filled_generations);
+        } catch (...) {
+            filled_generations.push({0, 0, std::current_exception()});
+        }
+    });
+
+    try {
+        std::size_t executed_batches = 0;
+        filled_parameters filled = {0, 0, nullptr};
+        while (filled_generations.pull(filled) and (filled.sets != 0)) {
+            generations[filled.generation]->execute_batch(filled.sets);
+            ++executed_batches;
+            if ((commit_every != 0) and (executed_batches % commit_every == 0)) {
+                connection.commit();
+            }
+            free_generations.push(filled.generation);
+        }
+        if (filled.error) {
+            std::rethrow_exception(filled.error);
+        }
+    } catch (...) {
+        free_generations.close();
+        filled_generations.close();
+        filler.join();
+        throw;
+    }
+    filler.join();
+
+    std::size_t transferred_sets = 0;
+    for (auto const & generation : generations) {
+        transferred_sets += generation->transferred_sets();
+    }
+    return transferred_sets;
+}
+
+std::size_t insert_arrow_stream(turbodbc::cursor & cursor, pybind11::object const & source, std::size_t commit_every) {
+    auto reader = import_arrow_stream(source);
+    pybind11::gil_scoped_release release;
+    return insert_record_batches(*cursor.get_command(), *cursor.get_connection(), *reader, commit_every);
+}
+
+std::size_t insert_table_parameter_batches(turbodbc::bound_parameter_set & table_parameter,
+                                           arrow::RecordBatchReader & reader) {
+    auto const n_columns = reader.schema()->num_fields();
+    if (static_cast<int>(table_parameter.number_of_parameters()) != n_columns) {
+        std::stringstream ss;
+        ss << "Number of passed columns (" << n_columns;
+        ss << ") is not equal to the number of table parameter columns (";
+        ss << table_parameter.number_of_parameters() << ")";
+        throw turbodbc::interface_error(ss.str());
+    }
+
+    std::vector<std::unique_ptr<parameter_converter>> converters;
+    while (true) {
+        std::shared_ptr<arrow::RecordBatch> batch;
+        auto const status = reader.ReadNext(&batch);
+        if (not status.ok()) {
+            throw turbodbc::interface_error("Reading Arrow stream failed.\n" + status.ToString());
+        }
+        if (not batch) {
+            break;
+        }
+        if ((batch->num_rows() == 0) or (n_columns == 0)) {
+            continue;
+        }
+
+        auto const table = Table::FromRecordBatches(reader.schema(), {batch});
+        if (not table.ok()) {
+            throw turbodbc::interface_error("Reading Arrow stream failed.\n" + table.status().ToString());
+        }
+        if (converters.empty()) {
+            converters = make_converters(**table, table_parameter);
+        } else {
+            for (int i = 0; i != n_columns; ++i) {
+                converters[i]->set_data((*table)->column(i));
+            }
+        }
+
+        std::size_t const rows = static_cast<std::size_t>(batch->num_rows());
+        for (std::size_t start = 0; start < rows; ) {
+            auto const in_this_batch = std::min(table_parameter.buffered_sets(), rows - start);
+            for (auto & converter : converters) {
+                converter->set_batch(start, in_this_batch);
+            }
+            table_parameter.execute_batch(in_this_batch);
+            start += in_this_batch;
+        }
+    }
+    return table_parameter.transferred_sets();
+}
+
+std::size_t insert_arrow_table_parameter(turbodbc::cursor & cursor, std::string const & table_type_name,
+                                         pybind11::object const & source) {
+    std::u16string wide_type_name(table_type_name.size(), u'\0');
+    wide_type_name.resize(turbodbc::utf8_to_utf16(table_type_name.data(), table_type_name.size(), &wide_type_name[0]));
+
+    auto reader = import_arrow_stream(source);
+    auto table_parameter = cursor.get_command()->make_table_parameter(std::move(wide_type_name), reader->schema()->num_fields());
+    pybind11::gil_scoped_release release;
+    return insert_table_parameter_batches(*table_parameter, *reader);
 }
 
 }
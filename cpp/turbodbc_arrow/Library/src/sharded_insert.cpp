@@ -0,0 +1,358 @@
+#include <turbodbc_arrow/sharded_insert.h>
+#include <turbodbc_arrow/set_arrow_parameters.h>
+
+#include <arrow/compute/api_vector.h>
+
+#include <turbodbc/bounded_queue.h>
+#include <turbodbc/connect.h>
+#include <turbodbc/errors.h>
+
+#include <algorithm>
+#include <atomic>
+#include <ciso646>
+#include <cstdint>
+#include <exception>
+#include <thread>
+
+
+using arrow::BinaryArray;
+using arrow::BooleanArray;
+using arrow::DictionaryArray;
+using arrow::LargeBinaryArray;
+using arrow::RecordBatch;
+
+namespace turbodbc_arrow {
+
+namespace {
+
+    // about the default number of buffered parameter sets
+    std::size_t const minimum_rows_per_range = 1000;
+    // record batches waiting for each worker
+    std::size_t const queued_batches_per_worker = 2;
+
+    uint64_t const null_hash = 0x2545f4914f6cdd1dULL;
+
+    uint64_t hash_bytes(uint8_t const * data, std::size_t size)
+    {
+        // FNV-1a
+        uint64_t hash = 14695981039346656037ULL;
+        for (std::size_t i = 0; i != size; ++i) {
+            hash ^= data[i];
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    uint64_t combine(uint64_t seed, uint64_t value)
+    {
+        return seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+    }
+
+    template <typename ArrayType>
+    void hash_views(arrow::Array const & array, std::vector<uint64_t> & hashes)
+    {
+        auto const & typed_array = static_cast<ArrayType const &>(array);
+        for (int64_t i = 0; i != typed_array.length(); ++i) {
+            if (typed_array.IsNull(i)) {
+                hashes[i] = null_hash;
+            } else {
+                auto const view = typed_array.GetView(i);
+                hashes[i] = hash_bytes(reinterpret_cast<uint8_t const *>(view.data()), view.size());
+            }
+        }
+    }
+
+    /**
+     * @brief Store a hash of the i-th value of the array in hashes[i]. Values
+     *        hash alike regardless of the array's offset or dictionary encoding.
+     */
+    void hash_values(arrow::Array const & array, std::vector<uint64_t> & hashes)
+    {
+        switch (array.type_id()) {
+            case arrow::Type::NA:
+                std::fill_n(hashes.begin(), array.length(), null_hash);
+                return;
+            case arrow::Type::BOOL: {
+                auto const & typed_array = static_cast<BooleanArray const &>(array);
+                for (int64_t i = 0; i != typed_array.length(); ++i) {
+                    uint8_t const value = typed_array.Value(i) ? 1 : 0;
+                    hashes[i] = typed_array.IsNull(i) ? null_hash : hash_bytes(&value, 1);
+                }
+                return;
+            }
+            case arrow::Type::BINARY:
+            case arrow::Type::STRING:
+                hash_views<BinaryArray>(array, hashes);
+                return;
+            case arrow::Type::LARGE_BINARY:
+            case arrow::Type::LARGE_STRING:
+                hash_views<LargeBinaryArray>(array, hashes);
+                return;
+#if ARROW_VERSION_MAJOR >= 15
+            case arrow::Type::BINARY_VIEW:
+            case arrow::Type::STRING_VIEW:
+                hash_views<arrow::BinaryViewArray>(array, hashes);
+                return;
+#endif
+            case arrow::Type::DICTIONARY: {
+                auto const & typed_array = static_cast<DictionaryArray const &>(array);
+                std::vector<uint64_t> entry_hashes(typed_array.dictionary()->length());
+                hash_values(*typed_array.dictionary(), entry_hashes);
+                for (int64_t i = 0; i != typed_array.length(); ++i) {
+                    hashes[i] = typed_array.IsNull(i) ? null_hash : entry_hashes[typed_array.GetValueIndex(i)];
+                }
+                return;
+            }
+            default:
+                break;
+        }
+
+        auto const fixed_width = dynamic_cast<arrow::FixedWidthType const *>(array.type().get());
+        if ((fixed_width == nullptr) or (fixed_width->bit_width() == 0) or (fixed_width->bit_width() % 8 != 0)) {
+            throw turbodbc::interface_error("Cannot partition rows by a column of type " + array.type()->ToString());
+        }
+        std::size_t const value_size = fixed_width->bit_width() / 8;
+        auto const values = array.data()->buffers[1]->data() + array.offset() * value_size;
+        for (int64_t i = 0; i != array.length(); ++i) {
+            hashes[i] = array.IsNull(i) ? null_hash : hash_bytes(values + i * value_size, value_size);
+        }
+    }
+
+    /**
+     * @brief Reads the record batches a dispatcher pushes into a queue. The
+     *        stream ends when the queue is closed, and fails if the dispatcher
+     *        could not read its source.
+     */
+    class queue_reader : public arrow::RecordBatchReader {
+    public:
+        queue_reader(std::shared_ptr<arrow::Schema> schema,
+                     turbodbc::bounded_queue<std::shared_ptr<RecordBatch>> & queue,
+                     std::atomic<bool> const & source_failed) :
+            schema_(std::move(schema)),
+            queue_(queue),
+            source_failed_(source_failed)
+        {
+        }
+
+        std::shared_ptr<arrow::Schema> schema() const override
+        {
+            return schema_;
+        }
+
+        arrow::Status ReadNext(std::shared_ptr<RecordBatch> * batch) override
+        {
+            if (not queue_.pull(*batch)) {
+                batch->reset();
+                if (source_failed_) {
+                    return arrow::Status::Cancelled("Reading the rows to insert failed");
+                }
+            }
+            return arrow::Status::OK();
+        }
+
+    private:
+        std::shared_ptr<arrow::Schema> schema_;
+        turbodbc::bounded_queue<std::shared_ptr<RecordBatch>> & queue_;
+        std::atomic<bool> const & source_failed_;
+    };
+
+    using batch_queue = turbodbc::bounded_queue<std::shared_ptr<RecordBatch>>;
+
+}
+
+
+std::vector<std::shared_ptr<RecordBatch>> partition_by_row_ranges(std::shared_ptr<RecordBatch> const & batch,
+                                                                  std::size_t number_of_shards,
+                                                                  std::size_t minimum_rows)
+{
+    std::vector<std::shared_ptr<RecordBatch>> ranges;
+    auto const rows = static_cast<std::size_t>(batch->num_rows());
+    if (rows == 0) {
+        return ranges;
+    }
+    auto const n_ranges = std::max(std::size_t(1), std::min(number_of_shards, rows / std::max(minimum_rows, std::size_t(1))));
+    auto const rows_per_range = (rows + n_ranges - 1) / n_ranges;
+    for (std::size_t start = 0; start < rows; start += rows_per_range) {
+        ranges.push_back(batch->Slice(start, std::min(rows_per_range, rows - start)));
+    }
+    return ranges;
+}
+
+std::vector<std::shared_ptr<RecordBatch>> partition_by_hash(std::shared_ptr<RecordBatch> const & batch,
+                                                            std::vector<int> const & key_columns,
+                                                            std::size_t number_of_shards)
+{
+    number_of_shards = std::max(number_of_shards, std::size_t(1));
+    auto const rows = batch->num_rows();
+
+    std::vector<uint64_t> row_hashes(rows, 0);
+    std::vector<uint64_t> value_hashes(rows);
+    for (auto const column : key_columns) {
+        hash_values(*batch->column(column), value_hashes);
+        for (int64_t i = 0; i != rows; ++i) {
+            row_hashes[i] = combine(row_hashes[i], value_hashes[i]);
+        }
+    }
+
+    std::vector<std::vector<int64_t>> rows_of_shard(number_of_shards);
+    for (int64_t i = 0; i != rows; ++i) {
+        rows_of_shard[row_hashes[i] % number_of_shards].push_back(i);
+    }
+
+    std::vector<std::shared_ptr<RecordBatch>> shards;
+    for (auto const & indices : rows_of_shard) {
+        if (static_cast<int64_t>(indices.size()) == rows) {
+            shards.push_back(batch);
+        } else if (indices.empty()) {
+            shards.push_back(batch->Slice(0, 0));
+        } else {
+            arrow::Int64Builder builder;
+            std::shared_ptr<arrow::Array> index_array;
+            auto status = builder.AppendValues(indices);
+            if (status.ok()) {
+                status = builder.Finish(&index_array);
+            }
+            if (not status.ok()) {
+                throw turbodbc::interface_error("Partitioning rows failed.\n" + status.ToString());
+            }
+            auto const taken = arrow::compute::Take(arrow::Datum(batch), arrow::Datum(index_array));
+            if (not taken.ok()) {
+                throw turbodbc::interface_error("Partitioning rows failed.\n" + taken.status().ToString());
+            }
+            shards.push_back(taken->record_batch());
+        }
+    }
+    return shards;
+}
+
+std::vector<shard_result> insert_sharded(connection_factory const & connect,
+                                         std::string const & sql,
+                                         arrow::RecordBatchReader & reader,
+                                         std::size_t workers,
+                                         std::vector<int> const & key_columns,
+                                         std::size_t commit_every)
+{
+    workers = std::max(workers, std::size_t(1));
+    auto const schema = reader.schema();
+    for (auto const column : key_columns) {
+        if ((column < 0) or (column >= schema->num_fields())) {
+            throw turbodbc::interface_error("Key column " + std::to_string(column) + " does not exist");
+        }
+    }
+
+    // hash partitions have a queue per worker, row ranges go to whoever is idle
+    bool const hashing = not key_columns.empty();
+    std::vector<std::unique_ptr<batch_queue>> queues;
+    for (std::size_t i = 0; i != (hashing ? workers : 1); ++i) {
+        queues.emplace_back(new batch_queue(hashing ? queued_batches_per_worker : queued_batches_per_worker * workers));
+    }
+
+    std::vector<shard_result> results(workers, shard_result{0, ""});
+    std::atomic<bool> source_failed(false);
+    std::atomic<std::size_t> active_workers(workers);
+
+    auto work = [&](std::size_t worker) {
+        auto & queue = *queues[hashing ? worker : 0];
+        queue_reader shard_reader(schema, queue, source_failed);
+        try {
+            auto connection = connect();
+            try {
+                auto cursor = connection.make_cursor();
+                cursor.prepare(sql);
+                auto const transferred = insert_record_batches(*cursor.get_command(), *cursor.get_connection(),
+                                                               shard_reader, commit_every);
+                connection.commit();
+                results[worker].transferred_sets = transferred;
+            } catch (...) {
+                try {
+                    connection.rollback();
+                } catch (...) {
+                    // report the original error
+                }
+                throw;
+            }
+        } catch (std::exception const & error) {
+            results[worker].error = error.what();
+            // nobody reads this worker's rows anymore
+            if (hashing) {
+                queue.close();
+            }
+            if (--active_workers == 0) {
+                for (auto & q : queues) {
+                    q->close();
+                }
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (std::size_t worker = 0; worker != workers; ++worker) {
+        threads.emplace_back(work, worker);
+    }
+
+    std::exception_ptr source_error;
+    try {
+        while (active_workers != 0) {
+            std::shared_ptr<RecordBatch> batch;
+            auto const status = reader.ReadNext(&batch);
+            if (not status.ok()) {
+                throw turbodbc::interface_error("Reading Arrow stream failed.\n" + status.ToString());
+            }
+            if (not batch) {
+                break;
+            }
+            if (hashing) {
+                auto const shards = partition_by_hash(batch, key_columns, workers);
+                for (std::size_t i = 0; i != workers; ++i) {
+                    if (shards[i]->num_rows() != 0) {
+                        queues[i]->push(shards[i]);
+                    }
+                }
+            } else {
+                for (auto const & range : partition_by_row_ranges(batch, workers, minimum_rows_per_range)) {
+                    queues.front()->push(range);
+                }
+            }
+        }
+    } catch (...) {
+        // workers roll back instead of committing an incomplete insert
+        source_error = std::current_exception();
+        source_failed = true;
+    }
+
+    for (auto & queue : queues) {
+        queue->close();
+    }
+    for (auto & thread : threads) {
+        thread.join();
+    }
+    if (source_error) {
+        std::rethrow_exception(source_error);
+    }
+    return results;
+}
+
+std::vector<shard_result> insert_arrow_sharded(std::string const & connection_string,
+                                               turbodbc::options const & options,
+                                               std::string const & sql,
+                                               pybind11::object const & source,
+                                               std::size_t workers,
+                                               std::vector<std::string> const & key_columns,
+                                               std::size_t commit_every)
+{
+    auto reader = import_arrow_stream(source);
+    std::vector<int> key_indices;
+    for (auto const & name : key_columns) {
+        auto const index = reader->schema()->GetFieldIndex(name);
+        if (index < 0) {
+            throw turbodbc::interface_error("Key column " + name + " does not exist or is ambiguous");
+        }
+        key_indices.push_back(index);
+    }
+
+    pybind11::gil_scoped_release release;
+    return insert_sharded([&]() { return turbodbc::connect(connection_string, options); },
+                          sql, *reader, workers, key_indices, commit_every);
+}
+
+}
@@ -5,11 +5,15 @@
 #include <turbodbc/field_translator.h>
 #include <pybind11/pybind11.h>
 
+#include <functional>
+
 namespace arrow {
 
 class Schema;
 class Status;
 class Table;
+class RecordBatch;
+class RecordBatchReader;
 class ArrayBuilder;
 
 }
@@ -29,12 +33,79 @@ class PYBIND11_EXPORT arrow_result_set {
     arrow_result_set(turbodbc::result_sets::result_set & base, bool strings_as_dictionary,
         bool adaptive_integers);
 
+    /**
+     * @brief Create a new arrow_result_set. If zero_copy is set, 64 bit integer
+     *        and floating point columns are fetched directly into Arrow-owned
+     *        memory and every batch becomes a separate chunk of the result.
+     *        zero_copy has no effect if adaptive_integers is set.
+     */
+    arrow_result_set(turbodbc::result_sets::result_set & base, bool strings_as_dictionary,
+        bool adaptive_integers, bool zero_copy);
+
+    /**
+     * @brief Create a new arrow_result_set. Columns of each batch are converted
+     *        in parallel on up to conversion_threads threads of the shared
+     *        turbodbc::thread_pool. Expensive columns such as unicode strings
+     *        and timestamps are scheduled first. A value of 0 or 1 converts
+     *        all columns on the calling thread.
+     */
+    arrow_result_set(turbodbc::result_sets::result_set & base, bool strings_as_dictionary,
+        bool adaptive_integers, bool zero_copy, std::size_t conversion_threads);
+
+    /**
+     * @brief Create a new arrow_result_set. If pipeline_depth is positive,
+     *        batches are fetched and converted on a background thread while
+     *        the consumer processes previous batches. At most pipeline_depth
+     *        converted batches are buffered. Combined with a double buffered
+     *        base result set, fetching, conversion and consumption of three
+     *        consecutive batches overlap. Pipelined batches are converted as
+     *        in fetch_next_batch_native.
+     */
+    arrow_result_set(turbodbc::result_sets::result_set & base, bool strings_as_dictionary,
+        bool adaptive_integers, bool zero_copy, std::size_t conversion_threads,
+        std::size_t pipeline_depth);
+
+    /**
+     * @brief Create a new arrow_result_set which shares ownership of the base
+     *        result set. Readers and exported streams created by this object
+     *        keep the base result set alive, so they may outlive the cursor.
+     */
+    arrow_result_set(std::shared_ptr<turbodbc::result_sets::result_set> base, bool strings_as_dictionary,
+        bool adaptive_integers, bool zero_copy, std::size_t conversion_threads,
+        std::size_t pipeline_depth);
+
     /**
      * @brief Retrieve a native (C++) Arrow Table which contains
      *        values and masks for all data
      */
     arrow::Status fetch_all_native(std::shared_ptr<arrow::Table>* out, bool batch_only);
 
+    /**
+     * @brief Fetch the next batch into a native (C++) Arrow RecordBatch.
+     *        64 bit integer and floating point columns are fetched directly
+     *        into Arrow memory if the base result set supports it. Integers
+     *        are always returned as int64. The batch has zero rows once the
+     *        result set is exhausted.
+     */
+    arrow::Status fetch_next_batch_native(std::shared_ptr<arrow::RecordBatch>* out);
+
+    /**
+     * @brief Create a reader which lazily fetches the remaining batches.
+     *        The reader shares the base result set with this object. If a
+     *        pipeline depth was given, the reader fetches ahead on a
+     *        background thread.
+     */
+    std::shared_ptr<arrow::RecordBatchReader> make_record_batch_reader();
+
+    /**
+     * @brief Export the remaining batches as an Arrow C stream wrapped in a
+     *        PyCapsule named "arrow_array_stream". This implements the
+     *        __arrow_c_stream__ protocol. If this object shares ownership of
+     *        the base result set, the stream may outlive the cursor. It must
+     *        be consumed before the cursor executes another command.
+     */
+    pybind11::object export_stream(pybind11::object requested_schema);
+
     /**
       * @brief Retrieve a Python object which contains
       *        values and masks for the current batch as pyarrow.Table
@@ -54,10 +125,22 @@ class PYBIND11_EXPORT arrow_result_set {
 
   private:
     arrow::Status process_batch(size_t rows_in_batch, std::vector<std::unique_ptr<arrow::ArrayBuilder>> const& columns);
+    arrow::Status fetch_all_zero_copy(std::shared_ptr<arrow::Table>* out, bool single_batch);
+    std::shared_ptr<arrow::RecordBatchReader> make_pipelined_record_batch_reader();
+    arrow::Status read_pipelined_table(std::shared_ptr<arrow::Table>* out, bool single_batch);
+    arrow::Status for_each_column(std::vector<turbodbc::column_info> const & column_info,
+                                  std::function<arrow::Status(std::size_t)> const & convert);
 
+    std::shared_ptr<turbodbc::result_sets::result_set> owned_base_;
     turbodbc::result_sets::result_set & base_result_;
     bool strings_as_dictionary_;
     bool adaptive_integers_;
+    bool zero_copy_;
+    std::size_t conversion_threads_;
+    std::size_t pipeline_depth_;
+    std::shared_ptr<arrow::RecordBatchReader> pipeline_;
+    std::size_t rows_per_batch_;
+    std::vector<std::vector<uint8_t>> valid_bytes_;
 };
 
 }
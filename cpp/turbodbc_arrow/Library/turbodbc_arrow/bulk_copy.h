@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cpp_odbc/level2/api.h>
+#include <turbodbc/cursor.h>
+
+#undef BOOL
+#undef timezone
+#include <arrow/api.h>
+#include <pybind11/pybind11.h>
+
+#include <string>
+
+namespace turbodbc_arrow {
+
+/**
+ * @brief Copy all rows of the reader into the given table with the bulk copy API
+ *        of the Microsoft ODBC Driver for SQL Server. The i-th column of the reader
+ *        fills the i-th column of the table. Fixed-width numbers and binary values
+ *        are passed to the driver straight from the Arrow buffers. If the copy
+ *        fails, it is aborted and the rows sent since the last commit are discarded.
+ * @param api The API which issues the bulk copy calls
+ * @param connection A connection established with SQL_COPT_SS_BCP enabled
+ * @param table The name of the target table
+ * @param reader Source of the rows
+ * @param batch_size Commit the copied rows after every batch_size rows. If zero,
+ *        all rows are committed at the end.
+ * @param table_lock If true, the copy holds a bulk update lock (TABLOCK) on the table
+ * @return The number of copied rows
+ */
+std::size_t bulk_copy_record_batches(cpp_odbc::level2::api const & api,
+                                     cpp_odbc::level2::connection_handle const & connection,
+                                     std::u16string const & table,
+                                     arrow::RecordBatchReader & reader,
+                                     std::size_t batch_size,
+                                     bool table_lock);
+
+/**
+ * @brief Copy all rows of source, which is either an object implementing the
+ *        __arrow_c_stream__ protocol or an "arrow_array_stream" PyCapsule, into the
+ *        given table. The cursor's connection must have been established with the
+ *        enable_bulk_copy option. The GIL is released while rows are copied.
+ * @return The number of copied rows
+ */
+std::size_t bulk_copy_arrow_stream(turbodbc::cursor & cursor, std::string const & table,
+                                   pybind11::object const & source, std::size_t batch_size,
+                                   bool table_lock);
+
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <turbodbc/command.h>
+#include <turbodbc/cursor.h>
 #include <turbodbc/parameter_sets/bound_parameter_set.h>
 
 #undef BOOL
@@ -11,4 +13,52 @@ namespace turbodbc_arrow {
 
 void set_arrow_parameters(turbodbc::bound_parameter_set & parameters, pybind11::object const & pyarrow_table);
 
+/**
+ * @brief Execute the command's prepared statement for all rows of the reader.
+ *        Two generations of parameter buffers are used: a background thread
+ *        converts the next rows into one generation while the other one is
+ *        executed. If commit_every is positive, the connection is committed
+ *        after every commit_every executed batches.
+ * @return The number of transferred parameter sets
+ */
+std::size_t insert_record_batches(turbodbc::command & command, cpp_odbc::connection const & connection,
+                                  arrow::RecordBatchReader & reader, std::size_t commit_every);
+
+/**
+ * @brief Send the rows of the reader as a table-valued parameter. Each record
+ *        batch is converted into the columns of the table parameter and the
+ *        statement is executed once per batch, or more often if the batch
+ *        exceeds the number of buffered sets.
+ * @param table_parameter Parameter set created by command::make_table_parameter()
+ * @return The number of transferred rows
+ */
+std::size_t insert_table_parameter_batches(turbodbc::bound_parameter_set & table_parameter,
+                                           arrow::RecordBatchReader & reader);
+
+/**
+ * @brief Import a reader from source, which is either an object implementing
+ *        the __arrow_c_stream__ protocol or an "arrow_array_stream" PyCapsule
+ */
+std::shared_ptr<arrow::RecordBatchReader> import_arrow_stream(pybind11::object const & source);
+
+/**
+ * @brief Insert all rows of source, which is either an object implementing
+ *        the __arrow_c_stream__ protocol (e.g. pyarrow.RecordBatchReader) or
+ *        an "arrow_array_stream" PyCapsule, using the cursor's prepared
+ *        statement. The GIL is released while data is converted and sent.
+ * @return The number of transferred parameter sets
+ */
+std::size_t insert_arrow_stream(turbodbc::cursor & cursor, pybind11::object const & source, std::size_t commit_every);
+
+/**
+ * @brief Execute the cursor's prepared statement, e.g. "EXEC proc @rows = ?", with
+ *        all rows of source bound as a single table-valued parameter of the
+ *        SQL Server table type table_type_name.
+ *        Source is read like in insert_arrow_stream(). The GIL is released while
+ *        data is converted and sent.
+ * @return The number of transferred rows
+ */
+std::size_t insert_arrow_table_parameter(turbodbc::cursor & cursor, std::string const & table_type_name,
+                                         pybind11::object const & source);
+
 }
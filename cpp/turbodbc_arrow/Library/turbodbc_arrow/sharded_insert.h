@@ -0,0 +1,88 @@
+#pragma once
+
+#include <turbodbc/configuration.h>
+#include <turbodbc/connection.h>
+
+#undef BOOL
+#undef timezone
+#include <arrow/api.h>
+#include <pybind11/pybind11.h>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace turbodbc_arrow {
+
+/**
+ * @brief Outcome of the rows one worker of a sharded insert was responsible for
+ */
+struct shard_result {
+    std::size_t transferred_sets;   ///< number of rows inserted and committed, zero if the shard failed
+    std::string error;              ///< empty if the shard succeeded
+};
+
+/**
+ * @brief Split a record batch into at most number_of_shards contiguous row ranges
+ *        of roughly equal size. Ranges have at least minimum_rows rows so that
+ *        small batches are not cut into pieces too small to fill parameter buffers.
+ *        Slices share the buffers of the batch.
+ */
+std::vector<std::shared_ptr<arrow::RecordBatch>> partition_by_row_ranges(std::shared_ptr<arrow::RecordBatch> const & batch,
+                                                                         std::size_t number_of_shards,
+                                                                         std::size_t minimum_rows);
+
+/**
+ * @brief Split a record batch into number_of_shards batches based on a hash
+ *        of the values of the key columns. Rows with equal keys are assigned to
+ *        the same shard, also across batches. Rows keep their relative order.
+ * @param key_columns Indices of the key columns. Key columns may have fixed-width,
+ *        boolean, binary, string, or dictionary-encoded types.
+ */
+std::vector<std::shared_ptr<arrow::RecordBatch>> partition_by_hash(std::shared_ptr<arrow::RecordBatch> const & batch,
+                                                                   std::vector<int> const & key_columns,
+                                                                   std::size_t number_of_shards);
+
+using connection_factory = std::function<turbodbc::connection()>;
+
+/**
+ * @brief Insert all rows of the reader concurrently over several connections.
+ *        Each of the workers opens its own connection, prepares sql, and inserts
+ *        the rows assigned to it like insert_record_batches(). Without key columns,
+ *        record batches are split into row ranges which idle workers pick up.
+ *        With key columns, rows are hash partitioned so that each worker inserts
+ *        a fixed subset of the keys, which avoids lock contention between workers.
+ *
+ *        Each worker commits its own transaction when its rows are exhausted, and
+ *        after every commit_every executed batches if commit_every is positive.
+ *        A failing worker rolls back its uncommitted rows and reports the error
+ *        in its result while the other workers carry on. Rows of failed workers
+ *        may have been committed partially if commit_every is positive.
+ * @param connect Called once by each worker to establish its connection
+ * @return One result per worker
+ */
+std::vector<shard_result> insert_sharded(connection_factory const & connect,
+                                         std::string const & sql,
+                                         arrow::RecordBatchReader & reader,
+                                         std::size_t workers,
+                                         std::vector<int> const & key_columns,
+                                         std::size_t commit_every);
+
+/**
+ * @brief Insert all rows of source, which is either an object implementing the
+ *        __arrow_c_stream__ protocol (e.g. pyarrow.Table) or an "arrow_array_stream"
+ *        PyCapsule, with workers connections to the database identified by
+ *        connection_string. See insert_sharded(). The GIL is released while rows
+ *        are inserted.
+ * @param key_columns Names of the columns to hash partition by, may be empty
+ */
+std::vector<shard_result> insert_arrow_sharded(std::string const & connection_string,
+                                               turbodbc::options const & options,
+                                               std::string const & sql,
+                                               pybind11::object const & source,
+                                               std::size_t workers,
+                                               std::vector<std::string> const & key_columns,
+                                               std::size_t commit_every);
+
+}
@@ -2,15 +2,20 @@
 
 #include <list>
 #include <random>
+#include <thread>
 
 #undef BOOL
 #undef timezone
 #include <arrow/api.h>
+#include <arrow/c/abi.h>
+#include <arrow/c/bridge.h>
 #include <arrow/testing/gtest_util.h>
 #include <arrow/testing/util.h>
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include <sql.h>
+#include <sqlext.h>
+#include <turbodbc/sql_server_types.h>
 
 using arrow::StringDictionaryBuilder;
 
@@ -31,6 +36,10 @@ namespace {
         MOCK_CONST_METHOD0(do_get_buffers, std::vector<std::reference_wrapper<cpp_odbc::multi_value_buffer const>>());
     };
 
+    struct mock_bindable_result_set : public mock_result_set {
+        MOCK_METHOD2(do_bind_external_data, bool(std::size_t, char *));
+    };
+
     template <typename ArrowType>
     void make_int_range(int64_t size, std::shared_ptr<arrow::Array>* out) {
         typename arrow::TypeTraits<ArrowType>::BuilderType builder;
@@ -62,7 +71,11 @@ class ArrowResultSetTest : public ::testing::Test {
         }
 
         void MockSchema(std::vector<turbodbc::column_info> schema) {
-            EXPECT_CALL(rs, do_get_column_info()).WillRepeatedly(testing::Return(schema));
+            MockSchema(rs, schema);
+        }
+
+        void MockSchema(mock_result_set & result_set, std::vector<turbodbc::column_info> schema) {
+            EXPECT_CALL(result_set, do_get_column_info()).WillRepeatedly(testing::Return(schema));
         }
 
         // This only works on PrimitiveArrays of a FixedWidthType
@@ -81,18 +94,23 @@ class ArrowResultSetTest : public ::testing::Test {
         }
 
         void MockOutput(std::vector<std::vector<std::reference_wrapper<cpp_odbc::multi_value_buffer const>>> buffers_vec) {
+            MockOutput(rs, buffers_vec);
+        }
+
+        void MockOutput(mock_result_set & result_set,
+                        std::vector<std::vector<std::reference_wrapper<cpp_odbc::multi_value_buffer const>>> buffers_vec) {
             {
                 testing::InSequence sequence;
                 for (auto&& buffers: buffers_vec) {
-                    EXPECT_CALL(rs, do_get_buffers()).WillOnce(testing::Return(buffers)).RetiresOnSaturation();
+                    EXPECT_CALL(result_set, do_get_buffers()).WillOnce(testing::Return(buffers)).RetiresOnSaturation();
                 }
             }
             {
                 testing::InSequence sequence;
                 for (auto&& buffers: buffers_vec) {
-                    EXPECT_CALL(rs, do_fetch_next_batch()).WillOnce(testing::Return(buffers[0].get().number_of_elements())).RetiresOnSaturation();
+                    EXPECT_CALL(result_set, do_fetch_next_batch()).WillOnce(testing::Return(buffers[0].get().number_of_elements())).RetiresOnSaturation();
                 }
-                EXPECT_CALL(rs, do_fetch_next_batch()).WillOnce(testing::Return(0)).RetiresOnSaturation();
+                EXPECT_CALL(result_set, do_fetch_next_batch()).WillOnce(testing::Return(0)).RetiresOnSaturation();
             }
         }
 
@@ -133,6 +151,26 @@ class ArrowResultSetTest : public ::testing::Test {
             ASSERT_TRUE(expected_table->Equals(*table));
         }
 
+        void CheckZeroCopyRoundtrip() {
+            auto schema = std::make_shared<arrow::Schema>(expected_fields);
+            std::shared_ptr<arrow::Table> expected_table = arrow::Table::Make(schema, expected_arrays);
+
+            turbodbc_arrow::arrow_result_set ars(rs, strings_as_strings, plain_integers, true);
+            std::shared_ptr<arrow::Table> table;
+            ASSERT_OK(ars.fetch_all_native(&table, false));
+            ASSERT_TRUE(expected_table->Equals(*table));
+        }
+
+        void CheckParallelRoundtrip(bool zero_copy) {
+            auto schema = std::make_shared<arrow::Schema>(expected_fields);
+            std::shared_ptr<arrow::Table> expected_table = arrow::Table::Make(schema, expected_arrays);
+
+            turbodbc_arrow::arrow_result_set ars(rs, strings_as_strings, plain_integers, zero_copy, 4);
+            std::shared_ptr<arrow::Table> table;
+            ASSERT_OK(ars.fetch_all_native(&table, false));
+            ASSERT_TRUE(expected_table->Equals(*table));
+        }
+
     protected:
         mock_result_set rs;
         arrow::MemoryPool* pool;
@@ -278,6 +316,47 @@ TEST_F(ArrowResultSetTest, MultiBatchConversionFloat)
     CheckRoundtrip(strings_as_strings, plain_integers);
 }
 
+TEST_F(ArrowResultSetTest, MultiBatchConversionNarrowNumerics)
+{
+    // Random bit patterns may be NaN, which do not compare equal
+    arrow::FloatBuilder float_builder;
+    for (int64_t i = 0; i < 2 * OUTPUT_SIZE; i++) {
+        if (i % 3 == 0) {
+            ASSERT_OK(float_builder.AppendNull());
+        } else {
+            ASSERT_OK(float_builder.Append(0.5f * i));
+        }
+    }
+    std::shared_ptr<arrow::Array> float_array;
+    ASSERT_OK(float_builder.Finish(&float_array));
+    std::shared_ptr<arrow::Array> int8_array = MakePrimitive<arrow::Int8Array>(2 * OUTPUT_SIZE, OUTPUT_SIZE / 3);
+    std::shared_ptr<arrow::Array> int16_array = MakePrimitive<arrow::Int16Array>(2 * OUTPUT_SIZE, OUTPUT_SIZE / 3);
+    std::shared_ptr<arrow::Array> int32_array = MakePrimitive<arrow::Int32Array>(2 * OUTPUT_SIZE);
+
+    expected_arrays = {int8_array, int16_array, int32_array, float_array};
+    expected_fields = {arrow::field("int8_column", arrow::int8(), true),
+                       arrow::field("int16_column", arrow::int16(), true),
+                       arrow::field("int32_column", arrow::int32(), false),
+                       arrow::field("float_column", arrow::float32(), true)};
+
+    MockSchema({{"int8_column", turbodbc::type_code::integer_8, sizeof(int8_t), true},
+            {"int16_column", turbodbc::type_code::integer_16, sizeof(int16_t), true},
+            {"int32_column", turbodbc::type_code::integer_32, sizeof(int32_t), false},
+            {"float_column", turbodbc::type_code::floating_point_32, sizeof(float), true}});
+    MockOutput({{BufferFromPrimitive(int8_array, OUTPUT_SIZE, 0), BufferFromPrimitive(int16_array, OUTPUT_SIZE, 0),
+                 BufferFromPrimitive(int32_array, OUTPUT_SIZE, 0), BufferFromPrimitive(float_array, OUTPUT_SIZE, 0)},
+            {BufferFromPrimitive(int8_array, OUTPUT_SIZE, OUTPUT_SIZE), BufferFromPrimitive(int16_array, OUTPUT_SIZE, OUTPUT_SIZE),
+             BufferFromPrimitive(int32_array, OUTPUT_SIZE, OUTPUT_SIZE), BufferFromPrimitive(float_array, OUTPUT_SIZE, OUTPUT_SIZE)}});
+    // adaptive integers do not affect columns which already have a narrow type
+    CheckRoundtrip(strings_as_strings, compressed_integers);
+
+    MockOutput({{BufferFromPrimitive(int8_array, OUTPUT_SIZE, 0), BufferFromPrimitive(int16_array, OUTPUT_SIZE, 0),
+                 BufferFromPrimitive(int32_array, OUTPUT_SIZE, 0), BufferFromPrimitive(float_array, OUTPUT_SIZE, 0)},
+            {BufferFromPrimitive(int8_array, OUTPUT_SIZE, OUTPUT_SIZE), BufferFromPrimitive(int16_array, OUTPUT_SIZE, OUTPUT_SIZE),
+             BufferFromPrimitive(int32_array, OUTPUT_SIZE, OUTPUT_SIZE), BufferFromPrimitive(float_array, OUTPUT_SIZE, OUTPUT_SIZE)}});
+    CheckZeroCopyRoundtrip();
+}
+
 TEST_F(ArrowResultSetTest, MultiBatchConversionBoolean)
 {
     std::shared_ptr<arrow::Array> array;
@@ -405,6 +484,125 @@ TEST_F(ArrowResultSetTest, MultiBatchConversionString)
     CheckRoundtrip(strings_as_dictionaries, plain_integers);
 }
 
+TEST_F(ArrowResultSetTest, MultiBatchConversionUnicode)
+{
+    // Mix ASCII with two, three and four byte UTF-8 sequences
+    std::vector<std::u16string> const words = {u"plain ascii text", u"gr\u00fc\u00dfe", u"\u20ac\u4e2d", u"\U0001F600!"};
+    std::vector<std::string> const utf8_words = {"plain ascii text", "gr\xC3\xBC\xC3\x9F" "e", "\xE2\x82\xAC\xE4\xB8\xAD", "\xF0\x9F\x98\x80!"};
+    std::size_t const element_size = 2 * (16 + 1);
+
+    std::shared_ptr<arrow::Array> array;
+    cpp_odbc::multi_value_buffer buffer_1(element_size, OUTPUT_SIZE);
+    cpp_odbc::multi_value_buffer buffer_1_2(element_size, OUTPUT_SIZE);
+    {
+        arrow::StringBuilder builder(pool);
+        for (int64_t i = 0; i < 2 * OUTPUT_SIZE; i++) {
+            auto& buffer = (i < OUTPUT_SIZE) ? buffer_1 : buffer_1_2;
+            auto const row = i % OUTPUT_SIZE;
+            if (i % 5 == 0) {
+                ASSERT_OK(builder.AppendNull());
+                buffer.indicator_pointer()[row] = SQL_NULL_DATA;
+            } else {
+                auto const& word = words[i % words.size()];
+                ASSERT_OK(builder.Append(utf8_words[i % words.size()]));
+                memcpy(buffer[row].data_pointer, word.c_str(), 2 * (word.size() + 1));
+                buffer[row].indicator = 2 * word.size();
+            }
+        }
+        ASSERT_OK(builder.Finish(&array));
+    }
+    expected_arrays.push_back(array);
+    expected_fields.push_back(arrow::field("unicode_column", arrow::utf8(), true));
+
+    MockSchema({{"unicode_column", turbodbc::type_code::unicode, element_size, true}});
+    MockOutput({{buffer_1}, {buffer_1_2}});
+    CheckRoundtrip(strings_as_strings, plain_integers);
+}
+
+TEST_F(ArrowResultSetTest, MultiBatchParallelConversion)
+{
+    std::vector<std::u16string> const words = {u"plain ascii text", u"gr\u00fc\u00dfe", u"\u20ac\u4e2d"};
+    std::vector<std::string> const utf8_words = {"plain ascii text", "gr\xC3\xBC\xC3\x9F" "e", "\xE2\x82\xAC\xE4\xB8\xAD"};
+    std::size_t const element_size = 2 * (16 + 1);
+
+    std::shared_ptr<arrow::Array> int_array = MakePrimitive<arrow::Int64Array>(2 * OUTPUT_SIZE, OUTPUT_SIZE / 3);
+    std::shared_ptr<arrow::Array> float_array = MakePrimitive<arrow::DoubleArray>(2 * OUTPUT_SIZE, OUTPUT_SIZE / 5);
+    std::shared_ptr<arrow::Array> unicode_array;
+    cpp_odbc::multi_value_buffer unicode_1(element_size, OUTPUT_SIZE);
+    cpp_odbc::multi_value_buffer unicode_2(element_size, OUTPUT_SIZE);
+    {
+        arrow::StringBuilder builder(pool);
+        for (int64_t i = 0; i < 2 * OUTPUT_SIZE; i++) {
+            auto& buffer = (i < OUTPUT_SIZE) ? unicode_1 : unicode_2;
+            auto const row = i % OUTPUT_SIZE;
+            if (i % 5 == 0) {
+                ASSERT_OK(builder.AppendNull());
+                buffer.indicator_pointer()[row] = SQL_NULL_DATA;
+            } else {
+                auto const& word = words[i % words.size()];
+                ASSERT_OK(builder.Append(utf8_words[i % words.size()]));
+                memcpy(buffer[row].data_pointer, word.c_str(), 2 * (word.size() + 1));
+                buffer[row].indicator = 2 * word.size();
+            }
+        }
+        ASSERT_OK(builder.Finish(&unicode_array));
+    }
+    expected_arrays = {int_array, unicode_array, float_array};
+    expected_fields = {arrow::field("int_column", arrow::int64(), true),
+                       arrow::field("unicode_column", arrow::utf8(), true),
+                       arrow::field("float_column", arrow::float64(), true)};
+
+    MockSchema({{"int_column", turbodbc::type_code::integer, size_unimportant, true},
+            {"unicode_column", turbodbc::type_code::unicode, element_size, true},
+            {"float_column", turbodbc::type_code::floating_point, size_unimportant, true}});
+    MockOutput({{BufferFromPrimitive(int_array, OUTPUT_SIZE, 0), unicode_1, BufferFromPrimitive(float_array, OUTPUT_SIZE, 0)},
+            {BufferFromPrimitive(int_array, OUTPUT_SIZE, OUTPUT_SIZE), unicode_2, BufferFromPrimitive(float_array, OUTPUT_SIZE, OUTPUT_SIZE)}});
+    CheckParallelRoundtrip(false);
+
+    MockOutput({{BufferFromPrimitive(int_array, OUTPUT_SIZE, 0), unicode_1, BufferFromPrimitive(float_array, OUTPUT_SIZE, 0)},
+            {BufferFromPrimitive(int_array, OUTPUT_SIZE, OUTPUT_SIZE), unicode_2, BufferFromPrimitive(float_array, OUTPUT_SIZE, OUTPUT_SIZE)}});
+    CheckParallelRoundtrip(true);
+}
+
+TEST_F(ArrowResultSetTest, ParallelConversionFromSeveralThreads)
+{
+    // cursors of several threads share the conversion thread pool
+    std::size_t const n_threads = 4;
+    std::shared_ptr<arrow::Array> int_array = MakePrimitive<arrow::Int64Array>(2 * OUTPUT_SIZE, OUTPUT_SIZE / 3);
+    std::shared_ptr<arrow::Array> float_array = MakePrimitive<arrow::DoubleArray>(2 * OUTPUT_SIZE, OUTPUT_SIZE / 5);
+    auto const expected_table = arrow::Table::Make(
+        arrow::schema({arrow::field("int_column", arrow::int64(), true), arrow::field("float_column", arrow::float64(), true)}),
+        {int_array, float_array});
+
+    std::vector<std::unique_ptr<mock_result_set>> result_sets;
+    for (std::size_t i = 0; i != n_threads; ++i) {
+        result_sets.emplace_back(new mock_result_set());
+        MockSchema(*result_sets.back(), {{"int_column", turbodbc::type_code::integer, size_unimportant, true},
+                                         {"float_column", turbodbc::type_code::floating_point, size_unimportant, true}});
+        MockOutput(*result_sets.back(),
+                   {{BufferFromPrimitive(int_array, OUTPUT_SIZE, 0), BufferFromPrimitive(float_array, OUTPUT_SIZE, 0)},
+                    {BufferFromPrimitive(int_array, OUTPUT_SIZE, OUTPUT_SIZE), BufferFromPrimitive(float_array, OUTPUT_SIZE, OUTPUT_SIZE)}});
+    }
+
+    std::vector<std::shared_ptr<arrow::Table>> tables(n_threads);
+    std::vector<arrow::Status> statuses(n_threads);
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i != n_threads; ++i) {
+        threads.emplace_back([&, i]() {
+            turbodbc_arrow::arrow_result_set ars(*result_sets[i], strings_as_strings, plain_integers, i % 2 == 0, 2);
+            statuses[i] = ars.fetch_all_native(&tables[i], false);
+        });
+    }
+    for (auto & thread : threads) {
+        thread.join();
+    }
+
+    for (std::size_t i = 0; i != n_threads; ++i) {
+        ASSERT_OK(statuses[i]);
+        EXPECT_TRUE(expected_table->Equals(*tables[i]));
+    }
+}
+
 TEST_F(ArrowResultSetTest, MultiBatchConversionTimestamp)
 {
     std::shared_ptr<arrow::Array> array;
@@ -476,4 +674,474 @@ TEST_F(ArrowResultSetTest, MultiBatchConversionTimestamp)
             {"nonnull_timestamp_column", turbodbc::type_code::timestamp, size_unimportant, false}});
     MockOutput({{buffer_1, buffer_2}, {buffer_1_2, buffer_2_2}});
     CheckRoundtrip(strings_as_strings, plain_integers);
+
+    // Timestamps are converted without a builder in this mode
+    MockOutput({{buffer_1, buffer_2}, {buffer_1_2, buffer_2_2}});
+    CheckZeroCopyRoundtrip();
+}
+
+TEST_F(ArrowResultSetTest, MultiBatchConversionDecimal)
+{
+    auto const type = arrow::decimal128(20, 4);
+    std::shared_ptr<arrow::Array> array;
+    cpp_odbc::multi_value_buffer buffer_1(sizeof(SQL_NUMERIC_STRUCT), OUTPUT_SIZE);
+    cpp_odbc::multi_value_buffer buffer_1_2(sizeof(SQL_NUMERIC_STRUCT), OUTPUT_SIZE);
+    {
+        arrow::Decimal128Builder builder(type, pool);
+        for (int64_t i = 0; i < 2 * OUTPUT_SIZE; i++) {
+            auto & buffer = (i < OUTPUT_SIZE) ? buffer_1 : buffer_1_2;
+            auto const row = i % OUTPUT_SIZE;
+            if (i % 5 == 0) {
+                ASSERT_OK(builder.AppendNull());
+                buffer.indicator_pointer()[row] = SQL_NULL_DATA;
+            } else {
+                // magnitudes beyond 64 bits exercise the upper half of the value
+                int64_t const value = (i % 2 == 0) ? i * 12345 : -i;
+                ASSERT_OK(builder.Append(arrow::Decimal128(i % 3, static_cast<uint64_t>(value))));
+                arrow::Decimal128 const decimal(i % 3, static_cast<uint64_t>(value));
+                arrow::Decimal128 magnitude(decimal);
+                magnitude.Abs();
+                auto numeric = reinterpret_cast<SQL_NUMERIC_STRUCT*>(buffer.data_pointer()) + row;
+                numeric->precision = 20;
+                numeric->scale = 4;
+                numeric->sign = decimal.Sign() < 0 ? 0 : 1;
+                uint64_t const low = magnitude.low_bits();
+                uint64_t const high = static_cast<uint64_t>(magnitude.high_bits());
+                for (int byte = 0; byte != 8; ++byte) {
+                    numeric->val[byte] = static_cast<SQLCHAR>(low >> (8 * byte));
+                    numeric->val[byte + 8] = static_cast<SQLCHAR>(high >> (8 * byte));
+                }
+                buffer.indicator_pointer()[row] = sizeof(SQL_NUMERIC_STRUCT);
+            }
+        }
+        ASSERT_OK(builder.Finish(&array));
+    }
+    expected_arrays.push_back(array);
+    expected_fields.push_back(arrow::field("decimal_column", type, true));
+
+    MockSchema({{"decimal_column", turbodbc::type_code::decimal, sizeof(SQL_NUMERIC_STRUCT), true, 20, 4}});
+    MockOutput({{buffer_1}, {buffer_1_2}});
+    CheckRoundtrip(strings_as_strings, plain_integers);
+
+    // Decimals are converted without a builder in this mode
+    MockOutput({{buffer_1}, {buffer_1_2}});
+    CheckZeroCopyRoundtrip();
+}
+
+TEST_F(ArrowResultSetTest, MultiBatchConversionBinaryAndRowversion)
+{
+    std::size_t const binary_size = 6;
+    std::shared_ptr<arrow::Array> binary_array;
+    std::shared_ptr<arrow::Array> rowversion_array;
+    cpp_odbc::multi_value_buffer binary_1(binary_size, OUTPUT_SIZE);
+    cpp_odbc::multi_value_buffer binary_2(binary_size, OUTPUT_SIZE);
+    cpp_odbc::multi_value_buffer rowversion_1(sizeof(uint64_t), OUTPUT_SIZE);
+    cpp_odbc::multi_value_buffer rowversion_2(sizeof(uint64_t), OUTPUT_SIZE);
+    {
+        arrow::BinaryBuilder binary_builder(pool);
+        arrow::UInt64Builder rowversion_builder(pool);
+        for (int64_t i = 0; i < 2 * OUTPUT_SIZE; i++) {
+            auto & binary = (i < OUTPUT_SIZE) ? binary_1 : binary_2;
+            auto & rowversion = (i < OUTPUT_SIZE) ? rowversion_1 : rowversion_2;
+            auto const row = i % OUTPUT_SIZE;
+            if (i % 7 == 0) {
+                ASSERT_OK(binary_builder.AppendNull());
+                ASSERT_OK(rowversion_builder.AppendNull());
+                binary.indicator_pointer()[row] = SQL_NULL_DATA;
+                rowversion.indicator_pointer()[row] = SQL_NULL_DATA;
+            } else {
+                // embedded zero bytes must survive
+                std::string const value(static_cast<std::size_t>(i % binary_size), static_cast<char>(i % 3));
+                ASSERT_OK(binary_builder.Append(value));
+                std::memcpy(binary[row].data_pointer, value.data(), value.size());
+                binary.indicator_pointer()[row] = value.size();
+
+                uint64_t const version = 0x0102030405060708ULL * static_cast<uint64_t>(i);
+                ASSERT_OK(rowversion_builder.Append(version));
+                for (std::size_t byte = 0; byte != sizeof(uint64_t); ++byte) {
+                    rowversion[row].data_pointer[byte] = static_cast<char>(version >> (8 * (7 - byte)));
+                }
+                rowversion.indicator_pointer()[row] = sizeof(uint64_t);
+            }
+        }
+        ASSERT_OK(binary_builder.Finish(&binary_array));
+        ASSERT_OK(rowversion_builder.Finish(&rowversion_array));
+    }
+    expected_arrays = {binary_array, rowversion_array};
+    expected_fields = {arrow::field("binary_column", arrow::binary(), true),
+                       arrow::field("rowversion_column", arrow::uint64(), true)};
+
+    MockSchema({{"binary_column", turbodbc::type_code::binary, binary_size, true},
+            {"rowversion_column", turbodbc::type_code::rowversion, sizeof(uint64_t), true}});
+    MockOutput({{binary_1, rowversion_1}, {binary_2, rowversion_2}});
+    CheckRoundtrip(strings_as_strings, plain_integers);
+
+    // Binary values are not affected by dictionary encoding of strings
+    MockOutput({{binary_1, rowversion_1}, {binary_2, rowversion_2}});
+    CheckRoundtrip(strings_as_dictionaries, plain_integers);
+
+    MockOutput({{binary_1, rowversion_1}, {binary_2, rowversion_2}});
+    CheckZeroCopyRoundtrip();
+}
+
+TEST_F(ArrowResultSetTest, ConversionSqlServerTemporalAndGuid)
+{
+    cpp_odbc::multi_value_buffer times(sizeof(turbodbc::ss_time2_struct), 2);
+    cpp_odbc::multi_value_buffer offsets(sizeof(turbodbc::ss_timestampoffset_struct), 2);
+    cpp_odbc::multi_value_buffer guids(sizeof(SQLGUID), 2);
+
+    *reinterpret_cast<turbodbc::ss_time2_struct*>(times[0].data_pointer) = {1, 2, 3, 400};
+    times.indicator_pointer()[0] = sizeof(turbodbc::ss_time2_struct);
+    times.indicator_pointer()[1] = SQL_NULL_DATA;
+    *reinterpret_cast<turbodbc::ss_timestampoffset_struct*>(offsets[0].data_pointer) = {1970, 1, 1, 2, 0, 0, 5, 1, 0};
+    offsets.indicator_pointer()[0] = sizeof(turbodbc::ss_timestampoffset_struct);
+    offsets.indicator_pointer()[1] = SQL_NULL_DATA;
+    *reinterpret_cast<SQLGUID*>(guids[0].data_pointer) = {0x00010203, 0x0405, 0x0607, {8, 9, 10, 11, 12, 13, 14, 15}};
+    guids.indicator_pointer()[0] = sizeof(SQLGUID);
+    guids.indicator_pointer()[1] = SQL_NULL_DATA;
+
+    std::shared_ptr<arrow::Array> time_array;
+    {
+        arrow::Time64Builder builder(arrow::time64(arrow::TimeUnit::NANO), pool);
+        ASSERT_OK(builder.Append(3723000000400));
+        ASSERT_OK(builder.AppendNull());
+        ASSERT_OK(builder.Finish(&time_array));
+    }
+    std::shared_ptr<arrow::Array> offset_array;
+    {
+        arrow::TimestampBuilder builder(arrow::timestamp(arrow::TimeUnit::MICRO, "UTC"), pool);
+        ASSERT_OK(builder.Append(3600000000));
+        ASSERT_OK(builder.AppendNull());
+        ASSERT_OK(builder.Finish(&offset_array));
+    }
+    std::shared_ptr<arrow::Array> guid_array;
+    {
+        arrow::FixedSizeBinaryBuilder builder(arrow::fixed_size_binary(16), pool);
+        uint8_t const bytes[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+        ASSERT_OK(builder.Append(bytes));
+        ASSERT_OK(builder.AppendNull());
+        ASSERT_OK(builder.Finish(&guid_array));
+    }
+    expected_arrays = {time_array, offset_array, guid_array};
+    expected_fields = {arrow::field("time_column", arrow::time64(arrow::TimeUnit::NANO), true),
+                       arrow::field("offset_column", arrow::timestamp(arrow::TimeUnit::MICRO, "UTC"), true),
+                       arrow::field("guid_column", arrow::fixed_size_binary(16), true)};
+
+    MockSchema({{"time_column", turbodbc::type_code::time, sizeof(turbodbc::ss_time2_struct), true},
+            {"offset_column", turbodbc::type_code::timestamp_offset, sizeof(turbodbc::ss_timestampoffset_struct), true},
+            {"guid_column", turbodbc::type_code::guid, sizeof(SQLGUID), true}});
+    MockOutput({{times, offsets, guids}});
+    CheckRoundtrip(strings_as_strings, plain_integers);
+
+    MockOutput({{times, offsets, guids}});
+    CheckZeroCopyRoundtrip();
+}
+
+TEST_F(ArrowResultSetTest, ZeroCopyMultiBatchConversion)
+{
+    std::shared_ptr<arrow::Array> int_array = MakePrimitive<arrow::Int64Array>(2 * OUTPUT_SIZE, OUTPUT_SIZE / 3);
+    expected_arrays.push_back(int_array);
+    expected_fields.push_back(arrow::field("int_column", arrow::int64(), true));
+    std::shared_ptr<arrow::Array> float_array = MakePrimitive<arrow::DoubleArray>(2 * OUTPUT_SIZE);
+    expected_arrays.push_back(float_array);
+    expected_fields.push_back(arrow::field("nonnull_float_column", arrow::float64(), false));
+
+    std::shared_ptr<arrow::Array> bool_array;
+    cpp_odbc::multi_value_buffer bool_buffer_1(sizeof(bool), OUTPUT_SIZE);
+    cpp_odbc::multi_value_buffer bool_buffer_2(sizeof(bool), OUTPUT_SIZE);
+    std::shared_ptr<arrow::Array> str_array;
+    cpp_odbc::multi_value_buffer str_buffer_1(4, OUTPUT_SIZE);
+    cpp_odbc::multi_value_buffer str_buffer_2(4, OUTPUT_SIZE);
+    {
+        arrow::BooleanBuilder bool_builder;
+        arrow::StringBuilder str_builder(pool);
+        for (int64_t i = 0; i < 2 * OUTPUT_SIZE; i++) {
+            auto& bool_buffer = (i < OUTPUT_SIZE) ? bool_buffer_1 : bool_buffer_2;
+            auto& str_buffer = (i < OUTPUT_SIZE) ? str_buffer_1 : str_buffer_2;
+            auto const row = i % OUTPUT_SIZE;
+            if (i % 5 == 0) {
+                ASSERT_OK(bool_builder.AppendNull());
+                bool_buffer.indicator_pointer()[row] = SQL_NULL_DATA;
+            } else {
+                ASSERT_OK(bool_builder.Append(i % 3 == 0));
+                *(bool_buffer[row].data_pointer) = (i % 3 == 0);
+            }
+            std::string str = std::to_string(i);
+            ASSERT_OK(str_builder.Append(str));
+            memcpy(str_buffer[row].data_pointer, str.c_str(), str.size() + 1);
+            str_buffer[row].indicator = str.size();
+        }
+        ASSERT_OK(bool_builder.Finish(&bool_array));
+        ASSERT_OK(str_builder.Finish(&str_array));
+    }
+    expected_arrays.push_back(bool_array);
+    expected_fields.push_back(arrow::field("bool_column", arrow::boolean(), true));
+    expected_arrays.push_back(str_array);
+    expected_fields.push_back(arrow::field("nonnull_str_column", arrow::utf8(), false));
+
+    MockSchema({{"int_column", turbodbc::type_code::integer, size_unimportant, true},
+            {"nonnull_float_column", turbodbc::type_code::floating_point, size_unimportant, false},
+            {"bool_column", turbodbc::type_code::boolean, size_unimportant, true},
+            {"nonnull_str_column", turbodbc::type_code::string, size_unimportant, false}});
+    MockOutput({{BufferFromPrimitive(int_array, OUTPUT_SIZE, 0), BufferFromPrimitive(float_array, OUTPUT_SIZE, 0), bool_buffer_1, str_buffer_1},
+            {BufferFromPrimitive(int_array, OUTPUT_SIZE, OUTPUT_SIZE), BufferFromPrimitive(float_array, OUTPUT_SIZE, OUTPUT_SIZE), bool_buffer_2, str_buffer_2}});
+    CheckZeroCopyRoundtrip();
+}
+
+TEST_F(ArrowResultSetTest, ZeroCopyFetchesIntoArrowMemory)
+{
+    mock_bindable_result_set bindable_rs;
+    std::shared_ptr<arrow::Array> array = MakePrimitive<arrow::Int64Array>(2 * OUTPUT_SIZE, OUTPUT_SIZE / 3);
+    auto const values = std::static_pointer_cast<arrow::Int64Array>(array)->raw_values();
+
+    std::vector<turbodbc::column_info> schema = {{"int_column", turbodbc::type_code::integer, sizeof(int64_t), true}};
+    EXPECT_CALL(bindable_rs, do_get_column_info()).WillRepeatedly(testing::Return(schema));
+
+    // The second batch only carries indicators, values must arrive through the bound memory
+    auto const& first_batch = BufferFromPrimitive(array, OUTPUT_SIZE, 0);
+    auto const& second_batch = BufferFromPrimitive(array, OUTPUT_SIZE, OUTPUT_SIZE);
+    memset(buffers.back().data_pointer(), 0, OUTPUT_SIZE * sizeof(int64_t));
+
+    char * bound = nullptr;
+    EXPECT_CALL(bindable_rs, do_bind_external_data(0, testing::_))
+        .WillRepeatedly(testing::Invoke([&bound](std::size_t, char * data) { bound = data; return true; }));
+    {
+        testing::InSequence sequence;
+        EXPECT_CALL(bindable_rs, do_get_buffers()).WillOnce(testing::Return(
+            std::vector<std::reference_wrapper<cpp_odbc::multi_value_buffer const>>{first_batch})).RetiresOnSaturation();
+        EXPECT_CALL(bindable_rs, do_get_buffers()).WillOnce(testing::Return(
+            std::vector<std::reference_wrapper<cpp_odbc::multi_value_buffer const>>{second_batch})).RetiresOnSaturation();
+    }
+    {
+        testing::InSequence sequence;
+        EXPECT_CALL(bindable_rs, do_fetch_next_batch()).WillOnce(testing::Return(OUTPUT_SIZE)).RetiresOnSaturation();
+        EXPECT_CALL(bindable_rs, do_fetch_next_batch()).WillOnce(testing::Invoke([&bound, values]() {
+            EXPECT_NE(bound, nullptr);
+            memcpy(bound, values + OUTPUT_SIZE, OUTPUT_SIZE * sizeof(int64_t));
+            return static_cast<std::size_t>(OUTPUT_SIZE);
+        })).RetiresOnSaturation();
+        EXPECT_CALL(bindable_rs, do_fetch_next_batch()).WillOnce(testing::Return(0)).RetiresOnSaturation();
+    }
+
+    turbodbc_arrow::arrow_result_set ars(bindable_rs, strings_as_strings, plain_integers, true);
+    std::shared_ptr<arrow::Table> table;
+    ASSERT_OK(ars.fetch_all_native(&table, false));
+    EXPECT_EQ(bound, nullptr);
+    ASSERT_EQ(table->column(0)->num_chunks(), 2);
+
+    auto expected_table = arrow::Table::Make(std::make_shared<arrow::Schema>(
+        std::vector<std::shared_ptr<arrow::Field>>{arrow::field("int_column", arrow::int64(), true)}), {array});
+    ASSERT_TRUE(expected_table->Equals(*table));
+}
+
+TEST_F(ArrowResultSetTest, RecordBatchReaderThroughCStream)
+{
+    std::shared_ptr<arrow::Array> array = MakePrimitive<arrow::Int64Array>(2 * OUTPUT_SIZE, OUTPUT_SIZE / 3);
+    expected_arrays.push_back(array);
+    expected_fields.push_back(arrow::field("int_column", arrow::int64(), true));
+    std::shared_ptr<arrow::Array> nonnull_array = MakePrimitive<arrow::DoubleArray>(2 * OUTPUT_SIZE);
+    expected_arrays.push_back(nonnull_array);
+    expected_fields.push_back(arrow::field("nonnull_float_column", arrow::float64(), false));
+
+    MockSchema({{"int_column", turbodbc::type_code::integer, size_unimportant, true},
+            {"nonnull_float_column", turbodbc::type_code::floating_point, size_unimportant, false}});
+    MockOutput({{BufferFromPrimitive(array, OUTPUT_SIZE, 0), BufferFromPrimitive(nonnull_array, OUTPUT_SIZE, 0)},
+            {BufferFromPrimitive(array, OUTPUT_SIZE, OUTPUT_SIZE), BufferFromPrimitive(nonnull_array, OUTPUT_SIZE, OUTPUT_SIZE)}});
+
+    turbodbc_arrow::arrow_result_set ars(rs, strings_as_strings, plain_integers);
+    ArrowArrayStream stream;
+    ASSERT_OK(arrow::ExportRecordBatchReader(ars.make_record_batch_reader(), &stream));
+    auto reader = arrow::ImportRecordBatchReader(&stream);
+    ASSERT_OK(reader.status());
+
+    std::vector<std::shared_ptr<arrow::RecordBatch>> batches;
+    std::shared_ptr<arrow::RecordBatch> batch;
+    ASSERT_OK((*reader)->ReadNext(&batch));
+    while (batch) {
+        batches.push_back(batch);
+        ASSERT_OK((*reader)->ReadNext(&batch));
+    }
+    ASSERT_EQ(batches.size(), 2);
+
+    auto table = arrow::Table::FromRecordBatches(batches);
+    ASSERT_OK(table.status());
+    auto expected_table = arrow::Table::Make(std::make_shared<arrow::Schema>(expected_fields), expected_arrays);
+    ASSERT_TRUE(expected_table->Equals(**table));
+}
+
+TEST_F(ArrowResultSetTest, RecordBatchReaderRespectsConversionOptions)
+{
+    mock_bindable_result_set bindable_rs;
+    std::shared_ptr<arrow::Array> array;
+    make_int_range<arrow::Int64Type>(OUTPUT_SIZE, &array);
+
+    MockSchema(bindable_rs, {{"int_column", turbodbc::type_code::integer, sizeof(int64_t), true}});
+    MockOutput(bindable_rs, {{BufferFromPrimitive(array, OUTPUT_SIZE / 2, 0)},
+                             {BufferFromPrimitive(array, OUTPUT_SIZE / 2, OUTPUT_SIZE / 2)}});
+    EXPECT_CALL(bindable_rs, do_bind_external_data(testing::_, testing::_)).Times(0);
+
+    turbodbc_arrow::arrow_result_set ars(bindable_rs, strings_as_strings, compressed_integers, false);
+    auto reader = ars.make_record_batch_reader();
+    ASSERT_TRUE(reader->schema()->Equals(arrow::Schema({arrow::field("int_column", arrow::int8(), true)})));
+
+    std::shared_ptr<arrow::RecordBatch> batch;
+    for (int i = 0; i != 2; ++i) {
+        ASSERT_OK(reader->ReadNext(&batch));
+        ASSERT_TRUE(batch);
+        EXPECT_EQ(batch->column(0)->type_id(), arrow::Type::INT8);
+        EXPECT_EQ(batch->num_rows(), OUTPUT_SIZE / 2);
+    }
+    ASSERT_OK(reader->ReadNext(&batch));
+    ASSERT_FALSE(batch);
+}
+
+TEST_F(ArrowResultSetTest, RecordBatchReaderEmptyResult)
+{
+    MockSchema({{"int_column", turbodbc::type_code::integer, size_unimportant, true}});
+    EXPECT_CALL(rs, do_fetch_next_batch()).WillOnce(testing::Return(0));
+
+    turbodbc_arrow::arrow_result_set ars(rs, strings_as_strings, plain_integers);
+    auto reader = ars.make_record_batch_reader();
+    ASSERT_TRUE(reader->schema()->Equals(arrow::Schema({arrow::field("int_column", arrow::int64(), true)})));
+
+    std::shared_ptr<arrow::RecordBatch> batch;
+    ASSERT_OK(reader->ReadNext(&batch));
+    ASSERT_FALSE(batch);
+}
+
+TEST_F(ArrowResultSetTest, CStreamOutlivesCursor)
+{
+    std::shared_ptr<arrow::Array> array = MakePrimitive<arrow::Int64Array>(2 * OUTPUT_SIZE, OUTPUT_SIZE / 3);
+    expected_arrays.push_back(array);
+    expected_fields.push_back(arrow::field("int_column", arrow::int64(), true));
+
+    auto cursor_result_set = std::make_shared<mock_result_set>();
+    std::weak_ptr<mock_result_set> observer = cursor_result_set;
+    MockSchema(*cursor_result_set, {{"int_column", turbodbc::type_code::integer, size_unimportant, true}});
+    MockOutput(*cursor_result_set, {{BufferFromPrimitive(array, OUTPUT_SIZE, 0)},
+            {BufferFromPrimitive(array, OUTPUT_SIZE, OUTPUT_SIZE)}});
+
+    ArrowArrayStream stream;
+    {
+        turbodbc_arrow::arrow_result_set ars(cursor_result_set, strings_as_strings, plain_integers, false, 1, 0);
+        ASSERT_OK(arrow::ExportRecordBatchReader(ars.make_record_batch_reader(), &stream));
+    }
+    // the cursor releases its result set before the stream is consumed
+    cursor_result_set.reset();
+    ASSERT_FALSE(observer.expired());
+
+    auto reader = arrow::ImportRecordBatchReader(&stream);
+    ASSERT_OK(reader.status());
+    auto table = (*reader)->ToTable();
+    ASSERT_OK(table.status());
+    auto expected_table = arrow::Table::Make(std::make_shared<arrow::Schema>(expected_fields), expected_arrays);
+    ASSERT_TRUE(expected_table->Equals(**table));
+
+    reader->reset();
+    ASSERT_TRUE(observer.expired());
+}
+
+TEST_F(ArrowResultSetTest, PipelinedRecordBatchReader)
+{
+    std::shared_ptr<arrow::Array> array = MakePrimitive<arrow::Int64Array>(3 * OUTPUT_SIZE, OUTPUT_SIZE / 3);
+    expected_arrays.push_back(array);
+    expected_fields.push_back(arrow::field("int_column", arrow::int64(), true));
+
+    MockSchema({{"int_column", turbodbc::type_code::integer, size_unimportant, true}});
+    MockOutput({{BufferFromPrimitive(array, OUTPUT_SIZE, 0)},
+            {BufferFromPrimitive(array, OUTPUT_SIZE, OUTPUT_SIZE)},
+            {BufferFromPrimitive(array, OUTPUT_SIZE, 2 * OUTPUT_SIZE)}});
+
+    std::size_t const pipeline_depth = 1;
+    turbodbc_arrow::arrow_result_set ars(rs, strings_as_strings, plain_integers, false, 1, pipeline_depth);
+    auto reader = ars.make_record_batch_reader();
+    ASSERT_TRUE(reader->schema()->Equals(arrow::Schema(expected_fields)));
+
+    std::vector<std::shared_ptr<arrow::RecordBatch>> batches;
+    std::shared_ptr<arrow::RecordBatch> batch;
+    ASSERT_OK(reader->ReadNext(&batch));
+    while (batch) {
+        batches.push_back(batch);
+        ASSERT_OK(reader->ReadNext(&batch));
+    }
+    ASSERT_EQ(batches.size(), 3);
+
+    // the reader remains exhausted
+    ASSERT_OK(reader->ReadNext(&batch));
+    ASSERT_FALSE(batch);
+
+    auto table = arrow::Table::FromRecordBatches(batches);
+    ASSERT_OK(table.status());
+    auto expected_table = arrow::Table::Make(std::make_shared<arrow::Schema>(expected_fields), expected_arrays);
+    ASSERT_TRUE(expected_table->Equals(**table));
+}
+
+TEST_F(ArrowResultSetTest, PipelinedRecordBatchReaderOutlivesCursor)
+{
+    std::shared_ptr<arrow::Array> array = MakePrimitive<arrow::Int64Array>(3 * OUTPUT_SIZE, OUTPUT_SIZE / 3);
+    expected_arrays.push_back(array);
+    expected_fields.push_back(arrow::field("int_column", arrow::int64(), true));
+
+    auto cursor_result_set = std::make_shared<mock_result_set>();
+    std::weak_ptr<mock_result_set> observer = cursor_result_set;
+    MockSchema(*cursor_result_set, {{"int_column", turbodbc::type_code::integer, size_unimportant, true}});
+    MockOutput(*cursor_result_set, {{BufferFromPrimitive(array, OUTPUT_SIZE, 0)},
+            {BufferFromPrimitive(array, OUTPUT_SIZE, OUTPUT_SIZE)},
+            {BufferFromPrimitive(array, OUTPUT_SIZE, 2 * OUTPUT_SIZE)}});
+
+    std::shared_ptr<arrow::RecordBatchReader> reader;
+    {
+        std::size_t const pipeline_depth = 1;
+        turbodbc_arrow::arrow_result_set ars(cursor_result_set, strings_as_strings, plain_integers, false, 1, pipeline_depth);
+        reader = ars.make_record_batch_reader();
+    }
+    // the converter thread keeps fetching after the cursor released its result set
+    cursor_result_set.reset();
+    ASSERT_FALSE(observer.expired());
+
+    auto table = reader->ToTable();
+    ASSERT_OK(table.status());
+    auto expected_table = arrow::Table::Make(std::make_shared<arrow::Schema>(expected_fields), expected_arrays);
+    ASSERT_TRUE(expected_table->Equals(**table));
+
+    reader.reset();
+    ASSERT_TRUE(observer.expired());
+}
+
+TEST_F(ArrowResultSetTest, PipelinedRecordBatchReaderForwardsErrors)
+{
+    std::shared_ptr<arrow::Array> array = MakePrimitive<arrow::Int64Array>(OUTPUT_SIZE);
+    MockSchema({{"int_column", turbodbc::type_code::integer, size_unimportant, true}});
+    EXPECT_CALL(rs, do_get_buffers()).WillOnce(testing::Return(std::vector<std::reference_wrapper<cpp_odbc::multi_value_buffer const>>{
+        BufferFromPrimitive(array, OUTPUT_SIZE, 0)}));
+    {
+        testing::InSequence sequence;
+        EXPECT_CALL(rs, do_fetch_next_batch()).WillOnce(testing::Return(OUTPUT_SIZE));
+        EXPECT_CALL(rs, do_fetch_next_batch()).WillOnce(testing::Throw(std::runtime_error("connection lost")));
+    }
+
+    turbodbc_arrow::arrow_result_set ars(rs, strings_as_strings, plain_integers, false, 1, 2);
+    auto reader = ars.make_record_batch_reader();
+
+    std::shared_ptr<arrow::RecordBatch> batch;
+    ASSERT_OK(reader->ReadNext(&batch));
+    ASSERT_EQ(batch->num_rows(), OUTPUT_SIZE);
+    auto const status = reader->ReadNext(&batch);
+    ASSERT_TRUE(status.IsIOError());
+    ASSERT_NE(status.message().find("connection lost"), std::string::npos);
+    ASSERT_FALSE(batch);
+}
+
+TEST_F(ArrowResultSetTest, PipelinedRecordBatchReaderEmptyResult)
+{
+    MockSchema({{"int_column", turbodbc::type_code::integer, size_unimportant, true}});
+    EXPECT_CALL(rs, do_fetch_next_batch()).WillOnce(testing::Return(0));
+
+    turbodbc_arrow::arrow_result_set ars(rs, strings_as_strings, plain_integers, false, 1, 2);
+    auto reader = ars.make_record_batch_reader();
+    ASSERT_TRUE(reader->schema()->Equals(arrow::Schema({arrow::field("int_column", arrow::int64(), true)})));
+
+    std::shared_ptr<arrow::RecordBatch> batch;
+    ASSERT_OK(reader->ReadNext(&batch));
+    ASSERT_FALSE(batch);
 }
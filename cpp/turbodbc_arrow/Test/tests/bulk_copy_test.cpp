@@ -0,0 +1,306 @@
+#include <turbodbc_arrow/bulk_copy.h>
+
+#include <cpp_odbc_test/level2_mock_api.h>
+
+#include <cpp_odbc/error.h>
+#include <turbodbc/errors.h>
+#include <turbodbc/sql_server_types.h>
+
+#undef BOOL
+#undef timezone
+#include <arrow/api.h>
+#include <arrow/testing/gtest_util.h>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <sqlext.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+using cpp_odbc_test::level2_mock_api;
+
+namespace {
+
+    // destinations for pointers, values irrelevant
+    int value_a = 17;
+    int value_b = 23;
+
+    cpp_odbc::level2::connection_handle const connection = {&value_a};
+    cpp_odbc::level2::bulk_copy_handle const handle = {&value_b, connection};
+
+    std::u16string const table = u"my_table";
+
+    struct sent_value {
+        SQLINTEGER length;
+        std::string bytes;
+
+        bool operator==(sent_value const & other) const
+        {
+            return (length == other.length) and (bytes == other.bytes);
+        }
+    };
+
+    using sent_row = std::vector<sent_value>;
+
+    sent_value null_value()
+    {
+        return {SQL_NULL_DATA, ""};
+    }
+
+    template <typename Value>
+    sent_value value_of(Value value)
+    {
+        return {sizeof(Value), std::string(reinterpret_cast<char const *>(&value), sizeof(Value))};
+    }
+
+    sent_value value_of(std::u16string const & value)
+    {
+        SQLINTEGER const length = value.size() * sizeof(char16_t);
+        return {length, std::string(reinterpret_cast<char const *>(value.data()), length)};
+    }
+
+    /**
+     * Simulates the bulk copy functions of the driver on top of a mock API:
+     * it records the values of each sent row and the order of all calls
+     * which send, commit, abort or finish rows.
+     */
+    struct bulk_copy_recorder {
+        explicit bulk_copy_recorder(level2_mock_api & api)
+        {
+            ON_CALL(api, do_initialize_bulk_copy(connection, table))
+                .WillByDefault(testing::Return(handle));
+            ON_CALL(api, do_set_bulk_copy_option(handle, testing::_, testing::_))
+                .WillByDefault(testing::Invoke([this](cpp_odbc::level2::bulk_copy_handle const &, int option, intptr_t) {
+                    if (option == turbodbc::bcp_abort) {
+                        events.push_back("abort");
+                    }
+                }));
+            ON_CALL(api, do_bind_bulk_copy_column(handle, testing::_, testing::_))
+                .WillByDefault(testing::Invoke([this](cpp_odbc::level2::bulk_copy_handle const &, int column_id, int data_type) {
+                    types[column_id] = data_type;
+                }));
+            ON_CALL(api, do_set_bulk_copy_column_data(handle, testing::_, testing::_, testing::_))
+                .WillByDefault(testing::Invoke([this](cpp_odbc::level2::bulk_copy_handle const &, int column_id, void const * data, SQLINTEGER length) {
+                    // like bcp_colptr(), reject null pointers
+                    ASSERT_NE(data, nullptr);
+                    auto const bytes = (length == SQL_NULL_DATA) ? 0 : length;
+                    current_row[column_id] = {length, std::string(static_cast<char const *>(data), bytes)};
+                }));
+            ON_CALL(api, do_send_bulk_copy_row(handle))
+                .WillByDefault(testing::Invoke([this](cpp_odbc::level2::bulk_copy_handle const &) {
+                    sent_row row;
+                    for (auto const & column : current_row) {
+                        row.push_back(column.second);
+                    }
+                    rows.push_back(row);
+                    events.push_back("row");
+                    ++uncommitted_rows;
+                }));
+            ON_CALL(api, do_commit_bulk_copy_batch(handle))
+                .WillByDefault(testing::Invoke([this](cpp_odbc::level2::bulk_copy_handle const &) {
+                    events.push_back("batch");
+                    return commit();
+                }));
+            ON_CALL(api, do_finish_bulk_copy(handle))
+                .WillByDefault(testing::Invoke([this](cpp_odbc::level2::bulk_copy_handle const &) {
+                    events.push_back("done");
+                    return commit();
+                }));
+        }
+
+        SQLINTEGER commit()
+        {
+            auto const committed = uncommitted_rows;
+            uncommitted_rows = 0;
+            return committed;
+        }
+
+        std::map<int, int> types;
+        std::map<int, sent_value> current_row;
+        SQLINTEGER uncommitted_rows = 0;
+        std::vector<sent_row> rows;
+        std::vector<std::string> events;
+    };
+
+    std::shared_ptr<arrow::RecordBatchReader> make_reader(std::shared_ptr<arrow::Schema> const & schema,
+                                                          std::vector<std::shared_ptr<arrow::RecordBatch>> batches)
+    {
+        auto reader = arrow::RecordBatchReader::Make(std::move(batches), schema);
+        EXPECT_OK(reader.status());
+        return *reader;
+    }
+
+    std::shared_ptr<arrow::Schema> make_int64_schema()
+    {
+        return arrow::schema({arrow::field("id", arrow::int64())});
+    }
+
+    // a single int64 column with values first, first + 1, ...
+    std::shared_ptr<arrow::RecordBatch> make_int64_batch(int64_t first, int64_t rows)
+    {
+        arrow::Int64Builder builder;
+        for (int64_t i = 0; i != rows; ++i) {
+            EXPECT_OK(builder.Append(first + i));
+        }
+        std::shared_ptr<arrow::Array> array;
+        EXPECT_OK(builder.Finish(&array));
+        return arrow::RecordBatch::Make(make_int64_schema(), rows, {array});
+    }
+
+    std::size_t copy(level2_mock_api const & api, arrow::RecordBatchReader & reader,
+                     std::size_t batch_size, bool table_lock)
+    {
+        return turbodbc_arrow::bulk_copy_record_batches(api, connection, table, reader, batch_size, table_lock);
+    }
+
+}
+
+
+TEST(BulkCopyTest, TypeTokens)
+{
+    std::vector<std::pair<std::shared_ptr<arrow::DataType>, int>> const types = {
+        {arrow::boolean(), turbodbc::bcp_types::bit},
+        {arrow::int8(), turbodbc::bcp_types::smallint},
+        {arrow::uint8(), turbodbc::bcp_types::tinyint},
+        {arrow::int16(), turbodbc::bcp_types::smallint},
+        {arrow::uint16(), turbodbc::bcp_types::integer},
+        {arrow::int32(), turbodbc::bcp_types::integer},
+        {arrow::uint32(), turbodbc::bcp_types::bigint},
+        {arrow::int64(), turbodbc::bcp_types::bigint},
+        {arrow::uint64(), turbodbc::bcp_types::numeric},
+        {arrow::float32(), turbodbc::bcp_types::real},
+        {arrow::float64(), turbodbc::bcp_types::float_},
+        {arrow::utf8(), turbodbc::bcp_types::nvarchar},
+        {arrow::large_utf8(), turbodbc::bcp_types::nvarchar},
+        {arrow::binary(), turbodbc::bcp_types::varbinary},
+        {arrow::large_binary(), turbodbc::bcp_types::varbinary},
+        {arrow::date32(), turbodbc::bcp_types::date},
+        {arrow::date64(), turbodbc::bcp_types::date},
+        {arrow::timestamp(arrow::TimeUnit::MICRO), turbodbc::bcp_types::datetime2},
+        {arrow::decimal128(10, 2), turbodbc::bcp_types::numeric},
+        {arrow::decimal256(38, 3), turbodbc::bcp_types::numeric}
+    };
+
+    arrow::FieldVector fields;
+    std::map<int, int> expected;
+    for (auto const & type : types) {
+        fields.push_back(arrow::field("column", type.first));
+        expected[fields.size()] = type.second;
+    }
+
+    testing::NiceMock<level2_mock_api> api;
+    bulk_copy_recorder recorder(api);
+    auto reader = make_reader(arrow::schema(fields), {});
+    EXPECT_EQ(0, copy(api, *reader, 0, false));
+    EXPECT_EQ(expected, recorder.types);
+}
+
+
+TEST(BulkCopyTest, UnsupportedTypes)
+{
+    for (auto const & type : {arrow::time32(arrow::TimeUnit::SECOND), arrow::decimal256(39, 0)}) {
+        testing::NiceMock<level2_mock_api> api;
+        EXPECT_CALL(api, do_initialize_bulk_copy(testing::_, testing::_)).Times(0);
+        auto reader = make_reader(arrow::schema({arrow::field("column", type)}), {});
+        EXPECT_THROW(copy(api, *reader, 0, false), turbodbc::interface_error);
+    }
+}
+
+
+TEST(BulkCopyTest, ColumnLengths)
+{
+    arrow::Int64Builder integers;
+    EXPECT_OK(integers.AppendValues({42, 0, -1}, {true, false, true}));
+    std::shared_ptr<arrow::Array> integer_array;
+    EXPECT_OK(integers.Finish(&integer_array));
+
+    arrow::Int8Builder bytes;
+    EXPECT_OK(bytes.AppendValues({-3, 0, 5}, {true, true, false}));
+    std::shared_ptr<arrow::Array> byte_array;
+    EXPECT_OK(bytes.Finish(&byte_array));
+
+    arrow::StringBuilder strings;
+    EXPECT_OK(strings.Append("hi"));
+    EXPECT_OK(strings.AppendNull());
+    EXPECT_OK(strings.Append("\xc3\xa4\xf0\x9f\x98\x80"));  // a-umlaut, smiley
+    std::shared_ptr<arrow::Array> string_array;
+    EXPECT_OK(strings.Finish(&string_array));
+
+    auto const schema = arrow::schema({arrow::field("integer", arrow::int64()),
+                                       arrow::field("byte", arrow::int8()),
+                                       arrow::field("string", arrow::utf8())});
+    auto reader = make_reader(schema, {arrow::RecordBatch::Make(schema, 3, {integer_array, byte_array, string_array})});
+
+    testing::NiceMock<level2_mock_api> api;
+    bulk_copy_recorder recorder(api);
+    EXPECT_EQ(3, copy(api, *reader, 0, false));
+
+    std::vector<sent_row> const expected = {
+        {value_of(int64_t(42)), value_of(int16_t(-3)), value_of(std::u16string(u"hi"))},
+        {null_value(), value_of(int16_t(0)), null_value()},
+        {value_of(int64_t(-1)), null_value(), value_of(std::u16string(u"ä\U0001f600"))}
+    };
+    EXPECT_EQ(expected, recorder.rows);
+}
+
+
+TEST(BulkCopyTest, CommitsEveryBatchSizeRows)
+{
+    testing::NiceMock<level2_mock_api> api;
+    bulk_copy_recorder recorder(api);
+    auto reader = make_reader(make_int64_schema(), {make_int64_batch(0, 2), make_int64_batch(2, 5)});
+    EXPECT_EQ(7, copy(api, *reader, 3, false));
+
+    std::vector<std::string> const expected = {"row", "row", "row", "batch",
+                                               "row", "row", "row", "batch",
+                                               "row", "done"};
+    EXPECT_EQ(expected, recorder.events);
+    ASSERT_EQ(7, recorder.rows.size());
+    EXPECT_EQ(value_of(int64_t(6)), recorder.rows.back().front());
+}
+
+
+TEST(BulkCopyTest, CommitsAtTheEndWithoutBatchSize)
+{
+    testing::NiceMock<level2_mock_api> api;
+    bulk_copy_recorder recorder(api);
+    EXPECT_CALL(api, do_commit_bulk_copy_batch(testing::_)).Times(0);
+    auto reader = make_reader(make_int64_schema(), {make_int64_batch(0, 4)});
+    EXPECT_EQ(4, copy(api, *reader, 0, false));
+    EXPECT_EQ("done", recorder.events.back());
+}
+
+
+TEST(BulkCopyTest, TableLock)
+{
+    for (bool const table_lock : {true, false}) {
+        testing::NiceMock<level2_mock_api> api;
+        bulk_copy_recorder recorder(api);
+        EXPECT_CALL(api, do_set_bulk_copy_hints(handle, std::u16string(u"TABLOCK"))).Times(table_lock ? 1 : 0);
+        auto reader = make_reader(make_int64_schema(), {make_int64_batch(0, 1)});
+        EXPECT_EQ(1, copy(api, *reader, 0, table_lock));
+    }
+}
+
+
+TEST(BulkCopyTest, FailureAbortsUncommittedRows)
+{
+    testing::NiceMock<level2_mock_api> api;
+    bulk_copy_recorder recorder(api);
+    // newer expectations take precedence, so the sixth row fails
+    EXPECT_CALL(api, do_send_bulk_copy_row(handle))
+        .WillOnce(testing::Throw(cpp_odbc::error("bcp_sendrow failed")));
+    EXPECT_CALL(api, do_send_bulk_copy_row(handle))
+        .Times(5)
+        .WillRepeatedly(testing::DoDefault())
+        .RetiresOnSaturation();
+
+    auto reader = make_reader(make_int64_schema(), {make_int64_batch(0, 10)});
+    EXPECT_THROW(copy(api, *reader, 3, false), cpp_odbc::error);
+
+    // the abort must precede bcp_done(), which would commit rows four and five otherwise
+    std::vector<std::string> const expected = {"row", "row", "row", "batch",
+                                               "row", "row", "abort", "done"};
+    EXPECT_EQ(expected, recorder.events);
+}
@@ -0,0 +1,11 @@
+#include "mock_classes.h"
+
+namespace turbodbc_arrow_test {
+
+default_mock_connection::default_mock_connection() = default;
+default_mock_connection::~default_mock_connection() = default;
+
+default_mock_statement::default_mock_statement() = default;
+default_mock_statement::~default_mock_statement() = default;
+
+}
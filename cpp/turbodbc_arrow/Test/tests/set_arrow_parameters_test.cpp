@@ -0,0 +1,413 @@
+#include <turbodbc_arrow/set_arrow_parameters.h>
+
+#include <tests/mock_classes.h>
+
+#include <turbodbc/command.h>
+#include <turbodbc/errors.h>
+
+#undef BOOL
+#undef timezone
+#include <arrow/api.h>
+#include <arrow/testing/gtest_util.h>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <sqlext.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using turbodbc_arrow_test::mock_connection;
+using turbodbc_arrow_test::mock_statement;
+
+namespace {
+
+    using recorded_rows = std::vector<std::vector<std::string>>;
+
+    std::string const null_value = "<null>";
+
+    /**
+     * Simulates a driver on top of a mock statement: it tracks the bound
+     * parameter buffers and attributes and records the values of all sets
+     * whenever the statement is executed.
+     */
+    struct parameter_recorder {
+        explicit parameter_recorder(mock_statement & statement, short int number_of_parameters)
+        {
+            ON_CALL(statement, do_number_of_parameters()).WillByDefault(testing::Return(number_of_parameters));
+            ON_CALL(statement, do_bind_input_parameter(testing::_, testing::_, testing::_, testing::_, testing::_))
+                .WillByDefault(testing::Invoke([this](SQLUSMALLINT index, SQLSMALLINT c_type, SQLSMALLINT, SQLSMALLINT,
+                                                      cpp_odbc::multi_value_buffer & buffer) {
+                    bindings[index] = {c_type, &buffer};
+                }));
+            ON_CALL(statement, do_bind_table_input_parameter(testing::_, testing::_, testing::_, testing::_))
+                .WillByDefault(testing::Invoke([this](SQLUSMALLINT, std::u16string const &, SQLULEN, SQLLEN * rows) {
+                    table_rows = rows;
+                }));
+            ON_CALL(statement, do_unbind_all_parameters())
+                .WillByDefault(testing::Invoke([this]() {
+                    bindings.clear();
+                    table_rows = nullptr;
+                }));
+            ON_CALL(statement, do_set_attribute(testing::_, testing::An<intptr_t>()))
+                .WillByDefault(testing::Invoke([this](SQLINTEGER attribute, intptr_t value) {
+                    if (attribute == SQL_ATTR_PARAMSET_SIZE) {
+                        paramset_size = static_cast<std::size_t>(value);
+                    }
+                }));
+            ON_CALL(statement, do_set_attribute(testing::_, testing::An<SQLULEN *>()))
+                .WillByDefault(testing::Invoke([this](SQLINTEGER attribute, SQLULEN * pointer) {
+                    if (attribute == SQL_ATTR_PARAMS_PROCESSED_PTR) {
+                        processed = pointer;
+                    }
+                }));
+            ON_CALL(statement, do_set_attribute(testing::_, testing::An<SQLUSMALLINT *>()))
+                .WillByDefault(testing::Invoke([this](SQLINTEGER attribute, SQLUSMALLINT * pointer) {
+                    if (attribute == SQL_ATTR_PARAM_STATUS_PTR) {
+                        status = pointer;
+                    }
+                }));
+            ON_CALL(statement, do_execute_prepared())
+                .WillByDefault(testing::Invoke([this]() { record(); }));
+        }
+
+        void record()
+        {
+            // all sets of a table-valued parameter are rows of a single set
+            auto const sets = (table_rows != nullptr) ? static_cast<std::size_t>(*table_rows) : paramset_size;
+            for (std::size_t set = 0; set != sets; ++set) {
+                std::vector<std::string> row;
+                for (auto const & binding : bindings) {
+                    row.push_back(value_of(binding.second, set));
+                }
+                rows.push_back(row);
+                if ((status != nullptr) and (table_rows == nullptr)) {
+                    status[set] = SQL_PARAM_SUCCESS;
+                }
+            }
+            if (processed != nullptr) {
+                *processed = paramset_size;
+            }
+            ++executions;
+        }
+
+        struct binding {
+            SQLSMALLINT c_type;
+            cpp_odbc::multi_value_buffer * buffer;
+        };
+
+        static std::string value_of(binding const & bound, std::size_t set)
+        {
+            auto const element = (*bound.buffer)[set];
+            if (element.indicator == SQL_NULL_DATA) {
+                return null_value;
+            }
+            if (bound.c_type == SQL_C_SBIGINT) {
+                return std::to_string(*reinterpret_cast<int64_t const *>(element.data_pointer));
+            }
+            return std::string(element.data_pointer, element.indicator);
+        }
+
+        std::map<SQLUSMALLINT, binding> bindings;
+        std::size_t paramset_size = 0;
+        SQLLEN * table_rows = nullptr;
+        SQLULEN * processed = nullptr;
+        SQLUSMALLINT * status = nullptr;
+        std::size_t executions = 0;
+        recorded_rows rows;
+    };
+
+    turbodbc::configuration make_configuration(std::size_t parameter_sets_to_buffer)
+    {
+        turbodbc::options options;
+        options.parameter_sets_to_buffer = parameter_sets_to_buffer;
+        return {options, turbodbc::capabilities(false)};
+    }
+
+    std::shared_ptr<arrow::Schema> make_schema()
+    {
+        return arrow::schema({arrow::field("id", arrow::int64()), arrow::field("name", arrow::utf8())});
+    }
+
+    std::string name_of(int64_t id)
+    {
+        return "name " + std::to_string(id);
+    }
+
+    bool is_null_name(int64_t id)
+    {
+        return id % 3 == 1;
+    }
+
+    // Rows [first, first + rows) with ids and names, both with some nulls
+    std::shared_ptr<arrow::RecordBatch> make_batch(int64_t first, int64_t rows)
+    {
+        arrow::Int64Builder ids;
+        arrow::StringBuilder names;
+        for (int64_t id = first; id != first + rows; ++id) {
+            if (id % 5 == 4) {
+                EXPECT_OK(ids.AppendNull());
+            } else {
+                EXPECT_OK(ids.Append(id));
+            }
+            if (is_null_name(id)) {
+                EXPECT_OK(names.AppendNull());
+            } else {
+                EXPECT_OK(names.Append(name_of(id)));
+            }
+        }
+        std::shared_ptr<arrow::Array> id_array;
+        std::shared_ptr<arrow::Array> name_array;
+        EXPECT_OK(ids.Finish(&id_array));
+        EXPECT_OK(names.Finish(&name_array));
+        return arrow::RecordBatch::Make(make_schema(), rows, {id_array, name_array});
+    }
+
+    recorded_rows expected_rows(int64_t rows)
+    {
+        recorded_rows expected;
+        for (int64_t id = 0; id != rows; ++id) {
+            expected.push_back({(id % 5 == 4) ? null_value : std::to_string(id),
+                                is_null_name(id) ? null_value : name_of(id)});
+        }
+        return expected;
+    }
+
+    std::shared_ptr<arrow::RecordBatchReader> make_reader(std::vector<std::shared_ptr<arrow::RecordBatch>> batches)
+    {
+        auto reader = arrow::RecordBatchReader::Make(std::move(batches), make_schema());
+        EXPECT_OK(reader.status());
+        return *reader;
+    }
+
+    // A reader with a single batch whose only column is a dictionary of strings.
+    // The indices are not validated, so malformed arrays can be constructed.
+    std::shared_ptr<arrow::RecordBatchReader> make_dictionary_reader(std::vector<int32_t> const & indices,
+                                                                     std::vector<bool> const & index_valid)
+    {
+        arrow::StringBuilder values;
+        EXPECT_OK(values.Append("first"));
+        EXPECT_OK(values.AppendNull());
+        EXPECT_OK(values.Append("third"));
+        std::shared_ptr<arrow::Array> dictionary;
+        EXPECT_OK(values.Finish(&dictionary));
+
+        arrow::Int32Builder index_builder;
+        EXPECT_OK(index_builder.AppendValues(indices, index_valid));
+        std::shared_ptr<arrow::Array> index_array;
+        EXPECT_OK(index_builder.Finish(&index_array));
+
+        auto const type = arrow::dictionary(arrow::int32(), arrow::utf8());
+        auto const column = std::make_shared<arrow::DictionaryArray>(type, index_array, dictionary);
+        auto const schema = arrow::schema({arrow::field("name", type)});
+        auto reader = arrow::RecordBatchReader::Make({arrow::RecordBatch::Make(schema, column->length(), {column})}, schema);
+        EXPECT_OK(reader.status());
+        return *reader;
+    }
+
+}
+
+
+TEST(SetArrowParametersTest, ParameterBuffersSpanRecordBatches)
+{
+    auto statement = std::make_shared<mock_statement>();
+    parameter_recorder recorder(*statement, 2);
+    mock_connection connection;
+    turbodbc::command command(statement, make_configuration(4));
+
+    // the parameter buffers of four sets start in the middle of the second and third batch
+    auto reader = make_reader({make_batch(0, 3), make_batch(3, 3), make_batch(6, 5)});
+    EXPECT_EQ(11, turbodbc_arrow::insert_record_batches(command, connection, *reader, 0));
+
+    EXPECT_EQ(3, recorder.executions);
+    EXPECT_EQ(expected_rows(11), recorder.rows);
+}
+
+
+TEST(SetArrowParametersTest, RecordBatchesWithOffset)
+{
+    auto statement = std::make_shared<mock_statement>();
+    parameter_recorder recorder(*statement, 2);
+    mock_connection connection;
+    turbodbc::command command(statement, make_configuration(3));
+
+    // slices share the buffers of the original batch and start at an offset
+    auto reader = make_reader({make_batch(0, 2), make_batch(1, 5)->Slice(1, 3), make_batch(0, 9)->Slice(5)});
+    EXPECT_EQ(9, turbodbc_arrow::insert_record_batches(command, connection, *reader, 0));
+
+    EXPECT_EQ(expected_rows(9), recorder.rows);
+}
+
+
+TEST(SetArrowParametersTest, SkipsEmptyRecordBatches)
+{
+    auto statement = std::make_shared<mock_statement>();
+    parameter_recorder recorder(*statement, 2);
+    mock_connection connection;
+    turbodbc::command command(statement, make_configuration(2));
+
+    auto reader = make_reader({make_batch(0, 0), make_batch(0, 3), make_batch(3, 0), make_batch(3, 1)});
+    EXPECT_EQ(4, turbodbc_arrow::insert_record_batches(command, connection, *reader, 0));
+
+    EXPECT_EQ(expected_rows(4), recorder.rows);
+}
+
+
+TEST(SetArrowParametersTest, CommitsEveryNBatches)
+{
+    auto statement = std::make_shared<mock_statement>();
+    parameter_recorder recorder(*statement, 2);
+    mock_connection connection;
+    turbodbc::command command(statement, make_configuration(2));
+    EXPECT_CALL(connection, do_commit()).Times(2);
+
+    auto reader = make_reader({make_batch(0, 9)});
+    EXPECT_EQ(9, turbodbc_arrow::insert_record_batches(command, connection, *reader, 2));
+    EXPECT_EQ(5, recorder.executions);
+}
+
+
+TEST(SetArrowParametersTest, DictionaryStrings)
+{
+    auto statement = std::make_shared<mock_statement>();
+    parameter_recorder recorder(*statement, 1);
+    mock_connection connection;
+    turbodbc::command command(statement, make_configuration(8));
+
+    // indices behind null slots may be out of range
+    auto reader = make_dictionary_reader({2, 0, 1, 17, 2}, {true, true, true, false, true});
+    EXPECT_EQ(5, turbodbc_arrow::insert_record_batches(command, connection, *reader, 0));
+
+    recorded_rows const expected = {{"third"}, {"first"}, {null_value}, {null_value}, {"third"}};
+    EXPECT_EQ(expected, recorder.rows);
+}
+
+
+TEST(SetArrowParametersTest, DictionaryIndexOutOfRange)
+{
+    for (int32_t const index : {3, -1}) {
+        auto statement = std::make_shared<mock_statement>();
+        parameter_recorder recorder(*statement, 1);
+        mock_connection connection;
+        turbodbc::command command(statement, make_configuration(8));
+
+        auto reader = make_dictionary_reader({0, index}, {true, true});
+        EXPECT_THROW(turbodbc_arrow::insert_record_batches(command, connection, *reader, 0), turbodbc::interface_error);
+        EXPECT_EQ(0, recorder.executions);
+    }
+}
+
+
+TEST(SetArrowParametersTest, ExecuteAfterArrowStreamInsert)
+{
+    auto statement = std::make_shared<mock_statement>();
+    parameter_recorder recorder(*statement, 2);
+    mock_connection connection;
+    turbodbc::command command(statement, make_configuration(4));
+
+    auto reader = make_reader({make_batch(0, 6)});
+    EXPECT_EQ(6, turbodbc_arrow::insert_record_batches(command, connection, *reader, 0));
+
+    // a regular execution binds the command's own buffers and attributes again
+    auto & parameters = command.get_parameters();
+    std::string const values = "ab";
+    for (std::size_t i = 0; i != values.size(); ++i) {
+        auto element = parameters.get_parameters()[i]->get_buffer()[0];
+        element.data_pointer[0] = values[i];
+        element.indicator = 1;
+    }
+    parameters.execute_batch(1);
+    command.execute();
+
+    ASSERT_EQ(7, recorder.rows.size());
+    EXPECT_EQ(std::vector<std::string>({"a", "b"}), recorder.rows.back());
+    for (std::size_t i = 0; i != values.size(); ++i) {
+        EXPECT_EQ(&parameters.get_parameters()[i]->get_buffer(), recorder.bindings[i + 1].buffer);
+    }
+    EXPECT_EQ(1, command.get_row_count());
+}
+
+
+TEST(SetArrowParametersTest, ConcurrentInsertsWithSeparateStatements)
+{
+    // each thread inserts with its own statement, as with one connection per thread
+    std::size_t const n_threads = 6;
+    struct insert {
+        std::shared_ptr<mock_statement> statement = std::make_shared<mock_statement>();
+        std::unique_ptr<parameter_recorder> recorder;
+        mock_connection connection;
+        std::unique_ptr<turbodbc::command> command;
+        std::shared_ptr<arrow::RecordBatchReader> reader;
+        int64_t rows = 0;
+        std::size_t transferred = 0;
+    };
+    std::vector<std::unique_ptr<insert>> inserts;
+    for (std::size_t i = 0; i != n_threads; ++i) {
+        inserts.emplace_back(new insert());
+        auto & current = *inserts.back();
+        current.recorder.reset(new parameter_recorder(*current.statement, 2));
+        current.command.reset(new turbodbc::command(current.statement, make_configuration(3 + i)));
+        current.rows = 200 + 17 * i;
+        current.reader = make_reader({make_batch(0, 100), make_batch(100, current.rows - 100)});
+    }
+
+    std::vector<std::thread> threads;
+    for (auto & current : inserts) {
+        threads.emplace_back([&current]() {
+            current->transferred = turbodbc_arrow::insert_record_batches(*current->command, current->connection,
+                                                                         *current->reader, 0);
+        });
+    }
+    for (auto & thread : threads) {
+        thread.join();
+    }
+
+    for (auto const & current : inserts) {
+        EXPECT_EQ(current->rows, current->transferred);
+        EXPECT_EQ(expected_rows(current->rows), current->recorder->rows);
+    }
+}
+
+
+TEST(SetArrowParametersTest, TableParameterBatches)
+{
+    auto statement = std::make_shared<mock_statement>();
+    parameter_recorder recorder(*statement, 1);
+    turbodbc::command command(statement, make_configuration(4));
+
+    auto reader = make_reader({make_batch(0, 6), make_batch(0, 9)->Slice(6)});
+    auto table_parameter = command.make_table_parameter(u"dbo.rows", 2);
+    EXPECT_EQ(9, turbodbc_arrow::insert_table_parameter_batches(*table_parameter, *reader));
+    EXPECT_EQ(3, recorder.executions);
+    EXPECT_EQ(expected_rows(9), recorder.rows);
+}
+
+
+TEST(SetArrowParametersTest, ExecuteAfterTableParameterInsert)
+{
+    auto statement = std::make_shared<mock_statement>();
+    parameter_recorder recorder(*statement, 1);
+    turbodbc::command command(statement, make_configuration(4));
+
+    auto reader = make_reader({make_batch(0, 6)});
+    auto table_parameter = command.make_table_parameter(u"dbo.rows", 2);
+    EXPECT_EQ(6, turbodbc_arrow::insert_table_parameter_batches(*table_parameter, *reader));
+    table_parameter.reset();
+
+    // a regular execution drops the table and its columns and binds the command's own buffers
+    auto & parameters = command.get_parameters();
+    auto element = parameters.get_parameters()[0]->get_buffer()[0];
+    element.data_pointer[0] = 'a';
+    element.indicator = 1;
+    parameters.execute_batch(1);
+
+    ASSERT_EQ(7, recorder.rows.size());
+    EXPECT_EQ(std::vector<std::string>({"a"}), recorder.rows.back());
+    EXPECT_EQ(nullptr, recorder.table_rows);
+    ASSERT_EQ(1, recorder.bindings.size());
+    EXPECT_EQ(&parameters.get_parameters()[0]->get_buffer(), recorder.bindings[1].buffer);
+    EXPECT_NE(nullptr, recorder.status);
+    EXPECT_EQ(1, command.get_row_count());
+}
@@ -0,0 +1,339 @@
+#include <turbodbc_arrow/sharded_insert.h>
+
+#include <tests/mock_classes.h>
+
+#include <turbodbc/errors.h>
+#include <cpp_odbc/error.h>
+
+#undef BOOL
+#undef timezone
+#include <arrow/api.h>
+#include <arrow/testing/gtest_util.h>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <sqlext.h>
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <set>
+
+using turbodbc_arrow::insert_sharded;
+using turbodbc_arrow::partition_by_hash;
+using turbodbc_arrow::partition_by_row_ranges;
+using turbodbc_arrow_test::mock_connection;
+using turbodbc_arrow_test::mock_statement;
+
+namespace {
+
+    std::shared_ptr<arrow::RecordBatch> make_batch(int64_t rows)
+    {
+        arrow::Int64Builder ids;
+        arrow::StringBuilder names;
+        for (int64_t i = 0; i != rows; ++i) {
+            EXPECT_OK(ids.Append(i));
+            if (i % 7 == 0) {
+                EXPECT_OK(names.AppendNull());
+            } else {
+                EXPECT_OK(names.Append("name " + std::to_string(i % 5)));
+            }
+        }
+        std::shared_ptr<arrow::Array> id_array;
+        std::shared_ptr<arrow::Array> name_array;
+        EXPECT_OK(ids.Finish(&id_array));
+        EXPECT_OK(names.Finish(&name_array));
+        auto schema = arrow::schema({arrow::field("id", arrow::int64()), arrow::field("name", arrow::utf8())});
+        return arrow::RecordBatch::Make(schema, rows, {id_array, name_array});
+    }
+
+    int64_t id_at(arrow::RecordBatch const & batch, int64_t row)
+    {
+        return static_cast<arrow::Int64Array const &>(*batch.column(0)).Value(row);
+    }
+
+}
+
+
+TEST(ShardedInsertTest, RowRangesSplitEvenly)
+{
+    auto const batch = make_batch(10);
+    auto const ranges = partition_by_row_ranges(batch, 3, 1);
+
+    ASSERT_EQ(ranges.size(), 3);
+    EXPECT_EQ(ranges[0]->num_rows(), 4);
+    EXPECT_EQ(ranges[1]->num_rows(), 4);
+    EXPECT_EQ(ranges[2]->num_rows(), 2);
+    EXPECT_EQ(id_at(*ranges[1], 0), 4);
+    EXPECT_EQ(id_at(*ranges[2], 1), 9);
+}
+
+
+TEST(ShardedInsertTest, RowRangesRespectMinimumRows)
+{
+    auto const batch = make_batch(10);
+    EXPECT_EQ(partition_by_row_ranges(batch, 8, 4).size(), 2);
+    EXPECT_EQ(partition_by_row_ranges(batch, 8, 100).size(), 1);
+    EXPECT_TRUE(partition_by_row_ranges(make_batch(0), 8, 1).empty());
+}
+
+
+TEST(ShardedInsertTest, HashPartitionsKeepAllRowsInOrder)
+{
+    auto const batch = make_batch(100);
+    auto const shards = partition_by_hash(batch, {0}, 4);
+
+    ASSERT_EQ(shards.size(), 4);
+    std::set<int64_t> ids;
+    for (auto const & shard : shards) {
+        EXPECT_EQ(shard->schema()->num_fields(), 2);
+        for (int64_t row = 0; row != shard->num_rows(); ++row) {
+            if (row != 0) {
+                EXPECT_LT(id_at(*shard, row - 1), id_at(*shard, row));
+            }
+            ids.insert(id_at(*shard, row));
+        }
+        // 100 distinct keys are unlikely to hash into a single shard
+        EXPECT_GT(shard->num_rows(), 0);
+    }
+    EXPECT_EQ(ids.size(), 100);
+}
+
+
+TEST(ShardedInsertTest, HashPartitionsGroupEqualKeys)
+{
+    auto const first = partition_by_hash(make_batch(50), {1}, 3);
+    auto const second = partition_by_hash(make_batch(70)->Slice(20), {1}, 3);
+
+    std::map<std::string, std::size_t> shard_of_name;
+    for (auto const & shards : {first, second}) {
+        for (std::size_t shard = 0; shard != shards.size(); ++shard) {
+            auto const & names = static_cast<arrow::StringArray const &>(*shards[shard]->column(1));
+            for (int64_t row = 0; row != names.length(); ++row) {
+                auto const name = names.IsNull(row) ? std::string("<null>") : names.GetString(row);
+                auto const known = shard_of_name.emplace(name, shard);
+                EXPECT_EQ(known.first->second, shard) << name;
+            }
+        }
+    }
+    EXPECT_EQ(shard_of_name.size(), 6);
+}
+
+
+TEST(ShardedInsertTest, HashPartitionsTreatDictionariesLikeValues)
+{
+    auto const batch = make_batch(40);
+    arrow::StringDictionaryBuilder builder;
+    ASSERT_OK(builder.AppendArray(*batch->column(1)));
+    std::shared_ptr<arrow::Array> dictionary_names;
+    ASSERT_OK(builder.Finish(&dictionary_names));
+    auto const dictionary_batch = arrow::RecordBatch::Make(
+        arrow::schema({arrow::field("id", arrow::int64()), arrow::field("name", dictionary_names->type())}),
+        40, {batch->column(0), dictionary_names});
+
+    auto const plain = partition_by_hash(batch, {1}, 4);
+    auto const dictionary = partition_by_hash(dictionary_batch, {1}, 4);
+    for (std::size_t shard = 0; shard != 4; ++shard) {
+        ASSERT_EQ(plain[shard]->num_rows(), dictionary[shard]->num_rows());
+        for (int64_t row = 0; row != plain[shard]->num_rows(); ++row) {
+            EXPECT_EQ(id_at(*plain[shard], row), id_at(*dictionary[shard], row));
+        }
+    }
+}
+
+
+TEST(ShardedInsertTest, HashPartitionRejectsUnsupportedKeyTypes)
+{
+    auto const values = make_batch(3)->column(0);
+    arrow::Int32Builder offsets;
+    ASSERT_OK(offsets.AppendValues({0, 1, 2, 3}));
+    std::shared_ptr<arrow::Array> offset_array;
+    ASSERT_OK(offsets.Finish(&offset_array));
+    auto const list = arrow::ListArray::FromArrays(*offset_array, *values);
+    ASSERT_OK(list.status());
+    auto const batch = arrow::RecordBatch::Make(arrow::schema({arrow::field("list", (*list)->type())}), 3, {*list});
+
+    EXPECT_THROW(partition_by_hash(batch, {0}, 2), turbodbc::interface_error);
+}
+
+
+namespace {
+
+    /**
+     * The connection and statement of one worker. The statement accepts all
+     * parameter sets and counts them, or fails every execution.
+     */
+    struct fake_shard {
+        explicit fake_shard(bool fail_executions) :
+            connection(std::make_shared<mock_connection>()),
+            statement(std::make_shared<mock_statement>()),
+            inserted_rows(0)
+        {
+            ON_CALL(*connection, do_make_statement()).WillByDefault(testing::Return(statement));
+            ON_CALL(*statement, do_number_of_parameters()).WillByDefault(testing::Return(2));
+            ON_CALL(*statement, do_set_attribute(testing::_, testing::An<intptr_t>()))
+                .WillByDefault(testing::Invoke([this](SQLINTEGER attribute, intptr_t value) {
+                    if (attribute == SQL_ATTR_PARAMSET_SIZE) {
+                        paramset_size = static_cast<std::size_t>(value);
+                    }
+                }));
+            ON_CALL(*statement, do_set_attribute(testing::_, testing::An<SQLULEN *>()))
+                .WillByDefault(testing::Invoke([this](SQLINTEGER attribute, SQLULEN * pointer) {
+                    if (attribute == SQL_ATTR_PARAMS_PROCESSED_PTR) {
+                        processed = pointer;
+                    }
+                }));
+            if (fail_executions) {
+                ON_CALL(*statement, do_execute_prepared()).WillByDefault(testing::Throw(cpp_odbc::error("constraint violated")));
+            } else {
+                ON_CALL(*statement, do_execute_prepared()).WillByDefault(testing::Invoke([this]() {
+                    *processed = paramset_size;
+                    inserted_rows += paramset_size;
+                }));
+            }
+        }
+
+        std::shared_ptr<mock_connection> connection;
+        std::shared_ptr<mock_statement> statement;
+        std::size_t paramset_size = 0;
+        SQLULEN * processed = nullptr;
+        std::size_t inserted_rows;
+    };
+
+    // Hands out the shards in the order in which workers connect
+    struct fake_connector {
+        turbodbc::connection operator()()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            turbodbc::options options;
+            options.parameter_sets_to_buffer = 8;
+            return turbodbc::connection(shards.at(connected++)->connection, options);
+        }
+
+        std::vector<std::unique_ptr<fake_shard>> shards;
+        std::size_t connected = 0;
+        std::mutex mutex;
+    };
+
+    // Yields the given batches and fails afterwards
+    class failing_reader : public arrow::RecordBatchReader {
+    public:
+        explicit failing_reader(std::vector<std::shared_ptr<arrow::RecordBatch>> batches) :
+            batches_(std::move(batches))
+        {
+        }
+
+        std::shared_ptr<arrow::Schema> schema() const override
+        {
+            return batches_.front()->schema();
+        }
+
+        arrow::Status ReadNext(std::shared_ptr<arrow::RecordBatch> * batch) override
+        {
+            if (next_ == batches_.size()) {
+                return arrow::Status::IOError("connection to the source lost");
+            }
+            *batch = batches_[next_++];
+            return arrow::Status::OK();
+        }
+
+    private:
+        std::vector<std::shared_ptr<arrow::RecordBatch>> batches_;
+        std::size_t next_ = 0;
+    };
+
+    std::shared_ptr<arrow::RecordBatchReader> make_reader(std::vector<std::shared_ptr<arrow::RecordBatch>> batches)
+    {
+        auto reader = arrow::RecordBatchReader::Make(std::move(batches));
+        EXPECT_OK(reader.status());
+        return *reader;
+    }
+
+}
+
+
+TEST(ShardedInsertTest, WorkersCommitTheirRows)
+{
+    std::size_t const workers = 3;
+    fake_connector connect;
+    for (std::size_t i = 0; i != workers; ++i) {
+        connect.shards.emplace_back(new fake_shard(false));
+        EXPECT_CALL(*connect.shards.back()->connection, do_commit()).Times(1);
+        EXPECT_CALL(*connect.shards.back()->connection, do_rollback()).Times(0);
+    }
+
+    auto reader = make_reader({make_batch(3000), make_batch(5000)->Slice(100), make_batch(10)});
+    auto const results = insert_sharded(std::ref(connect), "INSERT", *reader, workers, {}, 0);
+
+    ASSERT_EQ(results.size(), workers);
+    std::size_t transferred = 0;
+    std::size_t inserted = 0;
+    for (std::size_t i = 0; i != workers; ++i) {
+        EXPECT_EQ(results[i].error, "");
+        transferred += results[i].transferred_sets;
+        inserted += connect.shards[i]->inserted_rows;
+    }
+    EXPECT_EQ(transferred, 7910);
+    EXPECT_EQ(inserted, 7910);
+}
+
+
+TEST(ShardedInsertTest, FailingWorkerRollsBackAndReportsItsError)
+{
+    std::size_t const workers = 2;
+    fake_connector connect;
+    connect.shards.emplace_back(new fake_shard(true));
+    connect.shards.emplace_back(new fake_shard(false));
+    EXPECT_CALL(*connect.shards[0]->connection, do_commit()).Times(0);
+    EXPECT_CALL(*connect.shards[0]->connection, do_rollback()).Times(1);
+    EXPECT_CALL(*connect.shards[1]->connection, do_commit()).Times(1);
+    EXPECT_CALL(*connect.shards[1]->connection, do_rollback()).Times(0);
+
+    // with key columns, each worker is responsible for a fixed subset of the rows
+    auto const batch = make_batch(200);
+    auto const shards = partition_by_hash(batch, {0}, workers);
+    auto reader = make_reader({batch});
+    auto const results = insert_sharded(std::ref(connect), "INSERT", *reader, workers, {0}, 0);
+
+    ASSERT_EQ(results.size(), workers);
+    std::size_t failed = 0;
+    for (std::size_t worker = 0; worker != workers; ++worker) {
+        if (results[worker].error.empty()) {
+            EXPECT_EQ(results[worker].transferred_sets, shards[worker]->num_rows());
+            EXPECT_EQ(connect.shards[1]->inserted_rows, shards[worker]->num_rows());
+        } else {
+            ++failed;
+            EXPECT_THAT(results[worker].error, testing::HasSubstr("constraint violated"));
+            EXPECT_EQ(results[worker].transferred_sets, 0);
+        }
+    }
+    EXPECT_EQ(failed, 1);
+}
+
+
+TEST(ShardedInsertTest, SourceFailureRollsBackAllWorkers)
+{
+    std::size_t const workers = 3;
+    fake_connector connect;
+    for (std::size_t i = 0; i != workers; ++i) {
+        connect.shards.emplace_back(new fake_shard(false));
+        EXPECT_CALL(*connect.shards.back()->connection, do_commit()).Times(0);
+        EXPECT_CALL(*connect.shards.back()->connection, do_rollback()).Times(1);
+    }
+
+    failing_reader reader({make_batch(3000), make_batch(3000)});
+    try {
+        insert_sharded(std::ref(connect), "INSERT", reader, workers, {}, 0);
+        FAIL() << "insert_sharded did not fail";
+    } catch (turbodbc::interface_error const & error) {
+        EXPECT_THAT(error.what(), testing::HasSubstr("connection to the source lost"));
+    }
+}
+
+
+TEST(ShardedInsertTest, RejectsUnknownKeyColumns)
+{
+    fake_connector connect;
+    auto reader = make_reader({make_batch(10)});
+    EXPECT_THROW(insert_sharded(std::ref(connect), "INSERT", *reader, 2, {2}, 0), turbodbc::interface_error);
+    EXPECT_EQ(connect.connected, 0);
+}
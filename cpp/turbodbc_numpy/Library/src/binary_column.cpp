@@ -1,6 +1,7 @@
 #include <turbodbc_numpy/binary_column.h>
 #include <turbodbc_numpy/ndarrayobject.h>
 #include <turbodbc_numpy/make_numpy_array.h>
+#include <turbodbc/indicator_helpers.h>
 
 #include <Python.h>
 
@@ -47,15 +48,8 @@ void binary_column::do_append(cpp_odbc::multi_value_buffer const & buffer, std::
 	            buffer.data_pointer(),
 	            n_values * type_.size);
 
-	auto const mask_pointer = static_cast<std::int8_t *>(PyArray_DATA(get_array_ptr(mask_))) + old_size;
-	std::memset(mask_pointer, 0, n_values);
-
-	auto const indicator_pointer = buffer.indicator_pointer();
-	for (std::size_t element = 0; element != n_values; ++element) {
-		if (indicator_pointer[element] == SQL_NULL_DATA) {
-			mask_pointer[element] = 1;
-		}
-	}
+	auto const mask_pointer = static_cast<std::uint8_t *>(PyArray_DATA(get_array_ptr(mask_))) + old_size;
+	turbodbc::indicators_to_null_mask(buffer.indicator_pointer(), n_values, mask_pointer);
 }
 
 pybind11::object binary_column::do_get_data()
@@ -0,0 +1,59 @@
+#include <turbodbc_numpy/bytes_column.h>
+
+#include <turbodbc/binary_helpers.h>
+#include <turbodbc/string_helpers.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+#include <sql.h>
+
+namespace turbodbc_numpy {
+
+using pybind11::object;
+using pybind11::reinterpret_steal;
+
+namespace {
+
+    std::size_t const guid_size = 16;
+
+}
+
+bytes_column::bytes_column(turbodbc::type_code type, std::size_t total_buffer_size) :
+    type_(type),
+    maximum_size_(total_buffer_size)
+{
+}
+
+
+bytes_column::~bytes_column() = default;
+
+void bytes_column::do_append(cpp_odbc::multi_value_buffer const & buffer, std::size_t n_values)
+{
+    for (std::size_t i = 0; i != n_values; ++i) {
+        auto const element = buffer[i];
+        if (element.indicator == SQL_NULL_DATA) {
+            data_.append(pybind11::none());
+        } else if (type_ == turbodbc::type_code::guid) {
+            uint8_t bytes[guid_size];
+            turbodbc::guid_to_bytes(element.data_pointer, bytes);
+            data_.append(reinterpret_steal<object>(PyBytes_FromStringAndSize(reinterpret_cast<char const *>(bytes), guid_size)));
+        } else {
+            auto const size = turbodbc::buffered_string_size(element.indicator, maximum_size_);
+            data_.append(reinterpret_steal<object>(PyBytes_FromStringAndSize(element.data_pointer, size)));
+        }
+    }
+}
+
+object bytes_column::do_get_data()
+{
+    return data_;
+}
+
+object bytes_column::do_get_mask()
+{
+    return pybind11::cast(false);
+}
+
+
+}
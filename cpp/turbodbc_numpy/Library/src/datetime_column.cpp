@@ -1,13 +1,11 @@
 #include <turbodbc_numpy/datetime_column.h>
 #include <turbodbc_numpy/ndarrayobject.h>
 #include <turbodbc_numpy/make_numpy_array.h>
+#include <turbodbc/indicator_helpers.h>
 #include <turbodbc/time_helpers.h>
 
 #include <Python.h>
 
-#include <boost/date_time/gregorian/gregorian_types.hpp>
-#include <boost/date_time/posix_time/posix_time_types.hpp>
-
 #ifdef _WIN32
 #include <windows.h>
 #endif
@@ -26,19 +24,18 @@ namespace {
 
 	std::string get_type_descriptor(turbodbc::type_code type)
 	{
-		if (type == turbodbc::type_code::timestamp) {
-			return "datetime64[us]";
-		} else {
-			return "datetime64[D]";
-		}
-	}
-
-	datetime_column::converter make_converter(turbodbc::type_code type)
-	{
-		if (type == turbodbc::type_code::timestamp) {
-			return turbodbc::timestamp_to_microseconds;
-		} else {
-			return turbodbc::date_to_days;
+		switch (type) {
+			case turbodbc::type_code::timestamp:
+			case turbodbc::type_code::timestamp_offset:
+				return "datetime64[us]";
+			case turbodbc::type_code::timestamp_nanoseconds:
+			case turbodbc::type_code::timestamp_offset_nanoseconds:
+				return "datetime64[ns]";
+			case turbodbc::type_code::time:
+				// NumPy lacks a time of day type, so use the time since midnight
+				return "timedelta64[ns]";
+			default:
+				return "datetime64[D]";
 		}
 	}
 
@@ -53,8 +50,7 @@ datetime_column::datetime_column(turbodbc::type_code type) :
 	type_(type),
 	data_(make_empty_numpy_array(get_type_descriptor(type_))),
 	mask_(make_empty_numpy_array(numpy_bool_type)),
-	size_(0),
-	converter_(make_converter(type_))
+	size_(0)
 {
 }
 
@@ -67,16 +63,27 @@ void datetime_column::do_append(cpp_odbc::multi_value_buffer const & buffer, std
 	resize(old_size + n_values);
 
 	auto const data_pointer = static_cast<int64_t *>(PyArray_DATA(get_array_ptr(data_))) + old_size;
-	auto const mask_pointer = static_cast<std::int8_t *>(PyArray_DATA(get_array_ptr(mask_))) + old_size;
-	std::memset(mask_pointer, 0, n_values);
-
-	for (std::size_t i = 0; i != n_values; ++i) {
-		auto element = buffer[i];
-		if (element.indicator == SQL_NULL_DATA) {
-			mask_pointer[i] = 1;
-		} else {
-			reinterpret_cast<intptr_t *>(data_pointer)[i] = converter_(element.data_pointer);
-		}
+	auto const mask_pointer = static_cast<std::uint8_t *>(PyArray_DATA(get_array_ptr(mask_))) + old_size;
+	turbodbc::indicators_to_null_mask(buffer.indicator_pointer(), n_values, mask_pointer);
+
+	switch (type_) {
+		case turbodbc::type_code::timestamp:
+			turbodbc::timestamps_to_microseconds(buffer.data_pointer(), buffer.indicator_pointer(), n_values, data_pointer);
+			break;
+		case turbodbc::type_code::timestamp_nanoseconds:
+			turbodbc::timestamps_to_nanoseconds(buffer.data_pointer(), buffer.indicator_pointer(), n_values, data_pointer);
+			break;
+		case turbodbc::type_code::timestamp_offset:
+			turbodbc::timestamp_offsets_to_microseconds(buffer.data_pointer(), buffer.indicator_pointer(), n_values, data_pointer);
+			break;
+		case turbodbc::type_code::timestamp_offset_nanoseconds:
+			turbodbc::timestamp_offsets_to_nanoseconds(buffer.data_pointer(), buffer.indicator_pointer(), n_values, data_pointer);
+			break;
+		case turbodbc::type_code::time:
+			turbodbc::times_to_nanoseconds(buffer.data_pointer(), buffer.indicator_pointer(), n_values, data_pointer);
+			break;
+		default:
+			turbodbc::dates_to_days(buffer.data_pointer(), buffer.indicator_pointer(), n_values, data_pointer);
 	}
 }
 
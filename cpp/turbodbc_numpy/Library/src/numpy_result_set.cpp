@@ -2,7 +2,10 @@
 
 #include <turbodbc_numpy/numpy_type.h>
 #include <turbodbc_numpy/binary_column.h>
+#include <turbodbc_numpy/bytes_column.h>
 #include <turbodbc_numpy/datetime_column.h>
+#include <turbodbc_numpy/decimal_column.h>
+#include <turbodbc_numpy/rowversion_column.h>
 #include <turbodbc_numpy/string_column.h>
 #include <turbodbc_numpy/unicode_column.h>
 
@@ -19,15 +22,34 @@ namespace {
         switch (info.type) {
             case turbodbc::type_code::floating_point:
                 return std::unique_ptr<binary_column>(new binary_column(numpy_double_type));
+            case turbodbc::type_code::floating_point_32:
+                return std::unique_ptr<binary_column>(new binary_column(numpy_float_type));
             case turbodbc::type_code::integer:
                 return std::unique_ptr<binary_column>(new binary_column(numpy_int_type));
+            case turbodbc::type_code::integer_8:
+                return std::unique_ptr<binary_column>(new binary_column(numpy_int8_type));
+            case turbodbc::type_code::integer_16:
+                return std::unique_ptr<binary_column>(new binary_column(numpy_int16_type));
+            case turbodbc::type_code::integer_32:
+                return std::unique_ptr<binary_column>(new binary_column(numpy_int32_type));
+            case turbodbc::type_code::rowversion:
+                return std::unique_ptr<rowversion_column>(new rowversion_column());
             case turbodbc::type_code::boolean:
                 return std::unique_ptr<binary_column>(new binary_column(numpy_bool_type));
             case turbodbc::type_code::timestamp:
+            case turbodbc::type_code::timestamp_nanoseconds:
+            case turbodbc::type_code::timestamp_offset:
+            case turbodbc::type_code::timestamp_offset_nanoseconds:
+            case turbodbc::type_code::time:
             case turbodbc::type_code::date:
                 return std::unique_ptr<datetime_column>(new datetime_column(info.type));
+            case turbodbc::type_code::decimal:
+                return std::unique_ptr<decimal_column>(new decimal_column(info.scale));
             case turbodbc::type_code::unicode:
                 return std::unique_ptr<unicode_column>(new unicode_column(info.element_size));
+            case turbodbc::type_code::binary:
+            case turbodbc::type_code::guid:
+                return std::unique_ptr<bytes_column>(new bytes_column(info.type, info.element_size));
             default:
                 return std::unique_ptr<string_column>(new string_column(info.element_size));
         }
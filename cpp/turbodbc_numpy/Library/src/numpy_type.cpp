@@ -5,7 +5,12 @@
 namespace turbodbc_numpy {
 
 numpy_type const numpy_int_type = {NPY_INT64, 8};
+numpy_type const numpy_int8_type = {NPY_INT8, 1};
+numpy_type const numpy_int16_type = {NPY_INT16, 2};
+numpy_type const numpy_int32_type = {NPY_INT32, 4};
+numpy_type const numpy_uint64_type = {NPY_UINT64, 8};
 numpy_type const numpy_double_type = {NPY_FLOAT64, 8};
+numpy_type const numpy_float_type = {NPY_FLOAT32, 4};
 numpy_type const numpy_bool_type = {NPY_BOOL, 1};
 numpy_type const numpy_datetime_type = {NPY_DATETIME, 8};
 
@@ -0,0 +1,69 @@
+#include <turbodbc_numpy/rowversion_column.h>
+#include <turbodbc_numpy/ndarrayobject.h>
+#include <turbodbc_numpy/make_numpy_array.h>
+#include <turbodbc_numpy/numpy_type.h>
+#include <turbodbc/binary_helpers.h>
+#include <turbodbc/indicator_helpers.h>
+
+#include <Python.h>
+
+#ifdef __GNUC__
+#define EXTENSION __extension__
+#else
+#define EXTENSION
+#endif
+
+namespace turbodbc_numpy {
+
+namespace {
+
+	PyArrayObject * get_array_ptr(pybind11::object & object)
+	{
+		return reinterpret_cast<PyArrayObject *>(object.ptr());
+	}
+
+}
+
+rowversion_column::rowversion_column() :
+	data_(make_empty_numpy_array(numpy_uint64_type)),
+	mask_(make_empty_numpy_array(numpy_bool_type)),
+	size_(0)
+{
+}
+
+
+rowversion_column::~rowversion_column() = default;
+
+void rowversion_column::do_append(cpp_odbc::multi_value_buffer const & buffer, std::size_t n_values)
+{
+	auto const old_size = size_;
+	resize(old_size + n_values);
+
+	auto const data_pointer = static_cast<uint64_t *>(PyArray_DATA(get_array_ptr(data_))) + old_size;
+	auto const mask_pointer = static_cast<std::uint8_t *>(PyArray_DATA(get_array_ptr(mask_))) + old_size;
+	turbodbc::indicators_to_null_mask(buffer.indicator_pointer(), n_values, mask_pointer);
+	turbodbc::rowversions_to_integers(buffer.data_pointer(), buffer.indicator_pointer(), n_values, data_pointer);
+}
+
+pybind11::object rowversion_column::do_get_data()
+{
+	return data_;
+}
+
+pybind11::object rowversion_column::do_get_mask()
+{
+	return mask_;
+}
+
+void rowversion_column::resize(std::size_t new_size)
+{
+	npy_intp size = new_size;
+	PyArray_Dims new_dimensions = {&size, 1};
+	int const no_reference_check = 0;
+	EXTENSION PyArray_Resize(get_array_ptr(data_), &new_dimensions, no_reference_check, NPY_ANYORDER);
+	EXTENSION PyArray_Resize(get_array_ptr(mask_), &new_dimensions, no_reference_check, NPY_ANYORDER);
+	size_ = new_size;
+}
+
+
+}
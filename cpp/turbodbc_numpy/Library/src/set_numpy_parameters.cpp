@@ -3,6 +3,7 @@
 #include <turbodbc_numpy/ndarrayobject.h>
 
 #include <turbodbc/errors.h>
+#include <turbodbc/indicator_helpers.h>
 #include <turbodbc/make_description.h>
 #include <turbodbc/type_code.h>
 #include <turbodbc/time_helpers.h>
@@ -29,6 +30,8 @@ namespace {
                             std::size_t parameter_index) :
             data(data),
             mask(mask),
+            mask_values(mask.data()),
+            uses_individual_mask(mask.size() != 1),
             parameters(parameters),
             parameter_index(parameter_index)
         {}
@@ -36,12 +39,35 @@ namespace {
         cpp_odbc::multi_value_buffer & get_buffer() {
             return parameters.get_parameters()[parameter_index]->get_buffer();
         }
+
+        /**
+         * @brief Set the indicators of rows [start, start + elements) to
+         *        valid_indicator or SQL_NULL_DATA according to the mask
+         */
+        void set_indicator(cpp_odbc::multi_value_buffer & buffer, std::size_t start, std::size_t elements, intptr_t valid_indicator) {
+            if (uses_individual_mask) {
+                turbodbc::null_mask_to_indicators(reinterpret_cast<std::uint8_t const *>(mask_values + start), elements,
+                                                  valid_indicator, buffer.indicator_pointer());
+            } else {
+                intptr_t const sql_mask = (*mask_values == NPY_TRUE) ? SQL_NULL_DATA : valid_indicator;
+                std::fill_n(buffer.indicator_pointer(), elements, sql_mask);
+            }
+        }
+
+        /**
+         * @brief Fill the parameter buffers with the given rows. This is called
+         *        without holding the GIL; converters which access Python
+         *        objects need to acquire it themselves.
+         */
         virtual void set_batch(std::size_t start, std::size_t elements) = 0;
 
         virtual ~parameter_converter() = default;
 
         pybind11::array const & data;
         pybind11::array_t<bool> const & mask;
+        // Raw mask values are extracted while the GIL is held
+        bool const * const mask_values;
+        bool const uses_individual_mask;
         turbodbc::bound_parameter_set & parameters;
         std::size_t const parameter_index;
     };
@@ -53,29 +79,21 @@ namespace {
                          std::size_t parameter_index,
                          turbodbc::type_code type) :
             parameter_converter(data, mask, parameters, parameter_index),
-            type(type)
+            type(type),
+            values(static_cast<Value const *>(data.data()))
         {
             parameters.rebind(parameter_index, turbodbc::make_description(type, 0));
         }
 
         void set_batch(std::size_t start, std::size_t elements) final
         {
-            auto data_ptr = data.unchecked<Value, 1>().data(0);
             auto & buffer = get_buffer();
-            std::memcpy(buffer.data_pointer(), data_ptr + start, elements * sizeof(Value));
-            if (mask.size() != 1) {
-                auto const indicator = buffer.indicator_pointer();
-                auto const mask_start = mask.unchecked<1>().data(start);
-                for (std::size_t i = 0; i != elements; ++i) {
-                    indicator[i] = (mask_start[i] == NPY_TRUE) ? SQL_NULL_DATA : sizeof(Value);
-                }
-            } else {
-                intptr_t const sql_mask = (*mask.data() == NPY_TRUE) ? SQL_NULL_DATA : sizeof(Value);
-                std::fill_n(buffer.indicator_pointer(), elements, sql_mask);
-            }
+            std::memcpy(buffer.data_pointer(), values + start, elements * sizeof(Value));
+            set_indicator(buffer, start, elements, sizeof(Value));
         }
     private:
         turbodbc::type_code type;
+        Value const * const values;
     };
 
 
@@ -87,7 +105,7 @@ namespace {
                              turbodbc::type_code code,
                              std::intptr_t element_size) :
             parameter_converter(data, mask, parameters, parameter_index),
-            uses_individual_mask(mask.size() != 1),
+            values(static_cast<std::int64_t const *>(data.data())),
             element_size(element_size)
         {
             parameters.rebind(parameter_index, turbodbc::make_description(code, 0));
@@ -96,33 +114,22 @@ namespace {
         void set_batch_with_individual_mask(std::size_t start, std::size_t elements)
         {
             auto & buffer = get_buffer();
-            auto const data_start = data.unchecked<std::int64_t, 1>().data(start);
-            auto const mask_start = mask.unchecked<1>().data(start);
+            auto const data_start = values + start;
 
-            for (std::size_t i = 0; i != elements; ++i) {
-                auto element = buffer[i];
-                if (mask_start[i] == NPY_TRUE) {
-                    element.indicator = SQL_NULL_DATA;
-                } else {
-                    convert(data_start[i], element.data_pointer);
-                    element.indicator = element_size;
-                }
-            }
+            convert(data_start, elements, buffer.data_pointer());
+            set_indicator(buffer, start, elements, element_size);
         }
 
         void set_batch_with_shared_mask(std::size_t start, std::size_t elements)
         {
             auto & buffer = get_buffer();
-            auto const data_start = data.unchecked<std::int64_t, 1>().data(start);
+            auto const data_start = values + start;
 
-            if (*mask.data() == NPY_TRUE) {
+            if (*mask_values == NPY_TRUE) {
                 std::fill_n(buffer.indicator_pointer(), elements, static_cast<std::int64_t>(SQL_NULL_DATA));
             } else {
-                for (std::size_t i = 0; i != elements; ++i) {
-                    auto element = buffer[i];
-                    convert(data_start[i], element.data_pointer);
-                    element.indicator = element_size;
-                }
+                convert(data_start, elements, buffer.data_pointer());
+                std::fill_n(buffer.indicator_pointer(), elements, element_size);
             }
         }
 
@@ -135,9 +142,9 @@ namespace {
             }
         }
 
-        virtual void convert(std::int64_t data, char * destination) = 0;
+        virtual void convert(std::int64_t const * data, std::size_t elements, char * destination) = 0;
     private:
-        bool const uses_individual_mask;
+        std::int64_t const * const values;
         std::intptr_t element_size;
     };
 
@@ -155,8 +162,8 @@ namespace {
                                  sizeof(SQL_TIMESTAMP_STRUCT))
         {}
 
-        virtual void convert(std::int64_t data, char * destination) {
-            turbodbc::microseconds_to_timestamp(data, destination);
+        void convert(std::int64_t const * data, std::size_t elements, char * destination) final {
+            turbodbc::microseconds_to_timestamps(data, elements, destination);
         }
     };
 
@@ -174,8 +181,8 @@ namespace {
                                  sizeof(SQL_TIMESTAMP_STRUCT))
         {}
 
-        virtual void convert(std::int64_t data, char * destination) {
-            turbodbc::nanoseconds_to_timestamp(data, destination);
+        void convert(std::int64_t const * data, std::size_t elements, char * destination) final {
+            turbodbc::nanoseconds_to_timestamps(data, elements, destination);
         }
     };
 
@@ -193,8 +200,8 @@ namespace {
                                  sizeof(SQL_DATE_STRUCT))
         {}
 
-        virtual void convert(std::int64_t data, char * destination) {
-            turbodbc::days_to_date(data, destination);
+        void convert(std::int64_t const * data, std::size_t elements, char * destination) final {
+            turbodbc::days_to_dates(data, elements, destination);
         }
     };
 
@@ -263,8 +270,8 @@ namespace {
         {
             auto const maximum_length = maximum_string_length(batch);
             // Propagate the maximum string length to the parameters.
-            // These then adjust the size of the underlying buffer.
-            parameters.rebind(parameter_index, turbodbc::make_description(type, maximum_length));
+            // These only grow the underlying buffer if it is too small.
+            parameters.ensure_capacity(parameter_index, type, maximum_length);
             auto & buffer = get_buffer();
             auto const character_size = sizeof(typename String::value_type);
 
@@ -283,13 +290,17 @@ namespace {
         template <typename String>
         void set_batch_of_type(std::size_t start, std::size_t elements)
         {
-            if (mask.size() != 1) {
-                auto const batch = extract_batch_with_individual_mask<String>(start, elements);
-                fill_batch(batch);
-            } else {
-                auto const batch = extract_batch_with_shared_mask<String>(start, elements);
-                fill_batch(batch);
+            std::vector<std::pair<bool, String>> batch;
+            {
+                // Extracting values from Python objects requires the GIL
+                pybind11::gil_scoped_acquire acquire;
+                if (uses_individual_mask) {
+                    batch = extract_batch_with_individual_mask<String>(start, elements);
+                } else {
+                    batch = extract_batch_with_shared_mask<String>(start, elements);
+                }
             }
+            fill_batch(batch);
         }
 
         void set_batch(std::size_t start, std::size_t elements) final
@@ -354,14 +365,20 @@ void set_numpy_parameters(turbodbc::bound_parameter_set & parameters, std::vecto
 
     auto converters = make_converters(columns, parameters);
 
-    auto const total_sets = std::get<0>(columns.front()).size();
+    auto const total_sets = static_cast<std::size_t>(std::get<0>(columns.front()).size());
 
-    for (std::size_t start = 0; start < total_sets; start += parameters.buffered_sets()) {
+    // Columns are kept alive by the caller, so conversion and execution can
+    // proceed without the GIL. Other threads may meanwhile insert using
+    // their own connections.
+    pybind11::gil_scoped_release release;
+    // the number of buffered sets may change after each batch in adaptive mode
+    for (std::size_t start = 0; start < total_sets; ) {
         auto const in_this_batch = std::min(parameters.buffered_sets(), total_sets - start);
         for (std::size_t i = 0; i != columns.size(); ++i) {
             converters[i]->set_batch(start, in_this_batch);
         }
         parameters.execute_batch(in_this_batch);
+        start += in_this_batch;
     }
 }
 
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <turbodbc_numpy/masked_column.h>
+#include <turbodbc/type_code.h>
+
+
+namespace turbodbc_numpy {
+
+/**
+ * @brief Collects binary values and unique identifiers as Python bytes objects
+ */
+class bytes_column : public masked_column {
+public:
+    bytes_column(turbodbc::type_code type, std::size_t total_buffer_size);
+    virtual ~bytes_column();
+
+private:
+    void do_append(cpp_odbc::multi_value_buffer const & buffer, std::size_t n_values) final;
+
+    pybind11::object do_get_data() final;
+    pybind11::object do_get_mask() final;
+
+    turbodbc::type_code type_;
+    std::size_t maximum_size_;
+    pybind11::list data_;
+};
+
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <turbodbc_numpy/masked_column.h>
+
+namespace turbodbc_numpy {
+
+/**
+ * @brief Collects SQL_NUMERIC_STRUCT values as float64, since NumPy
+ *        lacks an exact decimal dtype
+ */
+class decimal_column : public masked_column {
+public:
+	decimal_column(std::size_t scale);
+	virtual ~decimal_column();
+private:
+	void do_append(cpp_odbc::multi_value_buffer const & buffer, std::size_t n_values) final;
+
+	pybind11::object do_get_data() final;
+	pybind11::object do_get_mask() final;
+
+	void resize(std::size_t new_size);
+
+	int scale_;
+	pybind11::object data_;
+	pybind11::object mask_;
+	std::size_t size_;
+};
+
+}
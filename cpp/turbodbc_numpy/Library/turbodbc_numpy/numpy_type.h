@@ -8,7 +8,12 @@ struct numpy_type {
 };
 
 extern numpy_type const numpy_int_type;
+extern numpy_type const numpy_int8_type;
+extern numpy_type const numpy_int16_type;
+extern numpy_type const numpy_int32_type;
+extern numpy_type const numpy_uint64_type;
 extern numpy_type const numpy_double_type;
+extern numpy_type const numpy_float_type;
 extern numpy_type const numpy_bool_type;
 extern numpy_type const numpy_datetime_type;
 
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <turbodbc_numpy/masked_column.h>
+
+namespace turbodbc_numpy {
+
+/**
+ * @brief Collects big-endian ROWVERSION values as uint64
+ */
+class rowversion_column : public masked_column {
+public:
+	rowversion_column();
+	virtual ~rowversion_column();
+private:
+	void do_append(cpp_odbc::multi_value_buffer const & buffer, std::size_t n_values) final;
+
+	pybind11::object do_get_data() final;
+	pybind11::object do_get_mask() final;
+
+	void resize(std::size_t new_size);
+
+	pybind11::object data_;
+	pybind11::object mask_;
+	std::size_t size_;
+};
+
+}
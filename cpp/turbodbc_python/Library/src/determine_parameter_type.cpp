@@ -31,6 +31,14 @@ namespace {
         destination.indicator = s.size();
     }
 
+    void set_binary(pybind11::handle const & value, cpp_odbc::writable_buffer_element & destination)
+    {
+        auto const ptr = value.ptr();
+        auto const size = PyBytes_GET_SIZE(ptr);
+        std::memcpy(destination.data_pointer, PyBytes_AS_STRING(ptr), size);
+        destination.indicator = size;
+    }
+
     void set_unicode(pybind11::handle const & value, cpp_odbc::writable_buffer_element & destination)
     {
         auto const s = value.cast<std::u16string>();
@@ -88,6 +96,9 @@ python_parameter_info determine_parameter_type(pybind11::handle const & value, t
             return {set_floating_point, type_code::floating_point, size_not_important};
         }
     }
+    if (PyBytes_Check(value.ptr())) {
+        return {set_binary, type_code::binary, static_cast<std::size_t>(PyBytes_GET_SIZE(value.ptr()))};
+    }
     if (initial_type == type_code::unicode) {
         auto caster = pybind11::detail::make_caster<std::u16string>();
         if (caster.load(value, true)) {
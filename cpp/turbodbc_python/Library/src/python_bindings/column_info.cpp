@@ -12,6 +12,8 @@ void for_column_info(pybind11::module & module)
     pybind11::class_<column_info>(module, "ColumnInfo")
         .def_readonly("name", &column_info::name)
         .def_readonly("supports_null_values", &column_info::supports_null_values)
+        .def_readonly("precision", &column_info::precision)
+        .def_readonly("scale", &column_info::scale)
         .def("type_code", [](column_info const & info) {
             return static_cast<int>(info.type);
         });
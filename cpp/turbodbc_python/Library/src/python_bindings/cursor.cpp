@@ -1,4 +1,5 @@
 #include <turbodbc/cursor.h>
+#include <turbodbc/result_sets/double_buffered_result_set.h>
 
 #include <pybind11/pybind11.h>
 
@@ -16,6 +17,40 @@ void for_cursor(pybind11::module & module)
             .def("_reset",  &turbodbc::cursor::reset)
             .def("get_row_count", &turbodbc::cursor::get_row_count)
             .def("get_result_set", &turbodbc::cursor::get_result_set)
+            .def("_get_failed_parameter_sets", [](turbodbc::cursor& cursor) {
+                pybind11::list failures;
+                for (auto const & failure : cursor.get_command()->get_parameters().failed_sets()) {
+                    failures.append(pybind11::make_tuple(failure.index,
+                                                         failure.processed,
+                                                         failure.diagnostic.odbc_status_code,
+                                                         failure.diagnostic.native_error_code,
+                                                         failure.diagnostic.message));
+                }
+                return failures;
+            })
+            .def("_get_buffered_parameter_sets", [](turbodbc::cursor& cursor) -> pybind11::object {
+                auto const command = cursor.get_command();
+                if (not command) {
+                    return pybind11::none();
+                }
+                return pybind11::cast(command->get_parameters().buffered_sets());
+            })
+            .def("_get_prefetch_statistics", [](turbodbc::cursor& cursor) -> pybind11::object {
+                auto const result_set = std::dynamic_pointer_cast<turbodbc::result_sets::double_buffered_result_set>(cursor.get_result_set());
+                if (not result_set) {
+                    return pybind11::none();
+                }
+                auto const statistics = result_set->get_prefetch_statistics();
+                pybind11::dict summary;
+                summary["slots"] = statistics.slots;
+                summary["requested_batches"] = statistics.requested_batches;
+                summary["requests_finding_ring_empty"] = statistics.requests_finding_ring_empty;
+                summary["requests_finding_ring_full"] = statistics.requests_finding_ring_full;
+                summary["fetched_ahead"] = statistics.fetched_ahead;
+                summary["consumer_wait_seconds"] = std::chrono::duration<double>(statistics.consumer_wait).count();
+                summary["producer_wait_seconds"] = std::chrono::duration<double>(statistics.producer_wait).count();
+                return summary;
+            })
         ;
 }
 
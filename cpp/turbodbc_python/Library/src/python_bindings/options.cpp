@@ -72,6 +72,17 @@ void for_options(pybind11::module & module)
         .def_readwrite("limit_varchar_results_to_max", &turbodbc::options::limit_varchar_results_to_max)
         .def_readwrite("force_extra_capacity_for_unicode", &turbodbc::options::force_extra_capacity_for_unicode)
         .def_readwrite("fetch_wchar_as_char", &turbodbc::options::fetch_wchar_as_char)
+        .def_readwrite("fetch_narrow_numeric_types", &turbodbc::options::fetch_narrow_numeric_types)
+        .def_readwrite("fetch_exact_decimals", &turbodbc::options::fetch_exact_decimals)
+        .def_readwrite("fetch_rowversion_as_integer", &turbodbc::options::fetch_rowversion_as_integer)
+        .def_readwrite("fetch_nanosecond_timestamps", &turbodbc::options::fetch_nanosecond_timestamps)
+        .def_readwrite("presize_string_parameters", &turbodbc::options::presize_string_parameters)
+        .def_readwrite("enable_bulk_copy", &turbodbc::options::enable_bulk_copy)
+        .def_readwrite("adaptive_parameter_sets", &turbodbc::options::adaptive_parameter_sets)
+        .def_readwrite("parameter_buffer_megabytes", &turbodbc::options::parameter_buffer_megabytes)
+        .def_readwrite("parameter_batch_milliseconds", &turbodbc::options::parameter_batch_milliseconds)
+        .def_readwrite("parameter_set_retries", &turbodbc::options::parameter_set_retries)
+        .def_readwrite("prefetch_slots", &turbodbc::options::prefetch_slots)
     ;
 
 }
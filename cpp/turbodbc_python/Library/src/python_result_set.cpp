@@ -1,7 +1,11 @@
 #include <turbodbc_python/python_result_set.h>
 
+#include <turbodbc/binary_helpers.h>
+#include <turbodbc/decimal_helpers.h>
 #include <turbodbc/make_field_translator.h>
+#include <turbodbc/sql_server_types.h>
 #include <turbodbc/string_helpers.h>
+#include <turbodbc/time_helpers.h>
 
 #include <sql.h>
 #include <Python.h>
@@ -17,6 +21,10 @@ namespace {
     using pybind11::object;
     using pybind11::cast;
 
+    // decimal.Decimal and uuid.UUID, imported once like the datetime C API
+    PyObject * decimal_type = nullptr;
+    PyObject * uuid_type = nullptr;
+
     object make_date(SQL_DATE_STRUCT const & date)
     {
         return reinterpret_steal<object>(PyDate_FromDate(date.year, date.month, date.day));
@@ -30,6 +38,38 @@ namespace {
                                                                     ts.hour, ts.minute, ts.second, adjusted_fraction));
     }
 
+    object make_time(ss_time2_struct const & time)
+    {
+        return reinterpret_steal<object>(PyTime_FromTime(time.hour, time.minute, time.second, time.fraction / 1000));
+    }
+
+    object make_utc_timestamp(char const * data_pointer)
+    {
+        SQL_TIMESTAMP_STRUCT ts;
+        timestamp_offset_to_utc_timestamp(data_pointer, reinterpret_cast<char *>(&ts));
+        auto const timestamp = PyDateTimeAPI->DateTime_FromDateAndTime(ts.year, ts.month, ts.day,
+                                                                       ts.hour, ts.minute, ts.second, ts.fraction / 1000,
+                                                                       PyDateTime_TimeZone_UTC, PyDateTimeAPI->DateTimeType);
+        if (timestamp == nullptr) {
+            // e.g., 0001-01-01 with a positive offset precedes datetime.min in UTC
+            throw pybind11::error_already_set();
+        }
+        return reinterpret_steal<object>(timestamp);
+    }
+
+    object make_uuid(char const * data_pointer)
+    {
+        uint8_t bytes[16];
+        guid_to_bytes(data_pointer, bytes);
+        return pybind11::handle(uuid_type)(pybind11::arg("bytes") = pybind11::bytes(reinterpret_cast<char const *>(bytes), sizeof(bytes)));
+    }
+
+    object make_decimal(char const * data_pointer, std::size_t scale)
+    {
+        auto const text = numeric_to_string(data_pointer, static_cast<int>(scale));
+        return reinterpret_steal<object>(PyObject_CallFunction(decimal_type, "s", text.c_str()));
+    }
+
     object make_object(turbodbc::column_info const & info, char const * data_pointer, int64_t size)
     {
         switch (info.type) {
@@ -37,8 +77,16 @@ namespace {
                 return cast(*reinterpret_cast<bool const *>(data_pointer));
             case type_code::integer:
                 return cast(*reinterpret_cast<int64_t const *>(data_pointer));
+            case type_code::integer_8:
+                return cast(*reinterpret_cast<int8_t const *>(data_pointer));
+            case type_code::integer_16:
+                return cast(*reinterpret_cast<int16_t const *>(data_pointer));
+            case type_code::integer_32:
+                return cast(*reinterpret_cast<int32_t const *>(data_pointer));
             case type_code::floating_point:
                 return cast(*reinterpret_cast<double const *>(data_pointer));
+            case type_code::floating_point_32:
+                return cast(*reinterpret_cast<float const *>(data_pointer));
             case type_code::string:
                 return reinterpret_steal<object>(PyUnicode_DecodeUTF8(data_pointer,
                                                                       buffered_string_size(size, info.element_size - 1),
@@ -50,7 +98,22 @@ namespace {
             case type_code::date:
                 return make_date(*reinterpret_cast<SQL_DATE_STRUCT const *>(data_pointer));
             case type_code::timestamp:
+            case type_code::timestamp_nanoseconds:
                 return make_timestamp(*reinterpret_cast<SQL_TIMESTAMP_STRUCT const *>(data_pointer));
+            case type_code::timestamp_offset:
+            case type_code::timestamp_offset_nanoseconds:
+                return make_utc_timestamp(data_pointer);
+            case type_code::time:
+                return make_time(*reinterpret_cast<ss_time2_struct const *>(data_pointer));
+            case type_code::guid:
+                return make_uuid(data_pointer);
+            case type_code::decimal:
+                return make_decimal(data_pointer, info.scale);
+            case type_code::binary:
+                return reinterpret_steal<object>(PyBytes_FromStringAndSize(data_pointer,
+                                                                           buffered_string_size(size, info.element_size)));
+            case type_code::rowversion:
+                return reinterpret_steal<object>(PyLong_FromUnsignedLongLong(rowversion_to_integer(data_pointer)));
             default:
                 throw std::logic_error("Encountered unsupported type code");
         }
@@ -60,6 +123,8 @@ namespace {
 
 void python_result_set_init() {
     PyDateTime_IMPORT;
+    decimal_type = pybind11::module::import("decimal").attr("Decimal").release().ptr();
+    uuid_type = pybind11::module::import("uuid").attr("UUID").release().ptr();
 }
 
 python_result_set::python_result_set(result_set & base) :